@@ -0,0 +1,51 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void main_bench_function(BenchResults& res, const BenchOptions& opts)
+{
+    bench_bitwise(res, opts);
+    bench_divider(res, opts);
+    bench_math_int(res, opts);
+    bench_math_fp(res, opts);
+    bench_math_func(res, opts);
+    bench_shuffle(res, opts);
+    bench_sort(res, opts);
+    bench_string(res, opts);
+    bench_codec(res, opts);
+    bench_transpose(res, opts);
+    bench_linalg(res, opts);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+// The dispatcher is used only to collect the available functions
+inline simdpp::Arch get_arch()
+{
+    return simdpp::Arch();
+}
+
+#define SIMDPP_USER_ARCH_INFO get_arch()
+
+SIMDPP_MAKE_DISPATCHER_VOID2(main_bench_function, BenchResults&, const BenchOptions&)
+
+#if SIMDPP_EMIT_DISPATCHER
+std::vector<simdpp::detail::FnVersion> get_bench_archs()
+{
+    simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};
+    using FunPtr = void(*)(BenchResults&, const BenchOptions&);
+    SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, main_bench_function, FunPtr)
+    std::vector<simdpp::detail::FnVersion> result;
+    result.assign(versions, versions+SIMDPP_DISPATCH_MAX_ARCHS);
+    return result;
+}
+#endif
@@ -0,0 +1,31 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_INSN_BENCHES_H
+#define LIBSIMDPP_BENCH_INSN_BENCHES_H
+
+#include "../utils/bench_results.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void main_bench_function(BenchResults& res, const BenchOptions& opts);
+void bench_bitwise(BenchResults& res, const BenchOptions& opts);
+void bench_codec(BenchResults& res, const BenchOptions& opts);
+void bench_divider(BenchResults& res, const BenchOptions& opts);
+void bench_linalg(BenchResults& res, const BenchOptions& opts);
+void bench_math_fp(BenchResults& res, const BenchOptions& opts);
+void bench_math_func(BenchResults& res, const BenchOptions& opts);
+void bench_math_int(BenchResults& res, const BenchOptions& opts);
+void bench_shuffle(BenchResults& res, const BenchOptions& opts);
+void bench_sort(BenchResults& res, const BenchOptions& opts);
+void bench_string(BenchResults& res, const BenchOptions& opts);
+void bench_transpose(BenchResults& res, const BenchOptions& opts);
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+#endif
@@ -0,0 +1,29 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void bench_bitwise(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    using V = uint32<SIMDPP_FAST_INT32_SIZE>;
+
+    BENCH_OP2(res, opts, V, bit_and, make_uint(0x12345678), make_uint(0xfedcba98));
+    BENCH_OP2(res, opts, V, bit_andnot, make_uint(0x12345678), make_uint(0xfedcba98));
+    BENCH_OP2(res, opts, V, bit_or, make_uint(0x12345678), make_uint(0xfedcba98));
+    BENCH_OP2(res, opts, V, bit_xor, make_uint(0x12345678), make_uint(0xfedcba98));
+    BENCH_OP1(res, opts, V, bit_not, make_uint(0x12345678));
+
+    bench_op<false>(res, opts, "blend",
+                    [](const V& r, const V& x) { return V(blend(r, x, cmp_lt(r, x))); },
+                    V(make_uint(0x12345678)), V(make_uint(0xfedcba98)));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
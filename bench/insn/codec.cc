@@ -0,0 +1,69 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The codecs are measured on 4 KiB of binary data and its encodings, the
+    reported sizes refer to the binary data. The scalar code that handles the
+    tails of the input is measured on the same data for comparison.
+*/
+void bench_codec(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    using namespace simdpp::detail::codec;
+    const std::size_t size = 4096;
+
+    std::vector<uint8_t> data(size);
+    uint32_t seed = 1;
+    for (auto& b : data) {
+        seed = seed * 1103515245 + 12345;
+        b = uint8_t(seed >> 16);
+    }
+    const uint8_t* src = data.data();
+
+    std::vector<char> b64(base64_encoded_size(size));
+    std::vector<char> hex(size * 2);
+    std::vector<uint8_t> out(size);
+    base64_encode(src, size, b64.data());
+    hex_encode(src, size, hex.data());
+    const char* pb = b64.data();
+    const char* ph = hex.data();
+
+    const std::string type = "uint8[" + std::to_string(size) + "]";
+
+    bench_kernel(res, opts, "base64_encode", type, size,
+                 [&]() { return base64_encode(src, size, b64.data()); });
+    bench_kernel(res, opts, "base64_encode (scalar)", type, size, [&]() {
+        return std::size_t(base64_encode_scalar(src, size, b64.data()) - pb);
+    });
+    bench_kernel(res, opts, "base64_decode", type, size,
+                 [&]() { return base64_decode(pb, b64.size(), out.data()); });
+    bench_kernel(res, opts, "base64_decode (scalar)", type, size, [&]() {
+        return std::size_t(base64_decode_scalar(pb, b64.size(), out.data()) -
+                           out.data());
+    });
+    bench_kernel(res, opts, "base64_validate", type, size, [&]() {
+        return std::size_t(base64_validate(pb, b64.size()));
+    });
+    bench_kernel(res, opts, "hex_encode", type, size,
+                 [&]() { return hex_encode(src, size, hex.data()); });
+    bench_kernel(res, opts, "hex_encode (scalar)", type, size, [&]() {
+        return std::size_t(hex_encode_scalar(src, size, hex.data()) - ph);
+    });
+    bench_kernel(res, opts, "hex_decode", type, size,
+                 [&]() { return hex_decode(ph, hex.size(), out.data()); });
+    bench_kernel(res, opts, "hex_decode (scalar)", type, size, [&]() {
+        return std::size_t(hex_decode_scalar(ph, hex.size(), out.data()) -
+                           out.data());
+    });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
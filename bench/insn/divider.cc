@@ -0,0 +1,65 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Divides an array by a runtime divisor using div() with a precomputed
+    divider<T> and using the scalar division operator. The divisor is hidden
+    from the optimizer, thus the compiler can't replace the scalar division
+    with a multiplication.
+*/
+template<class V>
+void bench_divider_type(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const std::size_t count = 1024;
+    const unsigned N = V::length;
+
+    std::vector<T, aligned_allocator<T, sizeof(V)>> src(count), dst(count);
+    for (std::size_t i = 0; i < count; ++i)
+        src[i] = T(i * 0x9e3779b97f4a7c15ULL >> 17);
+    T* pdst = dst.data();
+    const T* psrc = src.data();
+
+    T dv = 7;
+    bench_opaque_native(dv);
+    divider<T> d(dv);
+
+    std::string type = bench_type_name<V>();
+    std::size_t size = count * sizeof(T);
+
+    bench_kernel(res, opts, "div (divider)", type, size, [&]() {
+        for (std::size_t i = 0; i < count; i += N) {
+            V a = load(psrc + i);
+            store(pdst + i, div(a, d));
+        }
+        return std::size_t(pdst[count - 1]);
+    });
+    bench_kernel(res, opts, "div (scalar)", type, size, [&]() {
+        for (std::size_t i = 0; i < count; ++i)
+            pdst[i] = T(psrc[i] / dv);
+        return std::size_t(pdst[count - 1]);
+    });
+}
+
+void bench_divider(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    bench_divider_type<uint16<SIMDPP_FAST_INT16_SIZE>>(res, opts);
+    bench_divider_type<int16<SIMDPP_FAST_INT16_SIZE>>(res, opts);
+    bench_divider_type<uint32<SIMDPP_FAST_INT32_SIZE>>(res, opts);
+    bench_divider_type<int32<SIMDPP_FAST_INT32_SIZE>>(res, opts);
+    bench_divider_type<uint64<SIMDPP_FAST_INT64_SIZE>>(res, opts);
+    bench_divider_type<int64<SIMDPP_FAST_INT64_SIZE>>(res, opts);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,127 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+static float bench_dsp_narrow(float r) { return r; }
+static int16_t bench_dsp_narrow(int32_t r)
+{
+    return simdpp::detail::dsp::fir_q15_narrow(r);
+}
+
+// A plain loop over the outputs and the taps, for comparison
+template<class T, class Acc>
+void bench_fir_scalar(const T* x, std::size_t n, const T* h, std::size_t taps,
+                      std::size_t factor, T* y)
+{
+    for (std::size_t i = 0; i * factor + taps <= n; ++i) {
+        Acc r = 0;
+        for (std::size_t j = 0; j < taps; ++j)
+            r += Acc(h[j]) * x[i * factor + taps - 1 - j];
+        y[i] = bench_dsp_narrow(r);
+    }
+}
+
+/*  The filters produce 4096 outputs. The reported size is the number of
+    outputs, thus the throughput column shows the time per 64 outputs.
+*/
+template<class T, class Acc>
+void bench_fir_type(BenchResults& res, const BenchOptions& opts,
+                    const char* type_name)
+{
+    const std::size_t count = 4096;
+    const std::size_t taps_list[] = { 16, 64, 128 };
+    const std::size_t factor = 4;
+
+    for (std::size_t taps : taps_list) {
+        std::size_t n = count * factor + taps;
+        std::vector<T> x(n), h(taps), y(count + 1);
+        for (std::size_t i = 0; i < n; ++i)
+            x[i] = T(int(i % 17) - 8);
+        for (std::size_t i = 0; i < taps; ++i)
+            h[i] = T(int(i % 5) - 2);
+
+        BenchOptions f_opts = opts;
+        f_opts.iterations = unsigned(std::max<std::size_t>(1, opts.iterations / taps));
+
+        std::string type = std::string(type_name) + "[" + std::to_string(taps) + " taps]";
+        const T* px = x.data();
+        const T* ph = h.data();
+        T* py = y.data();
+        std::size_t nd = count + taps - 1;
+
+        bench_kernel(res, f_opts, "fir", type, count, [&]() {
+            return simdpp::fir(px, nd, ph, taps, py);
+        });
+        bench_kernel(res, f_opts, "fir (scalar)", type, count, [&]() {
+            bench_fir_scalar<T, Acc>(px, nd, ph, taps, 1, py);
+            return std::size_t(py[1]);
+        });
+        bench_kernel(res, f_opts, "fir_decimate", type, count, [&]() {
+            return simdpp::fir_decimate(px, n, ph, taps, factor, py);
+        });
+        bench_kernel(res, f_opts, "fir_decimate (scalar)", type, count, [&]() {
+            bench_fir_scalar<T, Acc>(px, n, ph, taps, factor, py);
+            return std::size_t(py[1]);
+        });
+    }
+}
+
+/*  A 5x5 kernel is applied to a 256x256 image. The reported size is the
+    number of outputs.
+*/
+template<class T, class Acc>
+void bench_convolve_type(BenchResults& res, const BenchOptions& opts,
+                         const char* type_name)
+{
+    const std::size_t size = 256, k = 5, out = size - k + 1;
+    std::vector<T> src(size * size), dst(size * size), tmp(size * size);
+    for (std::size_t i = 0; i < src.size(); ++i)
+        src[i] = T(int(i % 13) - 6);
+    const T kx[k] = { T(1), T(4), T(6), T(4), T(1) };
+    const T ky[k] = { T(1), T(2), T(0), T(-2), T(-1) };
+
+    BenchOptions c_opts = opts;
+    c_opts.iterations = std::max(1u, opts.iterations / 256);
+
+    std::string type = std::string(type_name) + "[256x256, 5x5]";
+    bench_kernel(res, c_opts, "convolve_separable", type, out * out, [&]() {
+        simdpp::convolve_separable(src.data(), size, size, size, kx, k, ky, k,
+                                   dst.data(), size);
+        return std::size_t(dst[1]);
+    });
+    bench_kernel(res, c_opts, "convolve_separable (scalar)", type, out * out, [&]() {
+        for (std::size_t r = 0; r < size; ++r) {
+            bench_fir_scalar<T, Acc>(&src[r * size], size, kx, k, 1, &tmp[r * size]);
+        }
+        for (std::size_t r = 0; r < out; ++r) {
+            for (std::size_t c = 0; c < out; ++c) {
+                Acc a = 0;
+                for (std::size_t v = 0; v < k; ++v)
+                    a += Acc(ky[v]) * tmp[(r + k - 1 - v) * size + c];
+                dst[r * size + c] = bench_dsp_narrow(a);
+            }
+        }
+        return std::size_t(dst[1]);
+    });
+}
+
+void bench_dsp(BenchResults& res, const BenchOptions& opts)
+{
+    bench_fir_type<float, float>(res, opts, "float32");
+    bench_fir_type<int16_t, int32_t>(res, opts, "int16");
+    bench_convolve_type<float, float>(res, opts, "float32");
+    bench_convolve_type<int16_t, int32_t>(res, opts, "int16");
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,93 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Runs 10 independent chains of multiply-adds on native vectors, which is
+    enough to hide the latency of the operation on current processors. The
+    result approximates the peak floating-point throughput that gemm can
+    reach on the target.
+*/
+template<class V>
+std::size_t bench_mul_add_chains(unsigned count)
+{
+    using simdpp::detail::math::mul_add;
+    using T = typename V::element_type;
+    V x = simdpp::splat(T(0.999)), y = simdpp::splat(T(0.001));
+    V r0 = x, r1 = x, r2 = x, r3 = x, r4 = x, r5 = x, r6 = x, r7 = x, r8 = x, r9 = x;
+    // the chains must not be recognized as identical
+    bench_opaque(r0); bench_opaque(r1); bench_opaque(r2); bench_opaque(r3); bench_opaque(r4);
+    bench_opaque(r5); bench_opaque(r6); bench_opaque(r7); bench_opaque(r8); bench_opaque(r9);
+    bench_opaque(x); bench_opaque(y);
+    for (unsigned i = 0; i < count; ++i) {
+        r0 = mul_add(r0, x, y); r1 = mul_add(r1, x, y);
+        r2 = mul_add(r2, x, y); r3 = mul_add(r3, x, y);
+        r4 = mul_add(r4, x, y); r5 = mul_add(r5, x, y);
+        r6 = mul_add(r6, x, y); r7 = mul_add(r7, x, y);
+        r8 = mul_add(r8, x, y); r9 = mul_add(r9, x, y);
+    }
+    bench_sink(r0); bench_sink(r1); bench_sink(r2); bench_sink(r3); bench_sink(r4);
+    bench_sink(r5); bench_sink(r6); bench_sink(r7); bench_sink(r8); bench_sink(r9);
+    return count;
+}
+
+/*  The reported size of the gemm benchmarks is the number of floating-point
+    operations, 2 * n^3 for square matrices, thus the throughput column shows
+    the time per 64 operations and is directly comparable to the peak entry.
+*/
+template<class T, class V, class F>
+void bench_gemm_type(BenchResults& res, const BenchOptions& opts,
+                     const char* name, const char* type_name, F gemm)
+{
+    const unsigned chain_len = 256;
+    std::string peak_type = std::string(type_name) + "[peak]";
+    bench_kernel(res, opts, "gemm peak (mul_add)", peak_type,
+                 chain_len * 10 * 2 * V::length,
+                 [&]() { return bench_mul_add_chains<V>(chain_len); });
+
+    const std::size_t sizes[] = { 64, 256, 1024 };
+    for (std::size_t n : sizes) {
+        std::vector<T, simdpp::aligned_allocator<T, 64>> a(n * n), b(n * n), c(n * n);
+        for (std::size_t i = 0; i < n * n; ++i) {
+            a[i] = T(int(i % 7) - 3);
+            b[i] = T(int(i % 5) - 2);
+        }
+
+        BenchOptions g_opts = opts;
+        g_opts.iterations = unsigned(std::max<std::size_t>(1, opts.iterations * 4096 / (n * n)));
+
+        std::string type = std::string(type_name) + "[" + std::to_string(n) + "x" +
+                           std::to_string(n) + "]";
+        bench_kernel(res, g_opts, name, type, 2 * n * n * n, [&]() {
+            gemm(n, n, n, T(1), a.data(), n, b.data(), n, T(0), c.data(), n);
+            return std::size_t(c[n + 1]);
+        });
+    }
+}
+
+void bench_linalg(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    bench_gemm_type<float, float32v>(res, opts, "sgemm", "float32",
+        [](std::size_t m, std::size_t n, std::size_t k, float alpha,
+           const float* a, std::size_t lda, const float* b, std::size_t ldb,
+           float beta, float* c, std::size_t ldc)
+        { sgemm(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc); });
+    bench_gemm_type<double, float64v>(res, opts, "dgemm", "float64",
+        [](std::size_t m, std::size_t n, std::size_t k, double alpha,
+           const double* a, std::size_t lda, const double* b, std::size_t ldb,
+           double beta, double* c, std::size_t ldc)
+        { dgemm(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc); });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
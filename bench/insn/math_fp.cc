@@ -0,0 +1,50 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void bench_math_fp_type(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+
+    BENCH_OP2(res, opts, V, add, make_float(1.5), make_float(0.25));
+    BENCH_OP2(res, opts, V, sub, make_float(1.5), make_float(0.25));
+    BENCH_OP2(res, opts, V, mul, make_float(1.5), make_float(1.0));
+    BENCH_OP2(res, opts, V, div, make_float(1.5), make_float(1.0));
+    BENCH_OP2(res, opts, V, min, make_float(1.5), make_float(0.25));
+    BENCH_OP2(res, opts, V, max, make_float(1.5), make_float(0.25));
+#if SIMDPP_USE_NULL || SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+    bench_op<false>(res, opts, "fmadd",
+                    [](const V& r, const V& x) { return V(fmadd(r, x, x)); },
+                    V(make_float(1.5)), V(make_float(0.0)));
+#endif
+    BENCH_OP1(res, opts, V, sqrt, make_float(1.5));
+    BENCH_OP1(res, opts, V, abs, make_float(-1.5));
+    BENCH_OP1(res, opts, V, neg, make_float(1.5));
+    BENCH_OP1(res, opts, V, floor, make_float(1.5));
+    BENCH_OP1(res, opts, V, ceil, make_float(1.5));
+    BENCH_OP1(res, opts, V, trunc, make_float(1.5));
+}
+
+void bench_math_fp(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    using float32_n = float32<SIMDPP_FAST_FLOAT32_SIZE>;
+    using float64_n = float64<SIMDPP_FAST_FLOAT64_SIZE>;
+
+    bench_math_fp_type<float32_n>(res, opts);
+    BENCH_OP1(res, opts, float32_n, rcp_e, make_float(1.5));
+    BENCH_OP1(res, opts, float32_n, rsqrt_e, make_float(1.5));
+
+    bench_math_fp_type<float64_n>(res, opts);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,44 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The timing of the functions does not depend on the values of the
+    arguments, except that subnormal numbers may be slower on some
+    architectures. The chains of operations never reach subnormal values.
+*/
+template<class V>
+void bench_math_func_type(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+
+    BENCH_OP1(res, opts, V, exp, make_float(0.5));
+    BENCH_OP1(res, opts, V, exp_e, make_float(0.5));
+    BENCH_OP1(res, opts, V, log, make_float(1.5));
+    BENCH_OP1(res, opts, V, log_e, make_float(1.5));
+    BENCH_OP1(res, opts, V, sin, make_float(1.5));
+    BENCH_OP1(res, opts, V, sin_e, make_float(1.5));
+    BENCH_OP1(res, opts, V, cos, make_float(1.5));
+    BENCH_OP1(res, opts, V, cos_e, make_float(1.5));
+    BENCH_OP1(res, opts, V, tanh, make_float(1.5));
+    BENCH_OP1(res, opts, V, tanh_e, make_float(1.5));
+    BENCH_OP1(res, opts, V, erf, make_float(1.5));
+    BENCH_OP1(res, opts, V, erf_e, make_float(1.5));
+}
+
+void bench_math_func(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+
+    bench_math_func_type<float32<SIMDPP_FAST_FLOAT32_SIZE>>(res, opts);
+    bench_math_func_type<float64<SIMDPP_FAST_FLOAT64_SIZE>>(res, opts);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
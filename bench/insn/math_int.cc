@@ -0,0 +1,80 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void bench_math_int_common(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+
+    BENCH_OP2(res, opts, V, add, make_uint(0x12), make_uint(0x35));
+    BENCH_OP2(res, opts, V, sub, make_uint(0x12), make_uint(0x35));
+    BENCH_OP1(res, opts, V, shift_l<3>, make_uint(0x12));
+    BENCH_OP1(res, opts, V, shift_r<3>, make_uint(0x12));
+    BENCH_OP1(res, opts, V, popcnt, make_uint(0x12));
+}
+
+template<class V>
+void bench_math_int_min_max(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+
+    BENCH_OP2(res, opts, V, min, make_uint(0x12), make_uint(0x35));
+    BENCH_OP2(res, opts, V, max, make_uint(0x12), make_uint(0x35));
+}
+
+void bench_math_int(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    using uint8_n = uint8<SIMDPP_FAST_INT8_SIZE>;
+    using int8_n = int8<SIMDPP_FAST_INT8_SIZE>;
+    using uint16_n = uint16<SIMDPP_FAST_INT16_SIZE>;
+    using int16_n = int16<SIMDPP_FAST_INT16_SIZE>;
+    using uint32_n = uint32<SIMDPP_FAST_INT32_SIZE>;
+    using int32_n = int32<SIMDPP_FAST_INT32_SIZE>;
+    using uint64_n = uint64<SIMDPP_FAST_INT64_SIZE>;
+    using int64_n = int64<SIMDPP_FAST_INT64_SIZE>;
+
+    bench_math_int_common<uint8_n>(res, opts);
+    bench_math_int_min_max<uint8_n>(res, opts);
+    bench_math_int_min_max<int8_n>(res, opts);
+    BENCH_OP2(res, opts, uint8_n, add_sat, make_uint(0x12), make_uint(0x35));
+    BENCH_OP2(res, opts, uint8_n, avg, make_uint(0x12), make_uint(0x35));
+    BENCH_OP1(res, opts, int8_n, neg, make_int(0x12));
+    BENCH_OP1(res, opts, int8_n, abs, make_int(-0x12));
+
+    bench_math_int_common<uint16_n>(res, opts);
+    bench_math_int_min_max<uint16_n>(res, opts);
+    bench_math_int_min_max<int16_n>(res, opts);
+    BENCH_OP2(res, opts, uint16_n, add_sat, make_uint(0x12), make_uint(0x35));
+    BENCH_OP2(res, opts, uint16_n, avg, make_uint(0x12), make_uint(0x35));
+    BENCH_OP2(res, opts, uint16_n, mul_lo, make_uint(0x12), make_uint(0x35));
+    BENCH_OP1(res, opts, int16_n, neg, make_int(0x12));
+    BENCH_OP1(res, opts, int16_n, abs, make_int(-0x12));
+
+    bench_math_int_common<uint32_n>(res, opts);
+    bench_math_int_min_max<uint32_n>(res, opts);
+    bench_math_int_min_max<int32_n>(res, opts);
+    BENCH_OP2(res, opts, uint32_n, avg, make_uint(0x12), make_uint(0x35));
+    BENCH_OP2(res, opts, uint32_n, mul_lo, make_uint(0x12), make_uint(0x35));
+    BENCH_OP1(res, opts, int32_n, neg, make_int(0x12));
+    BENCH_OP1(res, opts, int32_n, abs, make_int(-0x12));
+
+    bench_math_int_common<uint64_n>(res, opts);
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
+    bench_math_int_min_max<uint64_n>(res, opts);
+    bench_math_int_min_max<int64_n>(res, opts);
+#endif
+    BENCH_OP1(res, opts, int64_n, neg, make_int(0x12));
+    BENCH_OP1(res, opts, int64_n, abs, make_int(-0x12));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
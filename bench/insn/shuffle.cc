@@ -0,0 +1,44 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void bench_shuffle(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    using uint8_n = uint8<SIMDPP_FAST_INT8_SIZE>;
+    using uint32_n = uint32<SIMDPP_FAST_INT32_SIZE>;
+    using float32_n = float32<SIMDPP_FAST_FLOAT32_SIZE>;
+
+    BENCH_OP2(res, opts, uint8_n, zip16_lo, make_uint(0x12), make_uint(0x35));
+    BENCH_OP2(res, opts, uint8_n, unzip16_lo, make_uint(0x12), make_uint(0x35));
+    BENCH_OP1(res, opts, uint8_n, move16_l<1>, make_uint(0x12));
+    BENCH_OP1(res, opts, uint8_n, splat<1>, make_uint(0x12));
+
+    BENCH_OP2(res, opts, uint32_n, zip4_lo, make_uint(0x12), make_uint(0x35));
+    BENCH_OP2(res, opts, uint32_n, unzip4_lo, make_uint(0x12), make_uint(0x35));
+    BENCH_OP1(res, opts, uint32_n, move4_l<1>, make_uint(0x12));
+    BENCH_OP1(res, opts, uint32_n, splat<1>, make_uint(0x12));
+
+    bench_op<true>(res, opts, "permute4<1,0,3,2>",
+                   [](const uint32_n& r, const uint32_n&) { return uint32_n(permute4<1,0,3,2>(r)); },
+                   uint32_n(make_uint(0x12)), uint32_n(make_uint(0x12)));
+    bench_op<true>(res, opts, "permute4<1,0,3,2>",
+                   [](const float32_n& r, const float32_n&) { return float32_n(permute4<1,0,3,2>(r)); },
+                   float32_n(make_float(1.5)), float32_n(make_float(1.5)));
+    bench_op<false>(res, opts, "shuffle2<0,1,2,3>",
+                    [](const float32_n& r, const float32_n& x) { return float32_n(shuffle2<0,1,2,3>(r, x)); },
+                    float32_n(make_float(1.5)), float32_n(make_float(0.5)));
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON
+    BENCH_OP2(res, opts, uint8_n, permute_bytes16, make_uint(0x12), make_uint(0x01));
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,62 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+#include <algorithm>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Sorts an array of random values using sort() and std::sort. Each
+    invocation copies the unsorted data to the work buffer first, thus the
+    time of the copy is included in both results. The number of iterations is
+    reduced for large arrays.
+*/
+template<class T>
+void bench_sort_type(BenchResults& res, const BenchOptions& opts,
+                     const char* type_name, std::size_t count)
+{
+    std::vector<T> src(count), buf(count);
+    uint64_t x = 0x9e3779b97f4a7c15;
+    for (std::size_t i = 0; i < count; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        src[i] = T(int64_t(x >> 16) - (int64_t(1) << 46));
+    }
+
+    BenchOptions sort_opts = opts;
+    sort_opts.iterations = unsigned(std::max<std::size_t>(1, opts.iterations * 64 / count));
+
+    std::string type = std::string(type_name) + "[" + std::to_string(count) + "]";
+    std::size_t size = count * sizeof(T);
+
+    bench_kernel(res, sort_opts, "sort", type, size, [&]() {
+        std::copy(src.begin(), src.end(), buf.begin());
+        simdpp::sort(buf.data(), buf.data() + count);
+        return std::size_t(buf[count / 2]);
+    });
+    bench_kernel(res, sort_opts, "std::sort", type, size, [&]() {
+        std::copy(src.begin(), src.end(), buf.begin());
+        std::sort(buf.begin(), buf.end());
+        return std::size_t(buf[count / 2]);
+    });
+}
+
+void bench_sort(BenchResults& res, const BenchOptions& opts)
+{
+    const std::size_t sizes[] = { 1 << 14, 1 << 20 };
+    for (std::size_t count : sizes) {
+        bench_sort_type<int32_t>(res, opts, "int32", count);
+        bench_sort_type<uint32_t>(res, opts, "uint32", count);
+        bench_sort_type<float>(res, opts, "float32", count);
+        bench_sort_type<int64_t>(res, opts, "int64", count);
+        bench_sort_type<uint64_t>(res, opts, "uint64", count);
+        bench_sort_type<double>(res, opts, "float64", count);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
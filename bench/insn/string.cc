@@ -0,0 +1,87 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+#include <cstring>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Hides the pointer from the optimizer so that calls to pure library
+// functions are not hoisted out of the measurement loop
+template<class T>
+T* bench_opaque_ptr(T* p)
+{
+#if defined(__GNUC__)
+    __asm__ __volatile__("" : "+r"(p));
+#else
+    bench_opaque_native(p);
+#endif
+    return p;
+}
+
+/*  The string kernels are measured on a buffer whose only match is the last
+    byte (the first byte for memrchr), thus the whole buffer is scanned. The C
+    library functions are measured on the same data for comparison.
+*/
+void bench_string(BenchResults& res, const BenchOptions& opts)
+{
+    using namespace simdpp;
+    const std::size_t size = 4096;
+
+    std::vector<char, aligned_allocator<char, 64>> a(size + 1, 'a');
+    a[0] = 'w';
+    a[size - 1] = 'z';
+    a[size] = 0;
+    std::vector<char, aligned_allocator<char, 64>> b = a;
+    const char* pa = a.data();
+    const char* pb = b.data();
+
+    const std::string type = "char[" + std::to_string(size) + "]";
+    auto addr = [](const void* p) { return reinterpret_cast<std::size_t>(p); };
+    auto opa = [&]() { return bench_opaque_ptr(pa); };
+    auto opb = [&]() { return bench_opaque_ptr(pb); };
+
+    bench_kernel(res, opts, "memchr", type, size,
+                 [&]() { return addr(simdpp::memchr(opa(), 'z', size)); });
+    bench_kernel(res, opts, "memchr (libc)", type, size,
+                 [&]() { return addr(std::memchr(opa(), 'z', size)); });
+    bench_kernel(res, opts, "memrchr", type, size,
+                 [&]() { return addr(simdpp::memrchr(opa(), 'w', size)); });
+    bench_kernel(res, opts, "strlen", type, size,
+                 [&]() { return simdpp::strlen(opa()); });
+    bench_kernel(res, opts, "strlen (libc)", type, size,
+                 [&]() { return std::strlen(opa()); });
+    bench_kernel(res, opts, "find_first_of", type, size,
+                 [&]() { return addr(simdpp::find_first_of(opa(), size,
+                                                           "xyz", 3)); });
+    bench_kernel(res, opts, "strcspn (libc)", type, size,
+                 [&]() { return std::strcspn(opa(), "xyz"); });
+    bench_kernel(res, opts, "memcmp", type, size,
+                 [&]() { return simdpp::memcmp(opa(), opb(), size); });
+    bench_kernel(res, opts, "memcmp (libc)", type, size,
+                 [&]() { return std::memcmp(opa(), opb(), size); });
+
+    // the classifiers process every block regardless of its contents
+    std::vector<std::size_t> offsets(size);
+    bench_kernel(res, opts, "json_classifier", type, size, [&]() {
+        json_classifier cl;
+        const char* p = opa();
+        uint64_t r = 0;
+        for (std::size_t i = 0; i < size; i += 64) {
+            json_block b = cl.classify(p + i);
+            r ^= b.structural ^ b.whitespace ^ b.in_string;
+        }
+        return std::size_t(r);
+    });
+    bench_kernel(res, opts, "csv_split", type, size, [&]() {
+        return csv_split(opa(), size, offsets.data());
+    });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
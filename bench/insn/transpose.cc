@@ -0,0 +1,62 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include "../utils/bench_helpers.h"
+#include <algorithm>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Transposes a square matrix using transpose() and a plain loop over the
+    source rows. The larger size exceeds the caches of most machines, thus
+    the non-temporal stores may be used. The number of iterations is reduced
+    for large matrices.
+*/
+template<class T>
+void bench_transpose_type(BenchResults& res, const BenchOptions& opts,
+                          const char* type_name, std::size_t n)
+{
+    using namespace simdpp;
+    std::vector<T, aligned_allocator<T, 64>> src(n * n), dst(n * n);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        src[i] = T(i);
+    }
+
+    BenchOptions t_opts = opts;
+    t_opts.iterations = unsigned(std::max<std::size_t>(1, opts.iterations * 4096 / (n * n)));
+
+    std::string type = std::string(type_name) + "[" + std::to_string(n) + "x" +
+                       std::to_string(n) + "]";
+    std::size_t size = n * n * sizeof(T);
+
+    bench_kernel(res, t_opts, "transpose", type, size, [&]() {
+        simdpp::transpose(src.data(), dst.data(), n, n, n, n);
+        return std::size_t(dst[n + 1]);
+    });
+    bench_kernel(res, t_opts, "transpose (scalar)", type, size, [&]() {
+        for (std::size_t r = 0; r < n; ++r) {
+            for (std::size_t c = 0; c < n; ++c) {
+                dst[c * n + r] = src[r * n + c];
+            }
+        }
+        return std::size_t(dst[n + 1]);
+    });
+}
+
+void bench_transpose(BenchResults& res, const BenchOptions& opts)
+{
+    const std::size_t sizes[] = { 256, 2048 };
+    for (std::size_t n : sizes) {
+        bench_transpose_type<uint8_t>(res, opts, "uint8", n);
+        bench_transpose_type<uint16_t>(res, opts, "uint16", n);
+        bench_transpose_type<uint32_t>(res, opts, "uint32", n);
+        bench_transpose_type<uint64_t>(res, opts, "uint64", n);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,106 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "utils/bench_results.h"
+#include "utils/bench_timer.h"
+#include <simdpp/simd.h>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#include <simdpp/dispatch/get_arch_string_list.h>
+
+std::vector<simdpp::detail::FnVersion> get_bench_archs();
+
+simdpp::Arch get_arch_from_system()
+{
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+    return simdpp::get_arch_raw_cpuid();
+#elif SIMDPP_HAS_GET_ARCH_LINUX_CPUINFO
+    return simdpp::get_arch_linux_cpuinfo();
+#else
+    std::cerr << "No architecture information could be retrieved. "
+              << "Only the NULL architecture will be benchmarked\n";
+    return simdpp::Arch::NONE_NULL;
+#endif
+}
+
+void print_usage()
+{
+    std::cerr << "Usage: bench_insn [--json <file>] [--iterations <n>] "
+              << "[--repeats <n>] [--force_arch --arch_<name>...]\n";
+}
+
+void invoke_bench_function(const simdpp::detail::FnVersion& fn,
+                           BenchResults& res, const BenchOptions& options)
+{
+    reinterpret_cast<void(*)(BenchResults&, const BenchOptions&)>(fn.fun_ptr)(res, options);
+}
+
+/*  Measures the latency and throughput of the core operations for each
+    instruction set that the library has been compiled for and the current
+    processor supports. The results are printed as tables and optionally
+    saved to a JSON file so that they can be compared across compiler versions.
+*/
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    const char* json_path = nullptr;
+    bool force_arch = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            options.iterations = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--repeats") == 0 && i + 1 < argc) {
+            options.repeats = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--force_arch") == 0) {
+            force_arch = true;
+        } else if (std::strncmp(argv[i], "--arch_", 7) != 0) {
+            print_usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (options.iterations == 0 || options.repeats == 0) {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    simdpp::Arch current_arch;
+    if (force_arch)
+        current_arch = simdpp::get_arch_string_list(argv + 1, argc - 1, "--arch_");
+    else
+        current_arch = get_arch_from_system();
+
+    std::vector<BenchResults> results;
+    for (const auto& fn : get_bench_archs()) {
+        if (fn.fun_ptr == NULL)
+            continue;
+        if (!simdpp::test_arch_subset(current_arch, fn.needed_arch)) {
+            std::cerr << "Not benchmarking: " << fn.arch_name << std::endl;
+            continue;
+        }
+        results.push_back(BenchResults(fn.arch_name));
+        invoke_bench_function(fn, results.back(), options);
+        print_bench_table(std::cout, results.back(), bench_timer_unit());
+    }
+
+    if (json_path) {
+        std::ofstream out(json_path);
+        if (!out) {
+            std::cerr << "Could not open " << json_path << " for writing\n";
+            return EXIT_FAILURE;
+        }
+        print_bench_json(out, results, options, bench_timer_unit());
+    }
+    return EXIT_SUCCESS;
+}
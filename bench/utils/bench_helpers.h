@@ -0,0 +1,189 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_HELPERS_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_HELPERS_H
+
+#include "bench_results.h"
+#include "bench_timer.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Hides the value of the argument from the optimizer so that chains of
+    operations on the same data can't be folded or hoisted out of the loops.
+    Where possible, the value is kept in a register so that no instructions
+    are emitted.
+*/
+template<class T> SIMDPP_INL
+void bench_opaque_native(T& v)
+{
+#if defined(__GNUC__)
+    __asm__ __volatile__("" : "+m"(v));
+#else
+    T* volatile p = &v;
+    v = *p;
+#endif
+}
+
+#if defined(__GNUC__) && SIMDPP_USE_SSE2
+SIMDPP_INL void bench_opaque_native(__m128& v)  { __asm__ __volatile__("" : "+x"(v)); }
+SIMDPP_INL void bench_opaque_native(__m128d& v) { __asm__ __volatile__("" : "+x"(v)); }
+SIMDPP_INL void bench_opaque_native(__m128i& v) { __asm__ __volatile__("" : "+x"(v)); }
+#endif
+#if defined(__GNUC__) && SIMDPP_USE_AVX
+SIMDPP_INL void bench_opaque_native(__m256& v)  { __asm__ __volatile__("" : "+x"(v)); }
+SIMDPP_INL void bench_opaque_native(__m256d& v) { __asm__ __volatile__("" : "+x"(v)); }
+SIMDPP_INL void bench_opaque_native(__m256i& v) { __asm__ __volatile__("" : "+x"(v)); }
+#endif
+#if defined(__GNUC__) && SIMDPP_USE_AVX512F
+SIMDPP_INL void bench_opaque_native(__m512& v)  { __asm__ __volatile__("" : "+v"(v)); }
+SIMDPP_INL void bench_opaque_native(__m512d& v) { __asm__ __volatile__("" : "+v"(v)); }
+SIMDPP_INL void bench_opaque_native(__m512i& v) { __asm__ __volatile__("" : "+v"(v)); }
+#endif
+
+template<class V> SIMDPP_INL
+void bench_opaque(V& v)
+{
+    typename V::native_type n = v.native();
+    bench_opaque_native(n);
+    v = n;
+}
+
+// Makes sure that the given value is computed
+template<class V> SIMDPP_INL
+void bench_sink(const V& v)
+{
+    typename V::native_type n = v.native();
+    bench_opaque_native(n);
+}
+
+/// Returns a string such as "float32<4>" describing the vector type
+template<class V>
+std::string bench_type_name()
+{
+    using E = typename V::element_type;
+    std::string r;
+    if (std::is_floating_point<E>::value)
+        r = "float";
+    else if (std::is_signed<E>::value)
+        r = "int";
+    else
+        r = "uint";
+    r += std::to_string(sizeof(E) * 8) + "<" + std::to_string(V::length) + ">";
+    return r;
+}
+
+/*  Measures the latency of F by running a chain of dependent operations. If
+    Unary is true, the operation does not use its second argument, thus the
+    intermediate values are hidden from the optimizer directly.
+*/
+template<bool Unary, class V, class F>
+double bench_latency(const BenchOptions& opts, F f, const V& a, const V& b)
+{
+    std::uint64_t best = ~std::uint64_t(0);
+    for (unsigned rep = 0; rep < opts.repeats; ++rep) {
+        V r = a;
+        V x = b;
+        std::uint64_t start = bench_ticks();
+        for (unsigned i = 0; i < opts.iterations; ++i) {
+            if (Unary)
+                bench_opaque(r);
+            else
+                bench_opaque(x);
+            r = f(r, x);
+        }
+        std::uint64_t end = bench_ticks();
+        bench_sink(r);
+        best = std::min(best, end - start);
+    }
+    return double(best) / opts.iterations;
+}
+
+/*  Measures the reciprocal throughput of F by running 8 independent chains
+    of operations.
+*/
+template<bool Unary, class V, class F>
+double bench_throughput(const BenchOptions& opts, F f, const V& a, const V& b)
+{
+    std::uint64_t best = ~std::uint64_t(0);
+    for (unsigned rep = 0; rep < opts.repeats; ++rep) {
+        V r0 = a, r1 = a, r2 = a, r3 = a, r4 = a, r5 = a, r6 = a, r7 = a;
+        V x = b;
+        bench_opaque(r0); bench_opaque(r1); bench_opaque(r2); bench_opaque(r3);
+        bench_opaque(r4); bench_opaque(r5); bench_opaque(r6); bench_opaque(r7);
+
+        std::uint64_t start = bench_ticks();
+        for (unsigned i = 0; i < opts.iterations; ++i) {
+            if (Unary) {
+                bench_opaque(r0); bench_opaque(r1); bench_opaque(r2); bench_opaque(r3);
+                bench_opaque(r4); bench_opaque(r5); bench_opaque(r6); bench_opaque(r7);
+            } else {
+                bench_opaque(x);
+            }
+            r0 = f(r0, x); r1 = f(r1, x); r2 = f(r2, x); r3 = f(r3, x);
+            r4 = f(r4, x); r5 = f(r5, x); r6 = f(r6, x); r7 = f(r7, x);
+        }
+        std::uint64_t end = bench_ticks();
+        bench_sink(r0); bench_sink(r1); bench_sink(r2); bench_sink(r3);
+        bench_sink(r4); bench_sink(r5); bench_sink(r6); bench_sink(r7);
+        best = std::min(best, end - start);
+    }
+    return double(best) / (opts.iterations * 8);
+}
+
+template<bool Unary, class V, class F>
+void bench_op(BenchResults& br, const BenchOptions& opts, const char* name,
+              F f, const V& a, const V& b)
+{
+    double lat = bench_latency<Unary>(opts, f, a, b);
+    double thr = bench_throughput<Unary>(opts, f, a, b);
+    br.add(name, bench_type_name<V>(), lat, thr);
+}
+
+/*  Measures the time of F which processes an array of @a size bytes and
+    returns a value that depends on the result. The latency column of the
+    result holds the time of a single invocation, the throughput column holds
+    the time per 64 bytes of input.
+*/
+template<class F>
+void bench_kernel(BenchResults& br, const BenchOptions& opts, const char* name,
+                  const std::string& type, std::size_t size, F f)
+{
+    std::uint64_t best = ~std::uint64_t(0);
+    std::size_t sink = 0;
+    for (unsigned rep = 0; rep < opts.repeats; ++rep) {
+        std::uint64_t start = bench_ticks();
+        for (unsigned i = 0; i < opts.iterations; ++i) {
+            sink += f();
+            bench_opaque_native(sink);
+        }
+        std::uint64_t end = bench_ticks();
+        best = std::min(best, end - start);
+    }
+    double per_call = double(best) / opts.iterations;
+    br.add(name, type, per_call, per_call * 64 / size);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+// Benchmarks OP(a)
+#define BENCH_OP1(BR, OPTS, V, OP, A)                                           \
+    bench_op<true>(BR, OPTS, #OP,                                               \
+                   [](const V& r, const V&) { return V(OP(r)); }, V(A), V(A))
+
+// Benchmarks OP(a, b). The result is passed as the first argument of the next
+// operation in the chain.
+#define BENCH_OP2(BR, OPTS, V, OP, A, B)                                        \
+    bench_op<false>(BR, OPTS, #OP,                                              \
+                    [](const V& r, const V& x) { return V(OP(r, x)); }, V(A), V(B))
+
+#endif
@@ -0,0 +1,98 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench_results.h"
+#include <iomanip>
+#include <ostream>
+
+namespace {
+
+void print_json_string(std::ostream& out, const std::string& str)
+{
+    out << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+const char* compiler_version()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__INTEL_COMPILER)
+    return "icc " __VERSION__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+} // namespace
+
+void print_bench_table(std::ostream& out, const BenchResults& results,
+                       const char* unit)
+{
+    out << "Architecture: " << results.arch_name() << "\n";
+    out << std::left << std::setw(20) << "operation"
+        << std::setw(14) << "type"
+        << std::right << std::setw(12) << "latency"
+        << std::setw(12) << "throughput" << "   (" << unit << ")\n";
+
+    out << std::fixed << std::setprecision(2);
+    for (const auto& r : results.results()) {
+        out << std::left << std::setw(20) << r.name
+            << std::setw(14) << r.type
+            << std::right << std::setw(12) << r.latency
+            << std::setw(12) << r.throughput << "\n";
+    }
+    out.unsetf(std::ios_base::floatfield);
+    out << "\n";
+}
+
+void print_bench_json(std::ostream& out,
+                      const std::vector<BenchResults>& results,
+                      const BenchOptions& options, const char* unit)
+{
+    out << "{\n";
+    out << "  \"compiler\": ";
+    print_json_string(out, compiler_version());
+    out << ",\n";
+    out << "  \"unit\": ";
+    print_json_string(out, unit);
+    out << ",\n";
+    out << "  \"iterations\": " << options.iterations << ",\n";
+    out << "  \"repeats\": " << options.repeats << ",\n";
+    out << "  \"archs\": [";
+
+    out << std::fixed << std::setprecision(3);
+    for (unsigned i = 0; i < results.size(); ++i) {
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\n      \"arch\": ";
+        print_json_string(out, results[i].arch_name());
+        out << ",\n      \"results\": [";
+
+        const auto& rs = results[i].results();
+        for (unsigned j = 0; j < rs.size(); ++j) {
+            out << (j == 0 ? "\n" : ",\n");
+            out << "        {\"name\": ";
+            print_json_string(out, rs[j].name);
+            out << ", \"type\": ";
+            print_json_string(out, rs[j].type);
+            out << ", \"latency\": " << rs[j].latency
+                << ", \"throughput\": " << rs[j].throughput << "}";
+        }
+        out << "\n      ]\n    }";
+    }
+    out.unsetf(std::ios_base::floatfield);
+    out << "\n  ]\n}\n";
+}
@@ -0,0 +1,69 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_RESULTS_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_RESULTS_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+struct BenchOptions {
+    // The number of loop iterations in a single measurement
+    unsigned iterations;
+    // The number of measurements. The smallest result is reported
+    unsigned repeats;
+
+    BenchOptions() : iterations(10000), repeats(5) {}
+};
+
+/** Holds the benchmark results for a particular architecture. Latency is the
+    time between the moment the operands are available and the moment the
+    result is available. Throughput is the reciprocal throughput: the average
+    time between the issue of two independent operations. Both are expressed
+    in the units of the timer, see bench_timer_unit().
+*/
+class BenchResults {
+public:
+    struct Result {
+        std::string name;
+        std::string type;
+        double latency;
+        double throughput;
+    };
+
+    BenchResults(const char* arch_name) : arch_name_(arch_name) {}
+
+    void add(const char* name, const std::string& type,
+             double latency, double throughput)
+    {
+        Result r;
+        r.name = name;
+        r.type = type;
+        r.latency = latency;
+        r.throughput = throughput;
+        results_.push_back(r);
+    }
+
+    const char* arch_name() const { return arch_name_; }
+    const std::vector<Result>& results() const { return results_; }
+
+private:
+    const char* arch_name_;
+    std::vector<Result> results_;
+};
+
+/// Prints the results of a single architecture as a human-readable table
+void print_bench_table(std::ostream& out, const BenchResults& results,
+                       const char* unit);
+
+/// Prints the results of all architectures as a JSON document
+void print_bench_json(std::ostream& out,
+                      const std::vector<BenchResults>& results,
+                      const BenchOptions& options, const char* unit);
+
+#endif
@@ -0,0 +1,52 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_TIMER_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_TIMER_H
+
+#include <simdpp/simd.h>
+#include <cstdint>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#define SIMDPP_BENCH_USE_RDTSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define SIMDPP_BENCH_USE_RDTSC 0
+#include <chrono>
+#endif
+
+/*  The time stamp counter is used on x86. Note that it counts reference
+    cycles which differ from the core cycles if the processor runs at a
+    frequency other than nominal. For stable results frequency scaling and
+    turbo modes should be disabled. On other architectures the results are
+    measured in nanoseconds.
+*/
+inline const char* bench_timer_unit()
+{
+    return SIMDPP_BENCH_USE_RDTSC ? "cycles" : "ns";
+}
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+inline std::uint64_t bench_ticks()
+{
+#if SIMDPP_BENCH_USE_RDTSC
+    return __rdtsc();
+#else
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(
+                steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+#endif
@@ -364,6 +364,52 @@ set(SIMDPP_X86_AVX2_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_F16C")
+if(SIMDPP_CLANG OR SIMDPP_GCC)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "-mavx -mf16c")
+elseif(SIMDPP_INTEL)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "-xCORE-AVX-I")
+elseif(SIMDPP_MSVC)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "/arch:AVX")
+elseif(SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "/arch:CORE-AVX-I")
+endif()
+set(SIMDPP_X86_F16C_DEFINE "SIMDPP_ARCH_X86_F16C")
+set(SIMDPP_X86_F16C_SUFFIX "-x86_f16c")
+set(SIMDPP_X86_F16C_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[32];
+            __m256 align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i one = _mm_load_si128((__m128i*)p);
+        __m256 f = _mm256_cvtph_ps(one);
+        one = _mm256_cvtps_ph(f, 0);
+        _mm_store_si128((__m128i*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "X86_FMA3")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_X86_FMA3_CXX_FLAGS "-mfma")
@@ -683,6 +729,86 @@ set(SIMDPP_X86_AVX512VL_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VNNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VNNI_CXX_FLAGS "-mavx512f -mavx512vnni")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VNNI_DEFINE "SIMDPP_ARCH_X86_AVX512VNNI")
+set(SIMDPP_X86_AVX512VNNI_SUFFIX "-x86_avx512vnni")
+set(SIMDPP_X86_AVX512VNNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512 align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_dpbusd_epi32(i, i, i); // only in AVX512-VNNI
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512CD")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512CD_CXX_FLAGS "-mavx512f -mavx512cd")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512CD_DEFINE "SIMDPP_ARCH_X86_AVX512CD")
+set(SIMDPP_X86_AVX512CD_SUFFIX "-x86_avx512cd")
+set(SIMDPP_X86_AVX512CD_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512 align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_lzcnt_epi32(i); // only in AVX512-CD
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "ARM_NEON")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_ARM_NEON_CXX_FLAGS "-mfpu=neon")
@@ -1033,8 +1159,9 @@ endfunction()
 #
 #   The following identifiers are currently supported:
 #   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1,
-#   X86_AVX, X86_AVX2, X86_FMA3, X86_FMA4,
-#   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_AVX512VL, X86_XOP,
+#   X86_AVX, X86_AVX2, X86_F16C, X86_FMA3, X86_FMA4,
+#   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_AVX512VL, X86_AVX512VNNI,
+#   X86_AVX512CD, X86_XOP,
 #   ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON,
 #   MIPS_MSA, POWER_ALTIVEC, POWER_VSX_206, POWER_VSX_207
 #
@@ -1164,6 +1291,10 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
         # thus separate X86_AVX2 config is not needed.
         if(DEFINED ARCH_SUPPORTED_X86_FMA3)
             list(APPEND ALL_ARCHS "X86_AVX2,X86_FMA3,X86_POPCNT_INSN")
+            if(DEFINED ARCH_SUPPORTED_X86_F16C)
+                # Likewise, all these CPUs support F16C
+                list(APPEND ALL_ARCHS "X86_AVX2,X86_FMA3,X86_POPCNT_INSN,X86_F16C")
+            endif()
         endif()
     endif()
     if(DEFINED ARCH_SUPPORTED_X86_FMA3)
@@ -1188,6 +1319,14 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
                     # All Intel processors that support AVX512BW also support
                     # AVX512DQ and AVX512VL
                     list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL")
+                    if(DEFINED ARCH_SUPPORTED_X86_AVX512CD)
+                        # Likewise, all these CPUs support AVX512CD
+                        list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_AVX512CD")
+                    endif()
+                    if(DEFINED ARCH_SUPPORTED_X86_AVX512VNNI)
+                        # Since Cascade Lake
+                        list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_AVX512VNNI")
+                    endif()
                 endif()
             endif()
         endif()
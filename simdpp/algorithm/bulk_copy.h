@@ -0,0 +1,47 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_BULK_COPY_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_BULK_COPY_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/algorithm/copy.h>
+#include <simdpp/detail/algorithm/bulk.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Copies @a size bytes from @a src to @a dst. The memory regions must not
+    overlap.
+
+    If the total amount of memory touched by the copy (twice @a size) exceeds
+    the non-temporal threshold, the data is copied using non-temporal loads
+    and stores so that the caches are not polluted, and the stores are fenced
+    before returning. The threshold is the size of the last level cache unless
+    @c SIMDPP_NONTEMPORAL_THRESHOLD is defined. Smaller copies use regular
+    vector loads and stores via @c copy().
+*/
+SIMDPP_INL void bulk_copy(void* dst, const void* src, std::size_t size)
+{
+    using namespace detail::algorithm;
+    if (size > nontemporal_threshold() / 2) {
+        bulk_copy_stream(dst, src, size);
+    } else {
+        const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+        copy(s, s + size, reinterpret_cast<uint8_t*>(dst));
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
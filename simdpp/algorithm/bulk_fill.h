@@ -0,0 +1,45 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_BULK_FILL_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_BULK_FILL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/algorithm/fill.h>
+#include <simdpp/detail/algorithm/bulk.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Sets @a size bytes starting at @a dst to @a value.
+
+    If @a size exceeds the non-temporal threshold, the memory is written using
+    non-temporal stores so that the caches are not polluted, and the stores
+    are fenced before returning. The threshold is the size of the last level
+    cache unless @c SIMDPP_NONTEMPORAL_THRESHOLD is defined. Smaller fills use
+    regular vector stores via @c fill().
+*/
+SIMDPP_INL void bulk_fill(void* dst, uint8_t value, std::size_t size)
+{
+    using namespace detail::algorithm;
+    if (size > nontemporal_threshold()) {
+        bulk_fill_stream(dst, value, size);
+    } else {
+        uint8_t* d = reinterpret_cast<uint8_t*>(dst);
+        fill(d, d + size, value);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
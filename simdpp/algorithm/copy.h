@@ -0,0 +1,77 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_COPY_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_COPY_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/store.h>
+#include <simdpp/detail/algorithm/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Copies the elements within [first, last) to the array starting at @a out.
+    The arrays must not overlap.
+
+    The destination is aligned first, the source is accessed using unaligned
+    loads. The elements before the first aligned vector and after the last
+    full vector are copied one by one.
+
+    Returns a pointer past the last copied element.
+*/
+template<class T> SIMDPP_INL
+T* copy(const T* first, const T* last, T* out)
+{
+    using namespace detail::algorithm;
+    using V = native_vec_t<T>;
+    const std::size_t L = V::length;
+    const std::size_t n = last - first;
+
+    std::size_t i = peel_count(out, n, sizeof(V));
+    for (std::size_t j = 0; j < i; ++j) {
+        out[j] = first[j];
+    }
+
+    for (; i + unroll*L <= n; i += unroll*L) {
+        V a0 = load_u(first + i);
+        V a1 = load_u(first + i + L);
+        V a2 = load_u(first + i + 2*L);
+        V a3 = load_u(first + i + 3*L);
+        store(out + i, a0);
+        store(out + i + L, a1);
+        store(out + i + 2*L, a2);
+        store(out + i + 3*L, a3);
+    }
+    for (; i + L <= n; i += L) {
+        V a = load_u(first + i);
+        store(out + i, a);
+    }
+    for (; i < n; ++i) {
+        out[i] = first[i];
+    }
+    return out + n;
+}
+
+/** Equivalent to <tt>copy(r.data(), r.data() + r.size(), out)</tt> for
+    contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class T> SIMDPP_INL
+T* copy(const Range& r, T* out)
+{
+    return copy(r.data(), r.data() + r.size(), out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
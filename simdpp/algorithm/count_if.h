@@ -0,0 +1,114 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_COUNT_IF_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_COUNT_IF_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/i_reduce_add.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load.h>
+#include <simdpp/detail/algorithm/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace algorithm {
+
+// Counts the set lanes among the first n lanes of m
+template<class U> SIMDPP_INL
+std::size_t count_partial(const U& m, std::size_t n)
+{
+    mem_block<U> b(m);
+    std::size_t r = 0;
+    for (unsigned i = 0; i < n; ++i) {
+        r += b[i] != 0 ? 1 : 0;
+    }
+    return r;
+}
+
+} // namespace algorithm
+} // namespace detail
+
+/** Returns the number of elements within [first, last) for which @a pred
+    returns true.
+
+    @a pred is invoked with vectors of the native length for @c T, e.g.
+    @c float32v for @c float, and must return a mask of the same length, e.g.
+    @c mask_float32v. The head and the tail of the array are passed to
+    @a pred as vectors whose unused elements have unspecified values.
+
+    The set lanes are counted in vector accumulators which are flushed before
+    they may overflow.
+*/
+template<class T, class P> SIMDPP_INL
+std::size_t count_if(const T* first, const T* last, P pred)
+{
+    using namespace detail::algorithm;
+    using V = native_vec_t<T>;
+    using U = typename V::uint_vector_type;
+    using UE = typename U::element_type;
+    const std::size_t L = V::length;
+    const std::size_t n = last - first;
+
+    // each iteration of the main loop increments the lanes by up to 4
+    const std::size_t max_iters = std::numeric_limits<UE>::max() / unroll;
+    std::size_t r = 0;
+
+    std::size_t i = peel_count(first, n, sizeof(V));
+    if (i > 0) {
+        r += count_partial(eval_pred(load_partial<V>(first, i, T()), pred), i);
+    }
+
+    while (i + unroll*L <= n) {
+        U acc = make_zero();
+        for (std::size_t it = 0; it < max_iters && i + unroll*L <= n;
+             ++it, i += unroll*L) {
+            V a0 = load(first + i);
+            V a1 = load(first + i + L);
+            V a2 = load(first + i + 2*L);
+            V a3 = load(first + i + 3*L);
+            // set lanes are equal to -1
+            U m0 = eval_pred(a0, pred);
+            U m1 = eval_pred(a1, pred);
+            U m2 = eval_pred(a2, pred);
+            U m3 = eval_pred(a3, pred);
+            m0 = add(m0, m1);
+            m2 = add(m2, m3);
+            acc = sub(acc, U(add(m0, m2)));
+        }
+        r += reduce_add(acc);
+    }
+    for (; i + L <= n; i += L) {
+        V a = load(first + i);
+        r += count_partial(eval_pred(a, pred), L);
+    }
+    if (i < n) {
+        V a = load_partial<V>(first + i, n - i, T());
+        r += count_partial(eval_pred(a, pred), n - i);
+    }
+    return r;
+}
+
+/** Equivalent to <tt>count_if(r.data(), r.data() + r.size(), pred)</tt> for
+    contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class P> SIMDPP_INL
+std::size_t count_if(const Range& r, P pred)
+{
+    return count_if(r.data(), r.data() + r.size(), pred);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
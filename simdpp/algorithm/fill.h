@@ -0,0 +1,69 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_FILL_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_FILL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/store.h>
+#include <simdpp/detail/algorithm/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Assigns @a value to all elements within [first, last).
+
+    The elements before the first aligned vector and after the last full
+    vector are assigned one by one.
+*/
+template<class T, class U> SIMDPP_INL
+void fill(T* first, T* last, const U& value)
+{
+    using namespace detail::algorithm;
+    using V = native_vec_t<T>;
+    const std::size_t L = V::length;
+    const std::size_t n = last - first;
+
+    T x = static_cast<T>(value);
+
+    std::size_t i = peel_count(first, n, sizeof(V));
+    for (std::size_t j = 0; j < i; ++j) {
+        first[j] = x;
+    }
+
+    V v = splat<V>(x);
+    for (; i + unroll*L <= n; i += unroll*L) {
+        store(first + i, v);
+        store(first + i + L, v);
+        store(first + i + 2*L, v);
+        store(first + i + 3*L, v);
+    }
+    for (; i + L <= n; i += L) {
+        store(first + i, v);
+    }
+    for (; i < n; ++i) {
+        first[i] = x;
+    }
+}
+
+/** Equivalent to <tt>fill(r.data(), r.data() + r.size(), value)</tt> for
+    contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class U> SIMDPP_INL
+void fill(Range& r, const U& value)
+{
+    fill(r.data(), r.data() + r.size(), value);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
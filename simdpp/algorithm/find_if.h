@@ -0,0 +1,116 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_FIND_IF_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_FIND_IF_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/detail/algorithm/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace algorithm {
+
+// Returns the index of the first set lane among the first n lanes of m or n
+template<class U> SIMDPP_INL
+std::size_t find_first_set(const U& m, std::size_t n)
+{
+    mem_block<U> b(m);
+    for (unsigned i = 0; i < n; ++i) {
+        if (b[i] != 0)
+            return i;
+    }
+    return n;
+}
+
+} // namespace algorithm
+} // namespace detail
+
+/** Returns a pointer to the first element within [first, last) for which
+    @a pred returns true, or @a last if there's no such element.
+
+    @a pred is invoked with vectors of the native length for @c T, e.g.
+    @c float32v for @c float, and must return a mask of the same length, e.g.
+    @c mask_float32v. The head and the tail of the array are passed to
+    @a pred as vectors whose unused elements have unspecified values.
+
+    The function may read elements past the found element up to the end of
+    the current block of four vectors.
+*/
+template<class T, class P> SIMDPP_INL
+T* find_if(T* first, T* last, P pred)
+{
+    using namespace detail::algorithm;
+    using E = typename std::remove_const<T>::type;
+    using V = native_vec_t<E>;
+    using U = typename V::uint_vector_type;
+    const std::size_t L = V::length;
+    const std::size_t n = last - first;
+
+    std::size_t i = peel_count(first, n, sizeof(V));
+    if (i > 0) {
+        U m = eval_pred(load_partial<V>(first, i, E()), pred);
+        std::size_t pos = find_first_set(m, i);
+        if (pos != i)
+            return first + pos;
+    }
+
+    for (; i + unroll*L <= n; i += unroll*L) {
+        V a0 = load(first + i);
+        V a1 = load(first + i + L);
+        V a2 = load(first + i + 2*L);
+        V a3 = load(first + i + 3*L);
+        U m0 = eval_pred(a0, pred);
+        U m1 = eval_pred(a1, pred);
+        U m2 = eval_pred(a2, pred);
+        U m3 = eval_pred(a3, pred);
+        U any = bit_or(bit_or(m0, m1), bit_or(m2, m3));
+        if (test_bits_any(any)) {
+            if (test_bits_any(m0))
+                return first + i + find_first_set(m0, L);
+            if (test_bits_any(m1))
+                return first + i + L + find_first_set(m1, L);
+            if (test_bits_any(m2))
+                return first + i + 2*L + find_first_set(m2, L);
+            return first + i + 3*L + find_first_set(m3, L);
+        }
+    }
+    for (; i + L <= n; i += L) {
+        V a = load(first + i);
+        U m = eval_pred(a, pred);
+        if (test_bits_any(m))
+            return first + i + find_first_set(m, L);
+    }
+    if (i < n) {
+        U m = eval_pred(load_partial<V>(first + i, n - i, E()), pred);
+        return first + i + find_first_set(m, n - i);
+    }
+    return last;
+}
+
+/** Equivalent to <tt>find_if(r.data(), r.data() + r.size(), pred)</tt> for
+    contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class P> SIMDPP_INL
+auto find_if(Range& r, P pred) -> decltype(r.data())
+{
+    return find_if(r.data(), r.data() + r.size(), pred);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
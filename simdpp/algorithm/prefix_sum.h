@@ -0,0 +1,173 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_PREFIX_SUM_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_PREFIX_SUM_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/prefix_sum.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/store.h>
+#include <simdpp/detail/algorithm/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace algorithm {
+
+// Broadcasts the last element of @a v to all elements
+template<class V> SIMDPP_INL
+V splat_last(const V& v)
+{
+    // splat is performed on the unsigned type as it's not available for
+    // signed integer vectors
+    using U = typename V::uint_vector_type;
+    U u = bit_cast<U>(v);
+    u = splat<V::length-1>(u);
+    return bit_cast<V>(u);
+}
+
+/*  Computes the prefix sums of the elements within [first, last) and stores
+    them to @a out. Each vector is scanned independently of the others; only
+    the addition of the carry, i.e. the last element of the previous result
+    broadcast to all elements, is serialized. The main body scans several
+    vectors at once so that the scans overlap with the carry chain.
+*/
+template<bool Exclusive, class T> SIMDPP_INL
+T* prefix_sum_impl(const T* first, const T* last, T* out)
+{
+    using V = native_vec_t<T>;
+    const std::size_t L = V::length;
+    const std::size_t n = last - first;
+
+    V carry = splat<V>(T());
+    V s[unroll];
+    V e[unroll];
+
+    std::size_t i = peel_count(out, n, sizeof(V));
+    if (i > 0) {
+        V a = load_partial<V>(first, i, T());
+        s[0] = add(prefix_sum(a), carry);
+        if (Exclusive) {
+            e[0] = add(exclusive_prefix_sum(a), carry);
+            store_partial(out, e[0], i);
+        } else {
+            store_partial(out, s[0], i);
+        }
+        // the padding is zero, thus the last element contains the total
+        carry = splat_last(s[0]);
+    }
+
+    for (; i + unroll*L <= n; i += unroll*L) {
+        for (unsigned j = 0; j < unroll; ++j) {
+            V a = load_u(first + i + j*L);
+            s[j] = prefix_sum(a);
+            if (Exclusive)
+                e[j] = exclusive_prefix_sum(a);
+        }
+        for (unsigned j = 0; j < unroll; ++j) {
+            if (Exclusive)
+                store(out + i + j*L, add(e[j], carry));
+            s[j] = add(s[j], carry);
+            if (!Exclusive)
+                store(out + i + j*L, s[j]);
+            carry = splat_last(s[j]);
+        }
+    }
+    for (; i + L <= n; i += L) {
+        V a = load_u(first + i);
+        if (Exclusive)
+            store(out + i, add(exclusive_prefix_sum(a), carry));
+        s[0] = add(prefix_sum(a), carry);
+        if (!Exclusive)
+            store(out + i, s[0]);
+        carry = splat_last(s[0]);
+    }
+    if (i < n) {
+        V a = load_partial<V>(first + i, n - i, T());
+        if (Exclusive) {
+            e[0] = add(exclusive_prefix_sum(a), carry);
+            store_partial(out + i, e[0], n - i);
+        } else {
+            s[0] = add(prefix_sum(a), carry);
+            store_partial(out + i, s[0], n - i);
+        }
+    }
+    return out + n;
+}
+
+} // namespace algorithm
+} // namespace detail
+
+/** Computes the inclusive prefix sums of the elements within [first, last)
+    and stores them to the array starting at @a out. The arrays may be the
+    same, otherwise they must not overlap. Integer sums wrap around on
+    overflow.
+
+    @code
+    out[0] = first[0]
+    out[1] = first[0] + first[1]
+    ...
+    out[N-1] = first[0] + first[1] + ... + first[N-1]
+    @endcode
+
+    Returns a pointer past the last stored element.
+*/
+template<class T> SIMDPP_INL
+T* prefix_sum(const T* first, const T* last, T* out)
+{
+    return detail::algorithm::prefix_sum_impl<false>(first, last, out);
+}
+
+/** Equivalent to <tt>prefix_sum(r.data(), r.data() + r.size(), out)</tt> for
+    contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class T> SIMDPP_INL
+T* prefix_sum(const Range& r, T* out)
+{
+    return prefix_sum(r.data(), r.data() + r.size(), out);
+}
+
+/** Computes the exclusive prefix sums of the elements within [first, last)
+    and stores them to the array starting at @a out. The arrays may be the
+    same, otherwise they must not overlap. Integer sums wrap around on
+    overflow.
+
+    @code
+    out[0] = 0
+    out[1] = first[0]
+    ...
+    out[N-1] = first[0] + first[1] + ... + first[N-2]
+    @endcode
+
+    Returns a pointer past the last stored element.
+*/
+template<class T> SIMDPP_INL
+T* exclusive_prefix_sum(const T* first, const T* last, T* out)
+{
+    return detail::algorithm::prefix_sum_impl<true>(first, last, out);
+}
+
+/** Equivalent to <tt>exclusive_prefix_sum(r.data(), r.data() + r.size(),
+    out)</tt> for contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class T> SIMDPP_INL
+T* exclusive_prefix_sum(const Range& r, T* out)
+{
+    return exclusive_prefix_sum(r.data(), r.data() + r.size(), out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
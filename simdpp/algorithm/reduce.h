@@ -0,0 +1,235 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_REDUCE_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_REDUCE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/detail/algorithm/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Combines the elements within [first, last) using @a op.
+
+    @a op is invoked with two vectors of the native length for @c T, e.g.
+    @c float32v for @c float, and must return a vector of the same type. The
+    operation must be associative and commutative, as the elements are
+    combined in unspecified order. @a identity must be the identity element of
+    @a op, e.g. 0 for addition or 1 for multiplication: it's used to pad the
+    partial vectors at the head and the tail of the array.
+
+    @code
+    r = identity
+    r = op(r, first[0])
+    ...
+    r = op(r, first[N-1])
+    @endcode
+
+    Four independent accumulators are used in the main loop, thus the results
+    of floating-point operations may differ slightly from a sequential
+    implementation.
+*/
+template<class T, class I, class Op> SIMDPP_INL
+T reduce(const T* first, const T* last, const I& identity_value, Op op)
+{
+    using namespace detail::algorithm;
+    using V = native_vec_t<T>;
+    const std::size_t L = V::length;
+    const std::size_t n = last - first;
+    const T identity = static_cast<T>(identity_value);
+
+    V acc0 = splat<V>(identity);
+    V acc1 = acc0, acc2 = acc0, acc3 = acc0;
+
+    std::size_t i = peel_count(first, n, sizeof(V));
+    if (i > 0) {
+        acc0 = op(acc0, load_partial<V>(first, i, identity));
+    }
+
+    for (; i + unroll*L <= n; i += unroll*L) {
+        V a0 = load(first + i);
+        V a1 = load(first + i + L);
+        V a2 = load(first + i + 2*L);
+        V a3 = load(first + i + 3*L);
+        acc0 = op(acc0, a0);
+        acc1 = op(acc1, a1);
+        acc2 = op(acc2, a2);
+        acc3 = op(acc3, a3);
+    }
+    for (; i + L <= n; i += L) {
+        V a = load(first + i);
+        acc0 = op(acc0, a);
+    }
+    if (i < n) {
+        acc1 = op(acc1, load_partial<V>(first + i, n - i, identity));
+    }
+
+    acc0 = op(acc0, acc1);
+    acc2 = op(acc2, acc3);
+    acc0 = op(acc0, acc2);
+    return reduce_lanes(acc0, op);
+}
+
+/** Equivalent to <tt>reduce(r.data(), r.data() + r.size(), identity, op)</tt>
+    for contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class I, class Op> SIMDPP_INL
+auto reduce(const Range& r, const I& identity, Op op)
+    -> typename std::remove_const<
+            typename std::remove_reference<decltype(*r.data())>::type>::type
+{
+    return reduce(r.data(), r.data() + r.size(), identity, op);
+}
+
+/** Applies @a transform_op to the elements within [first, last) and combines
+    the results using @a reduce_op.
+
+    @a transform_op is invoked with vectors of the native length for @c T and
+    must return a vector of the same length and element type @c R.
+    @a reduce_op is invoked with two vectors of that type. See @c reduce() for
+    the requirements on @a reduce_op and @a identity. @a transform_op may be
+    invoked with vectors whose unused elements have unspecified values, the
+    corresponding results are replaced by @a identity.
+
+    @code
+    r = identity
+    r = reduce_op(r, transform_op(first[0]))
+    ...
+    r = reduce_op(r, transform_op(first[N-1]))
+    @endcode
+*/
+template<class T, class R, class ROp, class TOp> SIMDPP_INL
+R transform_reduce(const T* first, const T* last, R identity,
+                   ROp reduce_op, TOp transform_op)
+{
+    using namespace detail::algorithm;
+    using V = native_vec_t<T>;
+    using A = vec_of_t<R, V::length>;
+    const std::size_t L = V::length;
+    const std::size_t n = last - first;
+
+    A acc0 = splat<A>(identity);
+    A acc1 = acc0, acc2 = acc0, acc3 = acc0;
+
+    std::size_t i = peel_count(first, n, sizeof(V));
+    if (i > 0) {
+        A t = transform_op(load_partial<V>(first, i, T()));
+        acc0 = reduce_op(acc0, pad_partial(t, i, identity));
+    }
+
+    for (; i + unroll*L <= n; i += unroll*L) {
+        V a0 = load(first + i);
+        V a1 = load(first + i + L);
+        V a2 = load(first + i + 2*L);
+        V a3 = load(first + i + 3*L);
+        acc0 = reduce_op(acc0, A(transform_op(a0)));
+        acc1 = reduce_op(acc1, A(transform_op(a1)));
+        acc2 = reduce_op(acc2, A(transform_op(a2)));
+        acc3 = reduce_op(acc3, A(transform_op(a3)));
+    }
+    for (; i + L <= n; i += L) {
+        V a = load(first + i);
+        acc0 = reduce_op(acc0, A(transform_op(a)));
+    }
+    if (i < n) {
+        A t = transform_op(load_partial<V>(first + i, n - i, T()));
+        acc1 = reduce_op(acc1, pad_partial(t, n - i, identity));
+    }
+
+    acc0 = reduce_op(acc0, acc1);
+    acc2 = reduce_op(acc2, acc3);
+    acc0 = reduce_op(acc0, acc2);
+    return reduce_lanes(acc0, reduce_op);
+}
+
+/** Applies @a transform_op to pairs of elements from [first1, last1) and the
+    array starting at @a first2 and combines the results using @a reduce_op.
+    For example, the dot product of two arrays can be computed as follows:
+
+    @code
+    float r = transform_reduce(a, a + n, b, 0.0f,
+                [](const float32v& x, const float32v& y) { return add(x, y); },
+                [](const float32v& x, const float32v& y) { return mul(x, y); });
+    @endcode
+
+    See the unary version for the requirements on the arguments.
+*/
+template<class T1, class T2, class R, class ROp, class TOp> SIMDPP_INL
+R transform_reduce(const T1* first1, const T1* last1, const T2* first2,
+                   R identity, ROp reduce_op, TOp transform_op)
+{
+    using namespace detail::algorithm;
+    using V1 = native_vec_t<T1>;
+    using V2 = vec_of_t<T2, V1::length>;
+    using A = vec_of_t<R, V1::length>;
+    const std::size_t L = V1::length;
+    const std::size_t n = last1 - first1;
+
+    A acc0 = splat<A>(identity);
+    A acc1 = acc0, acc2 = acc0, acc3 = acc0;
+
+    std::size_t i = peel_count(first1, n, sizeof(V1));
+    if (i > 0) {
+        A t = transform_op(load_partial<V1>(first1, i, T1()),
+                           load_partial<V2>(first2, i, T2()));
+        acc0 = reduce_op(acc0, pad_partial(t, i, identity));
+    }
+
+    for (; i + unroll*L <= n; i += unroll*L) {
+        V1 a0 = load(first1 + i);
+        V1 a1 = load(first1 + i + L);
+        V1 a2 = load(first1 + i + 2*L);
+        V1 a3 = load(first1 + i + 3*L);
+        V2 b0 = load_u(first2 + i);
+        V2 b1 = load_u(first2 + i + L);
+        V2 b2 = load_u(first2 + i + 2*L);
+        V2 b3 = load_u(first2 + i + 3*L);
+        acc0 = reduce_op(acc0, A(transform_op(a0, b0)));
+        acc1 = reduce_op(acc1, A(transform_op(a1, b1)));
+        acc2 = reduce_op(acc2, A(transform_op(a2, b2)));
+        acc3 = reduce_op(acc3, A(transform_op(a3, b3)));
+    }
+    for (; i + L <= n; i += L) {
+        V1 a = load(first1 + i);
+        V2 b = load_u(first2 + i);
+        acc0 = reduce_op(acc0, A(transform_op(a, b)));
+    }
+    if (i < n) {
+        A t = transform_op(load_partial<V1>(first1 + i, n - i, T1()),
+                           load_partial<V2>(first2 + i, n - i, T2()));
+        acc1 = reduce_op(acc1, pad_partial(t, n - i, identity));
+    }
+
+    acc0 = reduce_op(acc0, acc1);
+    acc2 = reduce_op(acc2, acc3);
+    acc0 = reduce_op(acc0, acc2);
+    return reduce_lanes(acc0, reduce_op);
+}
+
+/** Equivalent to
+    <tt>transform_reduce(r.data(), r.data() + r.size(), identity, reduce_op, transform_op)</tt>
+    for contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class R, class ROp, class TOp> SIMDPP_INL
+R transform_reduce(const Range& r, R identity, ROp reduce_op, TOp transform_op)
+{
+    return transform_reduce(r.data(), r.data() + r.size(), identity,
+                            reduce_op, transform_op);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
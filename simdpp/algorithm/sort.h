@@ -0,0 +1,86 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_SORT_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_SORT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/algorithm/sort.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Sorts the elements of a vector in ascending order using a bitonic sorting
+    network.
+
+    @code
+    r = sorted(a0, a1, ..., aN)
+    @endcode
+
+    Vectors of 32-bit and 64-bit elements are supported. 64-bit integer
+    vectors are supported only where their min() and max() are, i.e. on AVX2,
+    NEON64, VSX_207 and MSA. The order of NaN values is unspecified.
+*/
+template<class V> SIMDPP_INL
+V sort_vector(const V& a)
+{
+    return detail::algorithm::sort_network(a);
+}
+
+/** Merges two vectors whose elements are sorted in ascending order. The
+    lower half of the merged sequence is stored to @a a and the upper half
+    to @a b.
+
+    @code
+    a, b = sorted(a0, ..., aN, b0, ..., bN)
+    @endcode
+
+    The same element types as in sort_vector() are supported.
+*/
+template<class V> SIMDPP_INL
+void bitonic_merge(V& a, V& b)
+{
+    detail::algorithm::sort_merge_network(a, b);
+}
+
+/** Sorts the elements within [first, last) in ascending order.
+
+    The arrays are partitioned using vectorized quicksort which packs the
+    elements of each side of the pivot using compress(). The parts that are
+    small enough are sorted using sorting networks of up to 8 native vectors.
+    The sort falls back to std::sort if the recursion becomes too deep.
+
+    The element type must be one of @c int32_t, @c uint32_t, @c int64_t,
+    @c uint64_t, @c float or @c double. The arrays are sorted using std::sort
+    on architectures where the vectorized sort is slower or not available:
+    without SSSE3 on x86 and, for 64-bit elements, on x86 without AVX512F. The sort is not stable. NaN values are moved to
+    the end of the array, after all other values.
+*/
+template<class T> SIMDPP_INL
+void sort(T* first, T* last)
+{
+    using namespace detail::algorithm;
+    sort_array(first, last - first, sort_traits<T>());
+}
+
+/** Equivalent to <tt>sort(r.data(), r.data() + r.size())</tt> for contiguous
+    ranges such as @c std::vector or @c std::array.
+*/
+template<class Range> SIMDPP_INL
+void sort(Range& r)
+{
+    sort(r.data(), r.data() + r.size());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
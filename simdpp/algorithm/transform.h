@@ -0,0 +1,159 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_TRANSFORM_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_TRANSFORM_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/store.h>
+#include <simdpp/detail/algorithm/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Applies @a f to the elements within [first, last) and stores the results
+    to the array starting at @a out.
+
+    @a f is invoked with vectors of the native length for @c T, e.g.
+    @c float32v for @c float, and must return a vector of the same length and
+    element type @c U. The head and the tail of the array are passed to @a f
+    as vectors whose unused elements have unspecified values, thus @a f must
+    not have side effects.
+
+    @code
+    out[0] = f(first[0])
+    ...
+    out[N-1] = f(first[N-1])
+    @endcode
+
+    Returns a pointer past the last stored element.
+*/
+template<class T, class U, class F> SIMDPP_INL
+U* transform(const T* first, const T* last, U* out, F f)
+{
+    using namespace detail::algorithm;
+    using V = native_vec_t<T>;
+    using R = vec_of_t<U, V::length>;
+    const std::size_t L = V::length;
+    const std::size_t n = last - first;
+
+    // aligning the output is more important than aligning the input
+    std::size_t i = peel_count(out, n, vec_alignment<R>());
+    if (i > 0) {
+        R r = f(load_partial<V>(first, i, T()));
+        store_partial(out, r, i);
+    }
+
+    for (; i + unroll*L <= n; i += unroll*L) {
+        V a0 = load_u(first + i);
+        V a1 = load_u(first + i + L);
+        V a2 = load_u(first + i + 2*L);
+        V a3 = load_u(first + i + 3*L);
+        R r0 = f(a0);
+        R r1 = f(a1);
+        R r2 = f(a2);
+        R r3 = f(a3);
+        store(out + i, r0);
+        store(out + i + L, r1);
+        store(out + i + 2*L, r2);
+        store(out + i + 3*L, r3);
+    }
+    for (; i + L <= n; i += L) {
+        V a = load_u(first + i);
+        R r = f(a);
+        store(out + i, r);
+    }
+    if (i < n) {
+        R r = f(load_partial<V>(first + i, n - i, T()));
+        store_partial(out + i, r, n - i);
+    }
+    return out + n;
+}
+
+/** Applies @a f to pairs of elements from [first1, last1) and the array
+    starting at @a first2 and stores the results to the array starting at
+    @a out.
+
+    @a f is invoked with two vectors of the native length for @c T1 and must
+    return a vector of the same length and element type @c U. See the unary
+    version for the handling of the head and the tail.
+
+    @code
+    out[0] = f(first1[0], first2[0])
+    ...
+    out[N-1] = f(first1[N-1], first2[N-1])
+    @endcode
+
+    Returns a pointer past the last stored element.
+*/
+template<class T1, class T2, class U, class F> SIMDPP_INL
+U* transform(const T1* first1, const T1* last1, const T2* first2, U* out, F f)
+{
+    using namespace detail::algorithm;
+    using V1 = native_vec_t<T1>;
+    using V2 = vec_of_t<T2, V1::length>;
+    using R = vec_of_t<U, V1::length>;
+    const std::size_t L = V1::length;
+    const std::size_t n = last1 - first1;
+
+    std::size_t i = peel_count(out, n, vec_alignment<R>());
+    if (i > 0) {
+        R r = f(load_partial<V1>(first1, i, T1()),
+                load_partial<V2>(first2, i, T2()));
+        store_partial(out, r, i);
+    }
+
+    for (; i + unroll*L <= n; i += unroll*L) {
+        V1 a0 = load_u(first1 + i);
+        V1 a1 = load_u(first1 + i + L);
+        V1 a2 = load_u(first1 + i + 2*L);
+        V1 a3 = load_u(first1 + i + 3*L);
+        V2 b0 = load_u(first2 + i);
+        V2 b1 = load_u(first2 + i + L);
+        V2 b2 = load_u(first2 + i + 2*L);
+        V2 b3 = load_u(first2 + i + 3*L);
+        R r0 = f(a0, b0);
+        R r1 = f(a1, b1);
+        R r2 = f(a2, b2);
+        R r3 = f(a3, b3);
+        store(out + i, r0);
+        store(out + i + L, r1);
+        store(out + i + 2*L, r2);
+        store(out + i + 3*L, r3);
+    }
+    for (; i + L <= n; i += L) {
+        V1 a = load_u(first1 + i);
+        V2 b = load_u(first2 + i);
+        R r = f(a, b);
+        store(out + i, r);
+    }
+    if (i < n) {
+        R r = f(load_partial<V1>(first1 + i, n - i, T1()),
+                load_partial<V2>(first2 + i, n - i, T2()));
+        store_partial(out + i, r, n - i);
+    }
+    return out + n;
+}
+
+/** Equivalent to <tt>transform(r.data(), r.data() + r.size(), out, f)</tt>
+    for contiguous ranges such as @c std::vector or @c std::array.
+*/
+template<class Range, class U, class F> SIMDPP_INL
+U* transform(const Range& r, U* out, F f)
+{
+    return transform(r.data(), r.data() + r.size(), out, f);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
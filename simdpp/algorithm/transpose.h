@@ -0,0 +1,63 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_TRANSPOSE_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_TRANSPOSE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/detail/algorithm/bulk.h>
+#include <simdpp/detail/algorithm/transpose.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Transposes the matrix of @a rows rows and @a cols columns at @a src into
+    @a dst, which receives @a cols rows of @a rows elements. The strides are
+    the distances between the starts of consecutive rows in elements. The
+    memory regions must not overlap. @a T may be any trivially copyable type
+    of 1, 2, 4 or 8 bytes.
+
+    The matrix is processed in cache-sized blocks which are transposed in
+    tiles held in vector registers. The edges that do not fill a whole tile
+    are handled by scalar code. If the total amount of memory touched exceeds
+    the non-temporal threshold (see @c bulk_copy()) and the destination rows
+    are aligned to the vector size, the destination is written using
+    non-temporal stores, which are fenced before returning.
+*/
+template<class T> SIMDPP_INL
+void transpose(const T* src, T* dst, std::size_t rows, std::size_t cols,
+               std::size_t src_stride, std::size_t dst_stride)
+{
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 ||
+                  sizeof(T) == 4 || sizeof(T) == 8,
+                  "The size of T must be 1, 2, 4 or 8 bytes");
+    using namespace detail::algorithm;
+    using U = typename transpose_vec<sizeof(T), 16>::type::element_type;
+    const U* s = reinterpret_cast<const U*>(src);
+    U* d = reinterpret_cast<U*>(dst);
+
+    const std::size_t B = uint32v::length_bytes;
+    std::size_t size = rows * cols * sizeof(T);
+    if (size > nontemporal_threshold() / 2 &&
+        reinterpret_cast<std::uintptr_t>(dst) % B == 0 &&
+        dst_stride * sizeof(T) % B == 0)
+    {
+        transpose_blocked<U, true>(s, d, rows, cols, src_stride, dst_stride);
+    } else {
+        transpose_blocked<U, false>(s, d, rows, cols, src_stride, dst_stride);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -115,4 +115,16 @@
 #define SIMDPP_HAS_UINT32_SHIFT_R_BY_VECTOR 0
 #endif
 
+// Variable rotates are emulated using the variable shifts where needed
+#define SIMDPP_HAS_INT8_ROTATE_BY_VECTOR (SIMDPP_HAS_UINT8_SHIFT_L_BY_VECTOR && SIMDPP_HAS_UINT8_SHIFT_R_BY_VECTOR)
+#define SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR (SIMDPP_HAS_UINT8_SHIFT_L_BY_VECTOR && SIMDPP_HAS_UINT8_SHIFT_R_BY_VECTOR)
+#define SIMDPP_HAS_INT16_ROTATE_BY_VECTOR (SIMDPP_HAS_UINT16_SHIFT_L_BY_VECTOR && SIMDPP_HAS_UINT16_SHIFT_R_BY_VECTOR)
+#define SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR (SIMDPP_HAS_UINT16_SHIFT_L_BY_VECTOR && SIMDPP_HAS_UINT16_SHIFT_R_BY_VECTOR)
+#define SIMDPP_HAS_INT32_ROTATE_BY_VECTOR (SIMDPP_HAS_UINT32_SHIFT_L_BY_VECTOR && SIMDPP_HAS_UINT32_SHIFT_R_BY_VECTOR)
+#define SIMDPP_HAS_UINT32_ROTATE_BY_VECTOR (SIMDPP_HAS_UINT32_SHIFT_L_BY_VECTOR && SIMDPP_HAS_UINT32_SHIFT_R_BY_VECTOR)
+
+// 64-bit variable rotates are emulated element by element where needed
+#define SIMDPP_HAS_INT64_ROTATE_BY_VECTOR 1
+#define SIMDPP_HAS_UINT64_ROTATE_BY_VECTOR 1
+
 #endif
@@ -0,0 +1,346 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CODEC_BASE64_H
+#define LIBSIMDPP_SIMDPP_CODEC_BASE64_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub_sat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/detail/string/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// The value returned by base64_decode() on invalid input
+static const std::size_t base64_error = ~std::size_t(0);
+
+namespace detail {
+namespace codec {
+
+using string::block_size;
+using string::block_vec;
+using string::block_mask;
+
+/*  The vectorized encoding and decoding follow the algorithms by Muła and
+    Lemire. Each 128-bit lane of a block is processed independently: 12 bytes
+    are encoded into 16 characters and 16 characters are decoded into 12
+    bytes. A block of 64 characters thus corresponds to 48 bytes.
+*/
+static const std::size_t base64_block_bytes = 48;
+
+static const char base64_chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+SIMDPP_INL char* base64_encode_scalar(const uint8_t* s, std::size_t n, char* d)
+{
+    for (; n >= 3; n -= 3, s += 3, d += 4) {
+        uint32_t x = uint32_t(s[0]) << 16 | uint32_t(s[1]) << 8 | s[2];
+        d[0] = base64_chars[x >> 18];
+        d[1] = base64_chars[x >> 12 & 0x3f];
+        d[2] = base64_chars[x >> 6 & 0x3f];
+        d[3] = base64_chars[x & 0x3f];
+    }
+    if (n > 0) {
+        uint32_t x = uint32_t(s[0]) << 16;
+        if (n == 2)
+            x |= uint32_t(s[1]) << 8;
+        d[0] = base64_chars[x >> 18];
+        d[1] = base64_chars[x >> 12 & 0x3f];
+        d[2] = n == 2 ? base64_chars[x >> 6 & 0x3f] : '=';
+        d[3] = '=';
+        d += 4;
+    }
+    return d;
+}
+
+// Returns the value of a base64 character or -1 if the character is invalid
+SIMDPP_INL int base64_value(char ch)
+{
+    uint8_t c = ch;
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+/*  Decodes a group of 4 characters at s into d and returns the number of
+    bytes written or -1 if the group is invalid. Only the last group may be
+    padded.
+*/
+SIMDPP_INL int base64_decode_group(const char* s, bool last, uint8_t* d)
+{
+    int a = base64_value(s[0]);
+    int b = base64_value(s[1]);
+    if ((a | b) < 0)
+        return -1;
+    if (last && s[3] == '=') {
+        // the unused bits of the last group must be zero
+        if (s[2] == '=') {
+            if (b & 0x0f)
+                return -1;
+            d[0] = uint8_t(a << 2 | b >> 4);
+            return 1;
+        }
+        int c = base64_value(s[2]);
+        if (c < 0 || (c & 0x03))
+            return -1;
+        d[0] = uint8_t(a << 2 | b >> 4);
+        d[1] = uint8_t(b << 4 | c >> 2);
+        return 2;
+    }
+    int c = base64_value(s[2]);
+    int e = base64_value(s[3]);
+    if ((c | e) < 0)
+        return -1;
+    uint32_t x = uint32_t(a) << 18 | uint32_t(b) << 12 | uint32_t(c) << 6 | e;
+    d[0] = uint8_t(x >> 16);
+    d[1] = uint8_t(x >> 8);
+    d[2] = uint8_t(x);
+    return 3;
+}
+
+/*  Decodes the last n characters of the input. n must be a multiple of 4.
+    Returns nullptr on invalid input.
+*/
+SIMDPP_INL uint8_t* base64_decode_scalar(const char* s, std::size_t n,
+                                         uint8_t* d)
+{
+    for (; n > 0; n -= 4, s += 4) {
+        int r = base64_decode_group(s, n == 4, d);
+        if (r < 0)
+            return nullptr;
+        d += r;
+    }
+    return d;
+}
+
+/*  Encodes 48 bytes at s into 64 characters. 52 bytes at s must be
+    accessible.
+*/
+SIMDPP_INL block_vec base64_encode_block(const uint8_t* s)
+{
+    uint8<16> l0 = load_u(s);
+    uint8<16> l1 = load_u(s + 12);
+    uint8<16> l2 = load_u(s + 24);
+    uint8<16> l3 = load_u(s + 36);
+    block_vec v = combine(combine(l0, l1), combine(l2, l3));
+
+    // bytes [b0 b1 b2] of each group are arranged as [b1 b0 b2 b1]
+    v = permute_bytes16(v, (block_vec) make_uint(1, 0, 2, 1, 4, 3, 5, 4,
+                                                 7, 6, 8, 7, 10, 9, 11, 10));
+
+    // move each of the 6-bit values to a separate byte
+    using u16 = uint16<block_size/2>;
+    u16 w = u16(v);
+    u16 t0 = mul_hi(bit_and(w, (u16) make_uint(0xfc00, 0x0fc0)),
+                    (u16) make_uint(0x0040, 0x0400));
+    u16 t1 = mul_lo(bit_and(w, (u16) make_uint(0x03f0, 0x003f)),
+                    (u16) make_uint(0x0010, 0x0100));
+    block_vec idx = block_vec(bit_or(t0, t1));
+
+    /*  Each range of values that maps to a contiguous range of characters is
+        reduced to a separate index into a table of offsets: 0..25 to 13,
+        26..51 to 0, 52..61 to 1..10, 62 to 11 and 63 to 12.
+    */
+    block_vec r = sub_sat(idx, 51);
+    r = blend((block_vec) make_uint(13), r, cmp_lt(idx, 26));
+    block_vec offsets = make_uint('a' - 26, '0' - 52, '0' - 52, '0' - 52,
+                                  '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                  '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                  '/' - 63, 'A', 0, 0);
+    return add(permute_bytes16(offsets, r), idx);
+}
+
+/*  Decodes 64 characters at s into 48 bytes at d. 52 bytes at d are
+    overwritten. Returns nonzero bytes where the characters are invalid.
+*/
+SIMDPP_INL block_vec base64_decode_block(const uint8_t* s, uint8_t* d)
+{
+    block_vec v = load_u(s);
+    block_vec hi = string::high_nibbles(v);
+    block_vec lo = string::low_nibbles(v);
+
+    /*  The bit (h % 8) of the element l of the first table is set if the
+        character (h << 4 | l) is valid. The second table maps h to the same
+        bit, characters with the highest bit set map to zero.
+    */
+    block_vec valid_lo = make_uint(0xa8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+                                   0xf8, 0xf8, 0xf8, 0xf0, 0x54, 0x50, 0x50,
+                                   0x50, 0x54);
+    block_vec valid_hi = make_uint(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40,
+                                   0x80, 0, 0, 0, 0, 0, 0, 0, 0);
+    block_vec valid = bit_and(permute_bytes16(valid_lo, lo),
+                              permute_bytes16(valid_hi, hi));
+    block_mask invalid = cmp_eq(valid, (block_vec) make_zero());
+
+    // the characters are mapped to values by adding an offset selected by h
+    block_vec offsets = make_uint(0, 0, 62 - '+', 52 - '0', -'A', -'A',
+                                  26 - 'a', 26 - 'a', 0, 0, 0, 0, 0, 0, 0, 0);
+    block_vec offset = blend((block_vec) make_uint(63 - '/'),
+                             permute_bytes16(offsets, hi), cmp_eq(v, '/'));
+    block_vec val = add(v, offset);
+
+    // merge [a b c d] into (a << 18 | b << 12 | c << 6 | d) within 32 bits
+    uint16<block_size/2> x = uint16<block_size/2>(val);
+    x = bit_or(shift_l<6>(bit_and(x, 0x003f)), shift_r<8>(x));
+    uint32<block_size/4> y = uint32<block_size/4>(x);
+    y = bit_or(shift_l<12>(bit_and(y, 0xffff)), shift_r<16>(y));
+
+    // the three bytes of each group are stored in big endian order
+    block_vec order = make_uint(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                0, 0, 0, 0);
+    block_vec r = permute_bytes16((block_vec) y, order);
+    uint8<block_size/2> h0, h1;
+    uint8<16> q0, q1, q2, q3;
+    split(r, h0, h1);
+    split(h0, q0, q1);
+    split(h1, q2, q3);
+    store_u(d, q0);
+    store_u(d + 12, q1);
+    store_u(d + 24, q2);
+    store_u(d + 36, q3);
+    return invalid.unmask();
+}
+
+} // namespace codec
+} // namespace detail
+
+/// Returns the number of characters produced by base64_encode() for @a n bytes
+SIMDPP_INL std::size_t base64_encoded_size(std::size_t n)
+{
+    return (n + 2) / 3 * 4;
+}
+
+/** Returns the maximum number of bytes produced by base64_decode() for @a n
+    characters.
+*/
+SIMDPP_INL std::size_t base64_decoded_size(std::size_t n)
+{
+    return n / 4 * 3;
+}
+
+/** Encodes the first @a n bytes of @a src using the standard base64 alphabet
+    as defined by RFC 4648 and returns the number of characters written to
+    @a dst. The output is padded with @c = characters and is not null
+    terminated. @a dst must have space for base64_encoded_size(n)
+    characters.
+
+    The bulk of the input is encoded in blocks of 48 bytes using byte
+    shuffles. On SSE2 and SSE3, which lack byte shuffles, and where vector
+    instructions are not available, scalar code is used.
+*/
+SIMDPP_INL std::size_t base64_encode(const void* src, std::size_t n, char* dst)
+{
+    using namespace detail::codec;
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+    char* d = dst;
+#if !SIMDPP_USE_NULL && !(SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    // up to 4 bytes past the end of each group of 48 bytes are read
+    for (; n >= block_size; n -= base64_block_bytes) {
+        store_u(d, base64_encode_block(s));
+        s += base64_block_bytes;
+        d += block_size;
+    }
+#endif
+    return base64_encode_scalar(s, n, d) - dst;
+}
+
+/** Decodes the first @a n characters of base64 at @a src and returns the
+    number of bytes written to @a dst. The decoding is strict: @a n must be
+    a multiple of 4, only the standard alphabet is accepted, whitespace is
+    not skipped, up to two @c = padding characters may appear only at the
+    end and the unused bits of the last group must be zero. On invalid input
+    @c base64_error is returned and the contents of @a dst are unspecified.
+
+    @a dst must have space for base64_decoded_size(n) bytes.
+
+    The bulk of the input is decoded in blocks of 64 characters using byte
+    shuffles. On SSE2 and SSE3, which lack byte shuffles, and where vector
+    instructions are not available, scalar code is used.
+*/
+SIMDPP_INL std::size_t base64_decode(const char* src, std::size_t n, void* dst)
+{
+    using namespace detail::codec;
+    if (n % 4 != 0)
+        return base64_error;
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+    uint8_t* d = reinterpret_cast<uint8_t*>(dst);
+#if !SIMDPP_USE_NULL && !(SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    /*  Each block writes 4 bytes past its output. At least 8 characters are
+        left for the scalar code so that these bytes are overwritten later
+        and the padding is always handled by the scalar code.
+    */
+    block_vec error = make_zero();
+    for (; n >= block_size + 8; n -= block_size) {
+        error = bit_or(error, base64_decode_block(s, d));
+        s += block_size;
+        d += base64_block_bytes;
+    }
+    if (test_bits_any(error))
+        return base64_error;
+#endif
+    d = base64_decode_scalar(reinterpret_cast<const char*>(s), n, d);
+    if (d == nullptr)
+        return base64_error;
+    return d - reinterpret_cast<uint8_t*>(dst);
+}
+
+/** Returns @c true if the first @a n characters of @a src are valid base64
+    according to the rules described in base64_decode().
+*/
+SIMDPP_INL bool base64_validate(const char* src, std::size_t n)
+{
+    using namespace detail::codec;
+    if (n % 4 != 0)
+        return false;
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+    SIMDPP_ALIGN(16) uint8_t buf[block_size];
+#if !SIMDPP_USE_NULL && !(SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    block_vec error = make_zero();
+    for (; n >= block_size + 8; n -= block_size) {
+        error = bit_or(error, base64_decode_block(s, buf));
+        s += block_size;
+    }
+    if (test_bits_any(error))
+        return false;
+#endif
+    for (; n > 0; n -= 4, s += 4) {
+        if (base64_decode_group(reinterpret_cast<const char*>(s), n == 4,
+                                buf) < 0)
+            return false;
+    }
+    return true;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
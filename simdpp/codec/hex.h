@@ -0,0 +1,222 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CODEC_HEX_H
+#define LIBSIMDPP_SIMDPP_CODEC_HEX_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_not.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/core/to_int8.h>
+#include <simdpp/core/zip_hi.h>
+#include <simdpp/core/zip_lo.h>
+#include <simdpp/detail/string/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// The value returned by hex_decode() on invalid input
+static const std::size_t hex_error = ~std::size_t(0);
+
+namespace detail {
+namespace codec {
+
+using string::block_size;
+using string::block_vec;
+using string::block_mask;
+
+/*  The digits are converted arithmetically instead of using lookup tables,
+    thus the same code is used on all instruction sets.
+*/
+SIMDPP_INL block_vec hex_digits(const block_vec& n)
+{
+    return add(n, blend((block_vec) make_uint('a' - 10),
+                        (block_vec) make_uint('0'), cmp_gt(n, 9)));
+}
+
+// Encodes 64 bytes at s into 128 characters at d
+SIMDPP_INL void hex_encode_block(const uint8_t* s, char* d)
+{
+    block_vec v = load_u(s);
+    block_vec hi = hex_digits(string::high_nibbles(v));
+    block_vec lo = hex_digits(string::low_nibbles(v));
+
+    // the digits are interleaved within 128-bit lanes, thus the lanes are
+    // handled one by one
+    uint8<block_size/2> h0, h1, l0, l1;
+    uint8<16> h[4], l[4];
+    split(hi, h0, h1);
+    split(lo, l0, l1);
+    split(h0, h[0], h[1]);
+    split(h1, h[2], h[3]);
+    split(l0, l[0], l[1]);
+    split(l1, l[2], l[3]);
+    for (unsigned i = 0; i < 4; ++i) {
+        store_u(d + 32 * i, zip16_lo(h[i], l[i]));
+        store_u(d + 32 * i + 16, zip16_hi(h[i], l[i]));
+    }
+}
+
+/*  Decodes 64 characters at s into 32 bytes at d. Returns nonzero bytes where
+    the characters are invalid.
+*/
+SIMDPP_INL block_vec hex_decode_block(const uint8_t* s, uint8_t* d)
+{
+    block_vec v = load_u(s);
+    block_vec digit = sub(v, '0');
+    // setting the bit 5 converts upper case letters to lower case
+    block_vec alpha = sub(bit_or(v, 0x20), 'a');
+    block_mask is_digit = cmp_lt(digit, 10);
+    block_mask is_alpha = cmp_lt(alpha, 6);
+    block_vec val = blend(digit, add(alpha, 10), is_digit);
+    block_mask valid = bit_or(is_digit, is_alpha);
+
+    // each pair of digits is merged into the low byte of a 16-bit element
+    uint16<block_size/2> x = uint16<block_size/2>(val);
+    x = bit_or(shift_l<4>(bit_and(x, 0x0f)), shift_r<8>(x));
+    store_u(d, to_uint8(x));
+    return bit_not(valid.unmask());
+}
+
+// Returns the value of a hex digit or -1 if the character is invalid
+SIMDPP_INL int hex_value(char ch)
+{
+    uint8_t c = ch;
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+SIMDPP_INL char* hex_encode_scalar(const uint8_t* s, std::size_t n, char* d)
+{
+    const char* digits = "0123456789abcdef";
+    for (; n > 0; --n, ++s, d += 2) {
+        d[0] = digits[*s >> 4];
+        d[1] = digits[*s & 0x0f];
+    }
+    return d;
+}
+
+// Returns nullptr on invalid input. n must be even
+SIMDPP_INL uint8_t* hex_decode_scalar(const char* s, std::size_t n,
+                                      uint8_t* d)
+{
+    for (; n > 0; n -= 2, s += 2) {
+        int h = hex_value(s[0]);
+        int l = hex_value(s[1]);
+        if ((h | l) < 0)
+            return nullptr;
+        *d++ = uint8_t(h << 4 | l);
+    }
+    return d;
+}
+
+} // namespace codec
+} // namespace detail
+
+/** Encodes the first @a n bytes of @a src as lower case hexadecimal digits
+    and returns the number of characters written to @a dst, which is
+    <tt>2 * n</tt>. The output is not null terminated.
+
+    The digits are computed arithmetically in blocks of 64 bytes, thus the
+    same code is used on all instruction sets. Scalar code is used where
+    vector instructions are not available.
+*/
+SIMDPP_INL std::size_t hex_encode(const void* src, std::size_t n, char* dst)
+{
+    using namespace detail::codec;
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+    char* d = dst;
+#if !SIMDPP_USE_NULL
+    for (; n >= block_size; n -= block_size) {
+        hex_encode_block(s, d);
+        s += block_size;
+        d += 2 * block_size;
+    }
+#endif
+    return hex_encode_scalar(s, n, d) - dst;
+}
+
+/** Decodes the first @a n hexadecimal digits at @a src and returns the
+    number of bytes written to @a dst, which is <tt>n / 2</tt>. Both upper
+    and lower case digits are accepted. If @a n is odd or any of the
+    characters is not a hexadecimal digit, @c hex_error is returned and the
+    contents of @a dst are unspecified.
+*/
+SIMDPP_INL std::size_t hex_decode(const char* src, std::size_t n, void* dst)
+{
+    using namespace detail::codec;
+    if (n % 2 != 0)
+        return hex_error;
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+    uint8_t* d = reinterpret_cast<uint8_t*>(dst);
+#if !SIMDPP_USE_NULL
+    block_vec error = make_zero();
+    for (; n >= block_size; n -= block_size) {
+        error = bit_or(error, hex_decode_block(s, d));
+        s += block_size;
+        d += block_size / 2;
+    }
+    if (test_bits_any(error))
+        return hex_error;
+#endif
+    d = hex_decode_scalar(reinterpret_cast<const char*>(s), n, d);
+    if (d == nullptr)
+        return hex_error;
+    return d - reinterpret_cast<uint8_t*>(dst);
+}
+
+/** Returns @c true if the first @a n characters at @a src are valid input for
+    hex_decode().
+*/
+SIMDPP_INL bool hex_validate(const char* src, std::size_t n)
+{
+    using namespace detail::codec;
+    if (n % 2 != 0)
+        return false;
+    const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+#if !SIMDPP_USE_NULL
+    SIMDPP_ALIGN(16) uint8_t buf[block_size / 2];
+    block_vec error = make_zero();
+    for (; n >= block_size; n -= block_size) {
+        error = bit_or(error, hex_decode_block(s, buf));
+        s += block_size;
+    }
+    if (test_bits_any(error))
+        return false;
+#endif
+    for (; n > 0; n--, s++) {
+        if (hex_value(*s) < 0)
+            return false;
+    }
+    return true;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,154 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/compress.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Packs the elements of @a a that are selected by @a mask to the beginning of
+    the vector, preserving their order. The remaining elements are set to
+    zero.
+
+    @code
+    j = 0
+    for i in [0..N-1]:
+        if mask[i]: rj = ai; j++
+    for i in [j..N-1]:
+        ri = 0
+    @endcode
+
+    Only vectors with 32-bit and 64-bit elements are supported.
+
+    @par 128-bit version:
+    @icost{AVX512VL, 1}
+    @icost{SSSE3-AVX2, NEON, ALTIVEC, MSA, 3-4}
+    Uses a lookup table of byte shuffle masks on SSSE3, NEON, ALTIVEC and MSA.
+    Emulated element by element on SSE2.
+
+    @par 256-bit version:
+    @icost{AVX512VL, 1}
+    @icost{AVX2, 6-7}
+    Uses a lookup table of lane permutations on AVX2.
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+*/
+template<unsigned N, class M, class E> SIMDPP_INL
+int32<N,expr_empty> compress(const mask_int32<N,M>& mask, const int32<N,E>& a)
+{
+    return detail::insn::i_compress(mask.eval(), uint32<N>(a.eval()));
+}
+
+template<unsigned N, class M, class E> SIMDPP_INL
+uint32<N,expr_empty> compress(const mask_int32<N,M>& mask, const uint32<N,E>& a)
+{
+    return detail::insn::i_compress(mask.eval(), a.eval());
+}
+
+template<unsigned N, class M, class E> SIMDPP_INL
+float32<N,expr_empty> compress(const mask_float32<N,M>& mask, const float32<N,E>& a)
+{
+    uint32<N> r = detail::insn::i_compress(bit_cast<mask_int32<N>>(mask.eval()),
+                                           bit_cast<uint32<N>>(a.eval()));
+    return bit_cast<float32<N>>(r);
+}
+
+template<unsigned N, class M, class E> SIMDPP_INL
+int64<N,expr_empty> compress(const mask_int64<N,M>& mask, const int64<N,E>& a)
+{
+    return detail::insn::i_compress(mask.eval(), uint64<N>(a.eval()));
+}
+
+template<unsigned N, class M, class E> SIMDPP_INL
+uint64<N,expr_empty> compress(const mask_int64<N,M>& mask, const uint64<N,E>& a)
+{
+    return detail::insn::i_compress(mask.eval(), a.eval());
+}
+
+template<unsigned N, class M, class E> SIMDPP_INL
+float64<N,expr_empty> compress(const mask_float64<N,M>& mask, const float64<N,E>& a)
+{
+    uint64<N> r = detail::insn::i_compress(bit_cast<mask_int64<N>>(mask.eval()),
+                                           bit_cast<uint64<N>>(a.eval()));
+    return bit_cast<float64<N>>(r);
+}
+
+/** Stores the elements of @a a that are selected by @a mask contiguously to
+    memory, preserving their order. Exactly as many elements as there are
+    selected lanes in @a mask are written; memory past them is not accessed.
+    Returns the number of stored elements.
+
+    The pointer does not need to be aligned.
+
+    @code
+    j = 0
+    for i in [0..N-1]:
+        if mask[i]: p[j] = ai; j++
+    return j
+    @endcode
+
+    Only vectors with 32-bit and 64-bit elements are supported. Uses the
+    native compressing store on AVX-512F (AVX512VL for 128 and 256-bit
+    vectors). On other architectures the data is compressed as in compress()
+    and then copied to the destination.
+*/
+template<class T, unsigned N, class M, class E> SIMDPP_INL
+unsigned compress_store_u(T* p, const mask_int32<N,M>& mask, const int32<N,E>& a)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            mask.eval(), uint32<N>(a.eval()));
+}
+
+template<class T, unsigned N, class M, class E> SIMDPP_INL
+unsigned compress_store_u(T* p, const mask_int32<N,M>& mask, const uint32<N,E>& a)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            mask.eval(), a.eval());
+}
+
+template<class T, unsigned N, class M, class E> SIMDPP_INL
+unsigned compress_store_u(T* p, const mask_float32<N,M>& mask, const float32<N,E>& a)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            bit_cast<mask_int32<N>>(mask.eval()), bit_cast<uint32<N>>(a.eval()));
+}
+
+template<class T, unsigned N, class M, class E> SIMDPP_INL
+unsigned compress_store_u(T* p, const mask_int64<N,M>& mask, const int64<N,E>& a)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            mask.eval(), uint64<N>(a.eval()));
+}
+
+template<class T, unsigned N, class M, class E> SIMDPP_INL
+unsigned compress_store_u(T* p, const mask_int64<N,M>& mask, const uint64<N,E>& a)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            mask.eval(), a.eval());
+}
+
+template<class T, unsigned N, class M, class E> SIMDPP_INL
+unsigned compress_store_u(T* p, const mask_float64<N,M>& mask, const float64<N,E>& a)
+{
+    return detail::insn::i_compress_store_u(reinterpret_cast<char*>(p),
+                                            bit_cast<mask_int64<N>>(mask.eval()), bit_cast<uint64<N>>(a.eval()));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,153 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+#define LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace simdpp {
+
+namespace detail {
+
+/*  Computes floor((hi * 2^B + lo) / d) where B is the number of bits in U.
+    hi must be less than d so that the quotient fits into U.
+*/
+template<class U>
+U divider_div_wide(U hi, U lo, U d)
+{
+    const unsigned B = std::numeric_limits<U>::digits;
+    U q = 0;
+    U r = hi;
+    for (unsigned i = B; i > 0; --i) {
+        bool carry = (r >> (B - 1)) != 0;
+        r = U((r << 1) | ((lo >> (i - 1)) & 1));
+        q = U(q << 1);
+        if (carry || r >= d) {
+            r = U(r - d);
+            q = U(q | 1);
+        }
+    }
+    return q;
+}
+
+// Returns ceil(log2(d)) for d > 0
+template<class U>
+unsigned divider_log2_ceil(U d)
+{
+    unsigned l = 0;
+    while (l < unsigned(std::numeric_limits<U>::digits) && (U(1) << l) < d)
+        ++l;
+    return l;
+}
+
+} // namespace detail
+
+/** Holds the precomputed constants that are needed to divide integer vectors
+    by a divisor that is known only at runtime, but is reused many times. The
+    division is then performed by @c div() using one high-half multiplication,
+    an addition or subtraction and a few shifts instead of an actual division.
+
+    @a T must be one of @c int8_t, @c uint8_t, @c int16_t, @c uint16_t,
+    @c int32_t, @c uint32_t, @c int64_t or @c uint64_t. The divisor must not be
+    zero.
+
+    The object does not depend on the instruction set, thus it can be created
+    once and passed to functions that are selected by the dispatcher.
+
+    The constants are computed as described in T. Granlund, P. L. Montgomery,
+    "Division by Invariant Integers using Multiplication", 1994.
+*/
+template<class T>
+class divider {
+public:
+    static_assert(std::is_integral<T>::value && sizeof(T) <= 8 &&
+                  !std::is_same<T, bool>::value,
+                  "T must be an 8, 16, 32 or 64-bit integer type");
+
+    using element_type = T;
+
+    divider() : divider(1) {}
+
+    explicit divider(T d)
+    {
+        init(d, std::integral_constant<bool, std::is_signed<T>::value>());
+    }
+
+    /// Returns the divisor
+    T divisor() const { return divisor_; }
+
+    /// Returns the multiplier whose high half product is used as an estimate
+    T magic() const { return magic_; }
+
+    /** Returns the first shift amount. Only used for unsigned types; the
+        value is 0 or 1.
+    */
+    unsigned shift1() const { return shift1_; }
+
+    /// Returns the final shift amount
+    unsigned shift2() const { return shift2_; }
+
+    /** Returns all ones if the divisor is negative, zero otherwise. Only used
+        for signed types.
+    */
+    T sign() const { return sign_; }
+
+private:
+    using U = typename std::make_unsigned<T>::type;
+
+    void init(T d, std::false_type /* unsigned */)
+    {
+        // q = (t + ((n - t) >> s1)) >> s2, where t = mul_hi(m, n)
+        unsigned l = detail::divider_log2_ceil<U>(d);
+        U lpow = l < unsigned(std::numeric_limits<U>::digits) ? U(U(1) << l)
+                                                              : U(0);
+        divisor_ = d;
+        magic_ = U(detail::divider_div_wide<U>(U(lpow - d), 0, d) + 1);
+        shift1_ = l < 1 ? l : 1;
+        shift2_ = l < 1 ? 0 : l - 1;
+        sign_ = 0;
+    }
+
+    void init(T d, std::true_type /* signed */)
+    {
+        // q = (((n + mul_hi(m, n)) >> s2) - (n >> (B-1)) ^ sign) - sign
+        U ad = d < 0 ? U(U(0) - U(d)) : U(d);
+        unsigned l = detail::divider_log2_ceil<U>(ad);
+        if (l < 1)
+            l = 1;
+
+        divisor_ = d;
+        if (ad == 1) {
+            // 2^B + 1 does not fit into U; the lower half is what is needed
+            magic_ = 1;
+        } else {
+            // m = 1 + floor(2^(B+l-1) / |d|) - 2^B
+            U m = detail::divider_div_wide<U>(U(U(1) << (l - 1)), 0, ad);
+            magic_ = T(U(m + 1));
+        }
+        shift1_ = 0;
+        shift2_ = l - 1;
+        sign_ = d < 0 ? T(-1) : T(0);
+    }
+
+    T divisor_;
+    T magic_;
+    T sign_;
+    uint8_t shift1_;
+    uint8_t shift2_;
+};
+
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,91 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_GATHER_H
+#define LIBSIMDPP_SIMDPP_CORE_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/gather.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads elements from memory locations identified by a vector of indices.
+    The type of the returned vector is determined by the type of @a base:
+    @c int32_t, @c uint32_t, @c int64_t, @c uint64_t, @c float and @c double
+    produce @c int32, @c uint32, @c int64, @c uint64, @c float32 and
+    @c float64 vectors respectively.
+
+    @code
+    r0 = base[idx0]
+    ...
+    rN = base[idxN]
+    @endcode
+
+    The indices are in units of elements, not bytes. They are interpreted as
+    signed 32-bit values, thus must not exceed 2^31-1.
+
+    @a base must have the alignment of the element type.
+
+    @par 32-bit elements:
+    Uses native gather instructions on AVX2 and AVX-512F. Emulated element by
+    element on other architectures.
+
+    @par 64-bit elements:
+    Uses native gather instructions on AVX2 and AVX-512F. Emulated element by
+    element on other architectures.
+*/
+template<class T, unsigned N, class V> SIMDPP_INL
+typename detail::gather_vector_type<T,N>::type
+        gather(const T* base, const any_int32<N,V>& idx)
+{
+    using R = typename detail::gather_vector_type<T,N>::type;
+    typename detail::remove_sign<R>::type r;
+    uint32<N> ri;
+    ri = idx.wrapped().eval();
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base), ri);
+    return R(r);
+}
+
+/** Loads elements from memory locations identified by a vector of indices,
+    only for the elements that are selected by @a mask. The elements that are
+    not selected are set to zero and their memory locations are not accessed.
+
+    @code
+    r0 = mask0 ? base[idx0] : 0
+    ...
+    rN = maskN ? base[idxN] : 0
+    @endcode
+
+    The mask must be of the mask type corresponding to the returned vector,
+    e.g. @c mask_int32 for @c int32_t or @c uint32_t elements and
+    @c mask_float64 for @c double elements.
+
+    See gather() for the remaining requirements.
+*/
+template<class T, unsigned N, class V> SIMDPP_INL
+typename detail::gather_vector_type<T,N>::type
+        gather_masked(const T* base, const any_int32<N,V>& idx,
+                      const typename detail::gather_vector_type<T,N>::type::mask_vector_type& mask)
+{
+    using R = typename detail::gather_vector_type<T,N>::type;
+    typename detail::remove_sign<R>::type r;
+    uint32<N> ri;
+    ri = idx.wrapped().eval();
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base), ri,
+                                  mask);
+    return R(r);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
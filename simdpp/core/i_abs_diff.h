@@ -0,0 +1,169 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_ABS_DIFF_H
+#define LIBSIMDPP_SIMDPP_CORE_I_ABS_DIFF_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_abs_diff.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the absolute difference of 8-bit integer values. Unlike
+    abs(sub(a, b)), the result does not overflow: it is returned as an
+    unsigned value of the same width.
+
+    @code
+    r0 = |a0 - b0|
+    ...
+    rN = |aN - bN|
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, ALTIVEC, 3}
+    @icost{NEON, MSA, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, ALTIVEC, 6}
+    @icost{AVX2, 3}
+    @icost{NEON, MSA, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint8<N> abs_diff(const uint8<N,E1>& a, const uint8<N,E2>& b)
+{
+    return detail::insn::i_abs_diff(a.eval(), b.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint8<N> abs_diff(const int8<N,E1>& a, const int8<N,E2>& b)
+{
+    return detail::insn::i_abs_diff(a.eval(), b.eval());
+}
+
+/** Computes the absolute difference of 16-bit integer values. Unlike
+    abs(sub(a, b)), the result does not overflow: it is returned as an
+    unsigned value of the same width.
+
+    @code
+    r0 = |a0 - b0|
+    ...
+    rN = |aN - bN|
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, ALTIVEC, 3}
+    @icost{NEON, MSA, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, ALTIVEC, 6}
+    @icost{AVX2, 3}
+    @icost{NEON, MSA, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint16<N> abs_diff(const uint16<N,E1>& a, const uint16<N,E2>& b)
+{
+    return detail::insn::i_abs_diff(a.eval(), b.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint16<N> abs_diff(const int16<N,E1>& a, const int16<N,E2>& b)
+{
+    return detail::insn::i_abs_diff(a.eval(), b.eval());
+}
+
+/** Computes the absolute difference of 32-bit integer values. Unlike
+    abs(sub(a, b)), the result does not overflow: it is returned as an
+    unsigned value of the same width.
+
+    @code
+    r0 = |a0 - b0|
+    ...
+    rN = |aN - bN|
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE4.1-AVX2, ALTIVEC, 3}
+    @icost{NEON, MSA, 1}
+
+    @par 256-bit version:
+    @icost{SSE4.1-AVX, ALTIVEC, 6}
+    @icost{AVX2, 3}
+    @icost{NEON, MSA, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N> abs_diff(const uint32<N,E1>& a, const uint32<N,E2>& b)
+{
+    return detail::insn::i_abs_diff(a.eval(), b.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N> abs_diff(const int32<N,E1>& a, const int32<N,E2>& b)
+{
+    return detail::insn::i_abs_diff(a.eval(), b.eval());
+}
+
+/** Computes the absolute difference of 64-bit integer values. Unlike
+    abs(sub(a, b)), the result does not overflow: it is returned as an
+    unsigned value of the same width.
+
+    @code
+    r0 = |a0 - b0|
+    ...
+    rN = |aN - bN|
+    @endcode
+
+    @par 128-bit version:
+    @icost{AVX512VL, 3}
+    @icost{MSA, 1}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N> abs_diff(const uint64<N,E1>& a, const uint64<N,E2>& b)
+{
+    return detail::insn::i_abs_diff(a.eval(), b.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N> abs_diff(const int64<N,E1>& a, const int64<N,E2>& b)
+{
+    return detail::insn::i_abs_diff(a.eval(), b.eval());
+}
+
+/** Computes the absolute differences of unsigned 8-bit values and sums each
+    group of 8 adjacent differences into a 64-bit value.
+
+    @code
+    r0 = |a0 - b0| + |a1 - b1| + ... + |a7 - b7|
+    ...
+    rN = |a(8N) - b(8N)| + ... + |a(8N+7) - b(8N+7)|
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, 1}
+    @icost{NEON, 4}
+    @icost{ALTIVEC, MSA, 9-12}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 2}
+    @icost{AVX2, 1}
+    @icost{NEON, 8}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N/8> sad_u8(const uint8<N,E1>& a, const uint8<N,E2>& b)
+{
+    return detail::insn::i_sad_u8(a.eval(), b.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,126 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_BIT_REVERSE_H
+#define LIBSIMDPP_SIMDPP_CORE_I_BIT_REVERSE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_bit_reverse.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Reverses the order of bits in each element.
+
+    @code
+    r0 = bit_reverse(a0)
+    r1 = bit_reverse(a1)
+    ...
+    rN = bit_reverse(aN)
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> bit_reverse(const int8<N,E>& a)
+{
+    return detail::insn::i_bit_reverse(uint8<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> bit_reverse(const uint8<N,E>& a)
+{
+    return detail::insn::i_bit_reverse(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> bit_reverse(const int16<N,E>& a)
+{
+    return detail::insn::i_bit_reverse(uint16<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> bit_reverse(const uint16<N,E>& a)
+{
+    return detail::insn::i_bit_reverse(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> bit_reverse(const int32<N,E>& a)
+{
+    return detail::insn::i_bit_reverse(uint32<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> bit_reverse(const uint32<N,E>& a)
+{
+    return detail::insn::i_bit_reverse(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> bit_reverse(const int64<N,E>& a)
+{
+    return detail::insn::i_bit_reverse(uint64<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> bit_reverse(const uint64<N,E>& a)
+{
+    return detail::insn::i_bit_reverse(a.eval());
+}
+
+/** Reverses the order of bytes in each element.
+
+    @code
+    r0 = byte_swap(a0)
+    r1 = byte_swap(a1)
+    ...
+    rN = byte_swap(aN)
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> byte_swap(const int16<N,E>& a)
+{
+    return detail::insn::i_byte_swap(uint16<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> byte_swap(const uint16<N,E>& a)
+{
+    return detail::insn::i_byte_swap(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> byte_swap(const int32<N,E>& a)
+{
+    return detail::insn::i_byte_swap(uint32<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> byte_swap(const uint32<N,E>& a)
+{
+    return detail::insn::i_byte_swap(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> byte_swap(const int64<N,E>& a)
+{
+    return detail::insn::i_byte_swap(uint64<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> byte_swap(const uint64<N,E>& a)
+{
+    return detail::insn::i_byte_swap(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,199 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+#define LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/detail/insn/i_div.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Divides unsigned 8-bit values by a divisor that has been prepared in
+    advance.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is performed as a multiplication by a precomputed constant,
+    see @c divider.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512BW, ALTIVEC, 17}
+    @icost{NEON, 8}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> div(const uint8<N,E>& a, const divider<uint8_t>& d)
+{
+    return detail::insn::i_div_unsigned(a.eval(), d);
+}
+
+/** Divides signed 8-bit values by a divisor that has been prepared in
+    advance. The quotient is rounded towards zero.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is performed as a multiplication by a precomputed constant,
+    see @c divider.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512BW, ALTIVEC, 21}
+    @icost{NEON, 10}
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> div(const int8<N,E>& a, const divider<int8_t>& d)
+{
+    return detail::insn::i_div_signed(a.eval(), d);
+}
+
+/** Divides unsigned 16-bit values by a divisor that has been prepared in
+    advance.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is performed as a multiplication by a precomputed constant,
+    see @c divider.
+
+    @par 128-bit version:
+    @icost{ALL, 6}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> div(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_div_unsigned(a.eval(), d);
+}
+
+/** Divides signed 16-bit values by a divisor that has been prepared in
+    advance. The quotient is rounded towards zero.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is performed as a multiplication by a precomputed constant,
+    see @c divider.
+
+    @par 128-bit version:
+    @icost{ALL, 8}
+*/
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> div(const int16<N,E>& a, const divider<int16_t>& d)
+{
+    return detail::insn::i_div_signed(a.eval(), d);
+}
+
+/** Divides unsigned 32-bit values by a divisor that has been prepared in
+    advance.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is performed as a multiplication by a precomputed constant,
+    see @c divider.
+
+    @par 128-bit version:
+    @icost{SSE4.1-AVX512F, 11}
+    @icost{NEON, 8}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> div(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_div_unsigned(a.eval(), d);
+}
+
+/** Divides signed 32-bit values by a divisor that has been prepared in
+    advance. The quotient is rounded towards zero.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is performed as a multiplication by a precomputed constant,
+    see @c divider.
+
+    @par 128-bit version:
+    @icost{SSE4.1-AVX512F, 13}
+    @icost{NEON, 10}
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> div(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_div_signed(a.eval(), d);
+}
+
+/** Divides unsigned 64-bit values by a divisor that has been prepared in
+    advance.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is performed as a multiplication by a precomputed constant,
+    see @c divider.
+
+    @par 128-bit version:
+    @icost{AVX512DQ with AVX512VL, 20}
+    @icost{SSE2-AVX512F, NEON, 21}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> div(const uint64<N,E>& a, const divider<uint64_t>& d)
+{
+    return detail::insn::i_div_unsigned(a.eval(), d);
+}
+
+/** Divides signed 64-bit values by a divisor that has been prepared in
+    advance. The quotient is rounded towards zero.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is performed as a multiplication by a precomputed constant,
+    see @c divider.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, NEON, 30}
+*/
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> div(const int64<N,E>& a, const divider<int64_t>& d)
+{
+    return detail::insn::i_div_signed(a.eval(), d);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,80 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_DOT_ACC_H
+#define LIBSIMDPP_SIMDPP_CORE_I_DOT_ACC_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_dot_acc.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Multiplies signed 16-bit values, sums the adjacent pairs of the 32-bit
+    products and adds the sums to the 32-bit accumulator. The accumulation
+    wraps around on overflow.
+
+    @code
+    r0 = acc0 + a0 * b0 + a1 * b1
+    r1 = acc1 + a2 * b2 + a3 * b3
+    ...
+    rN = accN + a(2N) * b(2N) + a(2N+1) * b(2N+1)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, NEON, 2-3}
+    @icost{AVX512VNNI with AVX512VL, ALTIVEC, MSA, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, 4-6}
+    @icost{AVX2, 2}
+    @icost{AVX512VNNI with AVX512VL, 1}
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int32<N> dot_acc_i16(const int32<N,E1>& acc, const int16<N*2,E2>& a,
+                     const int16<N*2,E3>& b)
+{
+    return detail::insn::i_dot_acc_i16(acc.eval(), a.eval(), b.eval());
+}
+
+/** Multiplies unsigned 8-bit values in @a a with the corresponding signed
+    8-bit values in @a b, sums each group of 4 adjacent products and adds the
+    sums to the 32-bit accumulator. The intermediate sums are not saturated and
+    the accumulation wraps around on overflow.
+
+    @code
+    r0 = acc0 + a0 * b0 + a1 * b1 + a2 * b2 + a3 * b3
+    ...
+    rN = accN + a(4N) * b(4N) + ... + a(4N+3) * b(4N+3)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, 8-9}
+    @icost{NEON, 8}
+    @icost{AVX512VNNI with AVX512VL, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, 16-18}
+    @icost{AVX2, 8-9}
+    @icost{AVX512VNNI with AVX512VL, 1}
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int32<N> dot_acc_u8s8(const int32<N,E1>& acc, const uint8<N*4,E2>& a,
+                      const int8<N*4,E3>& b)
+{
+    return detail::insn::i_dot_acc_u8s8(acc.eval(), a.eval(), b.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,140 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_LZCNT_H
+#define LIBSIMDPP_SIMDPP_CORE_I_LZCNT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_lzcnt.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Counts the number of leading zero bits in each element. The result is
+    equal to the number of bits in the element if the element is zero.
+
+    @code
+    r0 = lzcnt(a0)
+    r1 = lzcnt(a1)
+    ...
+    rN = lzcnt(aN)
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> lzcnt(const int8<N,E>& a)
+{
+    return detail::insn::i_lzcnt(uint8<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> lzcnt(const uint8<N,E>& a)
+{
+    return detail::insn::i_lzcnt(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> lzcnt(const int16<N,E>& a)
+{
+    return detail::insn::i_lzcnt(uint16<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> lzcnt(const uint16<N,E>& a)
+{
+    return detail::insn::i_lzcnt(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> lzcnt(const int32<N,E>& a)
+{
+    return detail::insn::i_lzcnt(uint32<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> lzcnt(const uint32<N,E>& a)
+{
+    return detail::insn::i_lzcnt(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> lzcnt(const int64<N,E>& a)
+{
+    return detail::insn::i_lzcnt(uint64<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> lzcnt(const uint64<N,E>& a)
+{
+    return detail::insn::i_lzcnt(a.eval());
+}
+
+/** Counts the number of trailing zero bits in each element. The result is
+    equal to the number of bits in the element if the element is zero.
+
+    @code
+    r0 = tzcnt(a0)
+    r1 = tzcnt(a1)
+    ...
+    rN = tzcnt(aN)
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> tzcnt(const int8<N,E>& a)
+{
+    return detail::insn::i_tzcnt(uint8<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> tzcnt(const uint8<N,E>& a)
+{
+    return detail::insn::i_tzcnt(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> tzcnt(const int16<N,E>& a)
+{
+    return detail::insn::i_tzcnt(uint16<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> tzcnt(const uint16<N,E>& a)
+{
+    return detail::insn::i_tzcnt(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> tzcnt(const int32<N,E>& a)
+{
+    return detail::insn::i_tzcnt(uint32<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> tzcnt(const uint32<N,E>& a)
+{
+    return detail::insn::i_tzcnt(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> tzcnt(const int64<N,E>& a)
+{
+    return detail::insn::i_tzcnt(uint64<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> tzcnt(const uint64<N,E>& a)
+{
+    return detail::insn::i_tzcnt(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -21,7 +21,75 @@
 namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
 
-// no 8 bit multiplications in SSE
+/** Multiplies 8-bit values and returns the lower part of the multiplication
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512BW, ALTIVEC, 7}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, ALTIVEC, 14}
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
+        mul_lo(const any_int8<N,V1>& a,
+               const any_int8<N,V2>& b)
+{
+    return { { a.wrapped(), b.wrapped() } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int8, int8)
+
+/** Multiplies signed 8-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512BW, ALTIVEC, 11}
+    @icost{NEON, 3}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int8<N, expr_mul_hi<int8<N,E1>,
+                    int8<N,E2>>> mul_hi(const int8<N,E1>& a,
+                                        const int8<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, int8, int8)
+
+/** Multiplies unsigned 8-bit values and returns the higher half of the
+    result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512BW, ALTIVEC, 9}
+    @icost{NEON, 3}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint8<N, expr_mul_hi<uint8<N,E1>,
+                     uint8<N,E2>>> mul_hi(const uint8<N,E1>& a,
+                                          const uint8<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, uint8, uint8)
+
 /** Multiplies 16-bit values and returns the lower part of the multiplication
 
     @code
@@ -121,6 +189,122 @@ typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
 
 SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int32, int32)
 
+/** Multiplies signed 32-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE4.1-AVX512F, 6}
+    @icost{SSE2-SSSE3, 12}
+    @icost{NEON, 3}
+    @icost{ALTIVEC, MSA, 4 (scalar multiplications)}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N, expr_mul_hi<int32<N,E1>,
+                     int32<N,E2>>> mul_hi(const int32<N,E1>& a,
+                                          const int32<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, int32, int32)
+
+/** Multiplies unsigned 32-bit values and returns the higher half of the
+    result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, 6}
+    @icost{NEON, 3}
+    @icost{ALTIVEC, MSA, 4 (scalar multiplications)}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N, expr_mul_hi<uint32<N,E1>,
+                      uint32<N,E2>>> mul_hi(const uint32<N,E1>& a,
+                                            const uint32<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, uint32, uint32)
+
+/** Multiplies 64-bit values and returns the lower half of the result.
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{AVX512DQ with AVX512VL, 1}
+    @icost{SSE2-AVX512F, NEON, 8}
+    @icost{ALTIVEC, 2 (scalar multiplications)}
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
+        mul_lo(const any_int64<N,V1>& a,
+               const any_int64<N,V2>& b)
+{
+    return { { a.wrapped(), b.wrapped() } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int64, int64)
+
+/** Multiplies signed 64-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, NEON, 22}
+    @icost{ALTIVEC, MSA, 2 (scalar multiplications)}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N, expr_mul_hi<int64<N,E1>,
+                     int64<N,E2>>> mul_hi(const int64<N,E1>& a,
+                                          const int64<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, int64, int64)
+
+/** Multiplies unsigned 64-bit values and returns the higher half of the
+    result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, NEON, 16}
+    @icost{ALTIVEC, MSA, 2 (scalar multiplications)}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N, expr_mul_hi<uint64<N,E1>,
+                      uint64<N,E2>>> mul_hi(const uint64<N,E1>& a,
+                                            const uint64<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, uint64, uint64)
+
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
@@ -0,0 +1,374 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_ROTATE_H
+#define LIBSIMDPP_SIMDPP_CORE_I_ROTATE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/capabilities.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/insn/i_rotate.h>
+#include <simdpp/detail/not_implemented.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// -----------------------------------------------------------------------------
+// rotate by compile-time constant
+
+/** Rotates the bits of each element left by @a count bits.
+
+    @code
+    r0 = (a0 << count) | (a0 >> (W - count))
+    ...
+    rN = (aN << count) | (aN >> (W - count))
+    @endcode
+
+    Here W is the number of bits in the element.
+*/
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> rotl(const int8<N,E>& a)
+{
+    static_assert(count < 8, "Rotate out of bounds");
+    return detail::insn::i_rotl<count>(uint8<N>(a.eval()));
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> rotl(const uint8<N,E>& a)
+{
+    static_assert(count < 8, "Rotate out of bounds");
+    return detail::insn::i_rotl<count>(a.eval());
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> rotl(const int16<N,E>& a)
+{
+    static_assert(count < 16, "Rotate out of bounds");
+    return detail::insn::i_rotl<count>(uint16<N>(a.eval()));
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> rotl(const uint16<N,E>& a)
+{
+    static_assert(count < 16, "Rotate out of bounds");
+    return detail::insn::i_rotl<count>(a.eval());
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> rotl(const int32<N,E>& a)
+{
+    static_assert(count < 32, "Rotate out of bounds");
+    return detail::insn::i_rotl<count>(uint32<N>(a.eval()));
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> rotl(const uint32<N,E>& a)
+{
+    static_assert(count < 32, "Rotate out of bounds");
+    return detail::insn::i_rotl<count>(a.eval());
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> rotl(const int64<N,E>& a)
+{
+    static_assert(count < 64, "Rotate out of bounds");
+    return detail::insn::i_rotl<count>(uint64<N>(a.eval()));
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> rotl(const uint64<N,E>& a)
+{
+    static_assert(count < 64, "Rotate out of bounds");
+    return detail::insn::i_rotl<count>(a.eval());
+}
+
+/** Rotates the bits of each element right by @a count bits.
+
+    @code
+    r0 = (a0 >> count) | (a0 << (W - count))
+    ...
+    rN = (aN >> count) | (aN << (W - count))
+    @endcode
+
+    Here W is the number of bits in the element.
+*/
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> rotr(const int8<N,E>& a)
+{
+    static_assert(count < 8, "Rotate out of bounds");
+    return detail::insn::i_rotl<(8 - count) % 8>(uint8<N>(a.eval()));
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> rotr(const uint8<N,E>& a)
+{
+    static_assert(count < 8, "Rotate out of bounds");
+    return detail::insn::i_rotl<(8 - count) % 8>(a.eval());
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> rotr(const int16<N,E>& a)
+{
+    static_assert(count < 16, "Rotate out of bounds");
+    return detail::insn::i_rotl<(16 - count) % 16>(uint16<N>(a.eval()));
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> rotr(const uint16<N,E>& a)
+{
+    static_assert(count < 16, "Rotate out of bounds");
+    return detail::insn::i_rotl<(16 - count) % 16>(a.eval());
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> rotr(const int32<N,E>& a)
+{
+    static_assert(count < 32, "Rotate out of bounds");
+    return detail::insn::i_rotl<(32 - count) % 32>(uint32<N>(a.eval()));
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> rotr(const uint32<N,E>& a)
+{
+    static_assert(count < 32, "Rotate out of bounds");
+    return detail::insn::i_rotl<(32 - count) % 32>(a.eval());
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> rotr(const int64<N,E>& a)
+{
+    static_assert(count < 64, "Rotate out of bounds");
+    return detail::insn::i_rotl<(64 - count) % 64>(uint64<N>(a.eval()));
+}
+
+template<unsigned count, unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> rotr(const uint64<N,E>& a)
+{
+    static_assert(count < 64, "Rotate out of bounds");
+    return detail::insn::i_rotl<(64 - count) % 64>(a.eval());
+}
+
+// -----------------------------------------------------------------------------
+// rotate by vector
+
+/** Rotates the bits of each element left by the number of bits in the
+    corresponding element of the count vector. The counts are taken modulo
+    the number of bits in the element.
+
+    @code
+    r0 = rotl(a0, count0 % W)
+    ...
+    rN = rotl(aN, countN % W)
+    @endcode
+
+    Here W is the number of bits in the element.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int8<N,expr_empty> rotl(const int8<N,E1>& a, const uint8<N,E2>& count)
+{
+#if SIMDPP_HAS_INT8_ROTATE_BY_VECTOR
+    return detail::insn::i_rotl_v(uint8<N>(a.eval()), count.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint8<N,expr_empty> rotl(const uint8<N,E1>& a, const uint8<N,E2>& count)
+{
+#if SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR
+    return detail::insn::i_rotl_v(a.eval(), count.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int16<N,expr_empty> rotl(const int16<N,E1>& a, const uint16<N,E2>& count)
+{
+#if SIMDPP_HAS_INT16_ROTATE_BY_VECTOR
+    return detail::insn::i_rotl_v(uint16<N>(a.eval()), count.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint16<N,expr_empty> rotl(const uint16<N,E1>& a, const uint16<N,E2>& count)
+{
+#if SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR
+    return detail::insn::i_rotl_v(a.eval(), count.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N,expr_empty> rotl(const int32<N,E1>& a, const uint32<N,E2>& count)
+{
+#if SIMDPP_HAS_INT32_ROTATE_BY_VECTOR
+    return detail::insn::i_rotl_v(uint32<N>(a.eval()), count.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N,expr_empty> rotl(const uint32<N,E1>& a, const uint32<N,E2>& count)
+{
+#if SIMDPP_HAS_UINT32_ROTATE_BY_VECTOR
+    return detail::insn::i_rotl_v(a.eval(), count.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N,expr_empty> rotl(const int64<N,E1>& a, const uint64<N,E2>& count)
+{
+#if SIMDPP_HAS_INT64_ROTATE_BY_VECTOR
+    return detail::insn::i_rotl_v(uint64<N>(a.eval()), count.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N,expr_empty> rotl(const uint64<N,E1>& a, const uint64<N,E2>& count)
+{
+#if SIMDPP_HAS_UINT64_ROTATE_BY_VECTOR
+    return detail::insn::i_rotl_v(a.eval(), count.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+/** Rotates the bits of each element right by the number of bits in the
+    corresponding element of the count vector. The counts are taken modulo
+    the number of bits in the element.
+
+    @code
+    r0 = rotr(a0, count0 % W)
+    ...
+    rN = rotr(aN, countN % W)
+    @endcode
+
+    Here W is the number of bits in the element.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int8<N,expr_empty> rotr(const int8<N,E1>& a, const uint8<N,E2>& count)
+{
+#if SIMDPP_HAS_INT8_ROTATE_BY_VECTOR
+    // rotating right by c is equivalent to rotating left by -c
+    uint8<N> zero = make_zero();
+    uint8<N> c = sub(zero, count.eval());
+    return detail::insn::i_rotl_v(uint8<N>(a.eval()), c);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint8<N,expr_empty> rotr(const uint8<N,E1>& a, const uint8<N,E2>& count)
+{
+#if SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR
+    // rotating right by c is equivalent to rotating left by -c
+    uint8<N> zero = make_zero();
+    uint8<N> c = sub(zero, count.eval());
+    return detail::insn::i_rotl_v(a.eval(), c);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int16<N,expr_empty> rotr(const int16<N,E1>& a, const uint16<N,E2>& count)
+{
+#if SIMDPP_HAS_INT16_ROTATE_BY_VECTOR
+    // rotating right by c is equivalent to rotating left by -c
+    uint16<N> zero = make_zero();
+    uint16<N> c = sub(zero, count.eval());
+    return detail::insn::i_rotl_v(uint16<N>(a.eval()), c);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint16<N,expr_empty> rotr(const uint16<N,E1>& a, const uint16<N,E2>& count)
+{
+#if SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR
+    // rotating right by c is equivalent to rotating left by -c
+    uint16<N> zero = make_zero();
+    uint16<N> c = sub(zero, count.eval());
+    return detail::insn::i_rotl_v(a.eval(), c);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N,expr_empty> rotr(const int32<N,E1>& a, const uint32<N,E2>& count)
+{
+#if SIMDPP_HAS_INT32_ROTATE_BY_VECTOR
+    // rotating right by c is equivalent to rotating left by -c
+    uint32<N> zero = make_zero();
+    uint32<N> c = sub(zero, count.eval());
+    return detail::insn::i_rotl_v(uint32<N>(a.eval()), c);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N,expr_empty> rotr(const uint32<N,E1>& a, const uint32<N,E2>& count)
+{
+#if SIMDPP_HAS_UINT32_ROTATE_BY_VECTOR
+    // rotating right by c is equivalent to rotating left by -c
+    uint32<N> zero = make_zero();
+    uint32<N> c = sub(zero, count.eval());
+    return detail::insn::i_rotl_v(a.eval(), c);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N,expr_empty> rotr(const int64<N,E1>& a, const uint64<N,E2>& count)
+{
+#if SIMDPP_HAS_INT64_ROTATE_BY_VECTOR
+    // rotating right by c is equivalent to rotating left by -c
+    uint64<N> zero = make_zero();
+    uint64<N> c = sub(zero, count.eval());
+    return detail::insn::i_rotl_v(uint64<N>(a.eval()), c);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N,expr_empty> rotr(const uint64<N,E1>& a, const uint64<N,E2>& count)
+{
+#if SIMDPP_HAS_UINT64_ROTATE_BY_VECTOR
+    // rotating right by c is equivalent to rotating left by -c
+    uint64<N> zero = make_zero();
+    uint64<N> c = sub(zero, count.eval());
+    return detail::insn::i_rotl_v(a.eval(), c);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE2(E1, a, count);
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,152 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_MASKED_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_masked.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the elements selected by @a mask from memory. The elements that are
+    not selected are set to zero. The memory locations corresponding to the
+    unselected elements are not accessed, thus the function may be used to
+    load data that ends right before an unmapped page.
+
+    The type of the returned vector is determined by the type of the mask.
+
+    @code
+    r0 = mask0 ? *(p) : 0
+    ...
+    rN = maskN ? *(p+N) : 0
+    @endcode
+
+    The pointer does not need to be aligned.
+
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, MSA, N (scalar loads)}
+    @icost{AVX-AVX2, 1 (32 and 64-bit elements)}
+    @icost{AVX512BW-AVX512VL, 1}
+*/
+template<class T, unsigned N, class M> SIMDPP_INL
+uint8<N> load_masked(const T* p, const mask_int8<N,M>& mask)
+{
+    uint8<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint16<N> load_masked(const T* p, const mask_int16<N,M>& mask)
+{
+    uint16<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint32<N> load_masked(const T* p, const mask_int32<N,M>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+uint64<N> load_masked(const T* p, const mask_int64<N,M>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+float32<N> load_masked(const T* p, const mask_float32<N,M>& mask)
+{
+    float32<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<class T, unsigned N, class M> SIMDPP_INL
+float64<N> load_masked(const T* p, const mask_float64<N,M>& mask)
+{
+    float64<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+
+/** Loads the first @a n elements of a vector from memory. The rest of the
+    elements are set to zero. @a n must be in range [0..N] where @a N is the
+    number of elements in the vector. Memory past the first @a n elements is
+    not accessed, thus the function is suitable for processing the tail of
+    an array.
+
+    @code
+    r0 = *(p)
+    ...
+    r{n-1} = *(p+n-1)
+    r{n} = 0
+    ...
+    r{N-1} = 0
+    @endcode
+
+    The pointer does not need to be aligned.
+
+    This function results in several instructions. It is best not to use it in
+    inner loops.
+*/
+template<class V, class T> SIMDPP_INL
+V load_first(const T* p, unsigned n)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value,
+                  "V must be a non-mask vector");
+    typename detail::remove_sign<V>::type r;
+    detail::insn::i_load_first(r, reinterpret_cast<const char*>(p), n);
+    return V(r);
+}
+
+/** Loads the last @a n elements of a vector from memory. The rest of the
+    elements are set to zero. @a n must be in range [0..N] where @a N is the
+    number of elements in the vector. Only memory in range
+    <tt>[p+N-n, p+N)</tt> is accessed, thus the function is suitable for
+    processing the head of an array.
+
+    @code
+    r0 = 0
+    ...
+    r{N-n-1} = 0
+    r{N-n} = *(p+N-n)
+    ...
+    r{N-1} = *(p+N-1)
+    @endcode
+
+    The pointer does not need to be aligned.
+
+    This function results in several instructions. It is best not to use it in
+    inner loops.
+*/
+template<class V, class T> SIMDPP_INL
+V load_last(const T* p, unsigned n)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value,
+                  "V must be a non-mask vector");
+    typename detail::remove_sign<V>::type r;
+    detail::insn::i_load_last(r, reinterpret_cast<const char*>(p), n);
+    return V(r);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,481 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_MASKED_OPS_H
+#define LIBSIMDPP_SIMDPP_CORE_MASKED_OPS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/get_expr.h>
+#include <simdpp/detail/insn/masked_ops.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  The masked operations accept the mask, the source and the operands as
+    arbitrary vectors of the same size. The type of the result is the type of
+    the source with any mask converted to the corresponding vector. The
+    operands are converted to that type, the mask is converted to the mask
+    type of the result.
+
+    The operations that don't depend on the signedness of the elements are
+    performed on unsigned vectors.
+*/
+template<class MV> SIMDPP_INL
+void masked_ops_mask_cast(const MV& mask, MV& r)
+{
+    r = mask;
+}
+
+template<class M, class MV> SIMDPP_INL
+void masked_ops_mask_cast(const M& mask, MV& r)
+{
+    r = bit_cast<MV>(mask);
+}
+
+template<class V, unsigned N, class M> SIMDPP_INL
+typename V::mask_vector_type masked_ops_mask(const any_vec<N,M>& mask)
+{
+    static_assert(M::type_tag == SIMDPP_TAG_MASK_INT ||
+                  M::type_tag == SIMDPP_TAG_MASK_FLOAT,
+                  "The first argument of masked operations must be a mask");
+    using MP = typename type_of_tag<M::type_tag + M::size_tag, N, void>::type;
+    using MV = typename V::mask_vector_type;
+    MP m = mask.wrapped().eval();
+    MV r;
+    masked_ops_mask_cast(m, r);
+    return r;
+}
+
+template<class V> using masked_ops_result = typename get_expr_nomask<V>::empty;
+template<class V> using masked_ops_type = typename get_expr_nomask<V>::type;
+template<class V> using masked_ops_nosign = typename get_expr_nomask_nosign<V>::type;
+
+} // namespace detail
+
+/** Adds the elements of @a a and @a b in the lanes selected by @a mask. The
+    rest of the lanes are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 + b0 : src0
+    ...
+    rN = maskN ? aN + bN : srcN
+    @endcode
+
+    All integer and floating-point element types are supported. On AVX512F
+    (AVX512BW for 8 and 16-bit elements, additionally AVX512VL for 128 and
+    256-bit vectors) each native vector is processed with a single masked
+    instruction. Elsewhere the operation is emulated using @c blend.
+*/
+template<unsigned N, class M, class V1, class V2, class V3> SIMDPP_INL
+detail::masked_ops_result<V1>
+        add(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+            const any_vec<N,V2>& a, const any_vec<N,V3>& b)
+{
+    using U = detail::masked_ops_nosign<V1>;
+    using R = detail::masked_ops_type<V1>;
+    return R(detail::insn::v_mask_add(detail::masked_ops_mask<U>(mask),
+                                      U(src.wrapped().eval()),
+                                      U(a.wrapped().eval()),
+                                      U(b.wrapped().eval())));
+}
+
+/** Adds the elements of @a a and @a b in the lanes selected by @a mask. The
+    rest of the lanes are set to zero.
+
+    @code
+    r0 = mask0 ? a0 + b0 : 0
+    ...
+    rN = maskN ? aN + bN : 0
+    @endcode
+
+    See @c add(mask, src, a, b) for the supported types.
+*/
+template<unsigned N, class M, class V1, class V2> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_add(const any_vec<N,M>& mask,
+                  const any_vec<N,V1>& a, const any_vec<N,V2>& b)
+{
+    using U = detail::masked_ops_nosign<V1>;
+    using R = detail::masked_ops_type<V1>;
+    return R(detail::insn::v_maskz_add(detail::masked_ops_mask<U>(mask),
+                                       U(a.wrapped().eval()),
+                                       U(b.wrapped().eval())));
+}
+
+/** Subtracts the elements of @a b from @a a in the lanes selected by
+    @a mask. The rest of the lanes are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 - b0 : src0
+    ...
+    rN = maskN ? aN - bN : srcN
+    @endcode
+
+    See @c add(mask, src, a, b) for the supported types.
+*/
+template<unsigned N, class M, class V1, class V2, class V3> SIMDPP_INL
+detail::masked_ops_result<V1>
+        sub(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+            const any_vec<N,V2>& a, const any_vec<N,V3>& b)
+{
+    using U = detail::masked_ops_nosign<V1>;
+    using R = detail::masked_ops_type<V1>;
+    return R(detail::insn::v_mask_sub(detail::masked_ops_mask<U>(mask),
+                                      U(src.wrapped().eval()),
+                                      U(a.wrapped().eval()),
+                                      U(b.wrapped().eval())));
+}
+
+/** Subtracts the elements of @a b from @a a in the lanes selected by
+    @a mask. The rest of the lanes are set to zero.
+
+    @code
+    r0 = mask0 ? a0 - b0 : 0
+    ...
+    rN = maskN ? aN - bN : 0
+    @endcode
+*/
+template<unsigned N, class M, class V1, class V2> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_sub(const any_vec<N,M>& mask,
+                  const any_vec<N,V1>& a, const any_vec<N,V2>& b)
+{
+    using U = detail::masked_ops_nosign<V1>;
+    using R = detail::masked_ops_type<V1>;
+    return R(detail::insn::v_maskz_sub(detail::masked_ops_mask<U>(mask),
+                                       U(a.wrapped().eval()),
+                                       U(b.wrapped().eval())));
+}
+
+/** Multiplies the floating-point elements of @a a and @a b in the lanes
+    selected by @a mask. The rest of the lanes are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 * b0 : src0
+    ...
+    rN = maskN ? aN * bN : srcN
+    @endcode
+
+    Only @c float32 and @c float64 vectors are supported. Use @c mul_lo for
+    integer vectors.
+*/
+template<unsigned N, class M, class V1, class V2, class V3> SIMDPP_INL
+detail::masked_ops_result<V1>
+        mul(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+            const any_vec<N,V2>& a, const any_vec<N,V3>& b)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_mask_mul(detail::masked_ops_mask<R>(mask),
+                                    R(src.wrapped().eval()),
+                                    R(a.wrapped().eval()),
+                                    R(b.wrapped().eval()));
+}
+
+/** Multiplies the floating-point elements of @a a and @a b in the lanes
+    selected by @a mask. The rest of the lanes are set to zero.
+
+    @code
+    r0 = mask0 ? a0 * b0 : 0
+    ...
+    rN = maskN ? aN * bN : 0
+    @endcode
+*/
+template<unsigned N, class M, class V1, class V2> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_mul(const any_vec<N,M>& mask,
+                  const any_vec<N,V1>& a, const any_vec<N,V2>& b)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_maskz_mul(detail::masked_ops_mask<R>(mask),
+                                     R(a.wrapped().eval()),
+                                     R(b.wrapped().eval()));
+}
+
+/** Multiplies the 16-bit or 32-bit integer elements of @a a and @a b in the
+    lanes selected by @a mask and stores the low part of the result. The rest
+    of the lanes are copied from @a src.
+
+    @code
+    r0 = mask0 ? low(a0 * b0) : src0
+    ...
+    rN = maskN ? low(aN * bN) : srcN
+    @endcode
+*/
+template<unsigned N, class M, class V1, class V2, class V3> SIMDPP_INL
+detail::masked_ops_result<V1>
+        mul_lo(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+               const any_vec<N,V2>& a, const any_vec<N,V3>& b)
+{
+    using U = detail::masked_ops_nosign<V1>;
+    using R = detail::masked_ops_type<V1>;
+    return R(detail::insn::v_mask_mul_lo(detail::masked_ops_mask<U>(mask),
+                                         U(src.wrapped().eval()),
+                                         U(a.wrapped().eval()),
+                                         U(b.wrapped().eval())));
+}
+
+/** Multiplies the 16-bit or 32-bit integer elements of @a a and @a b in the
+    lanes selected by @a mask and stores the low part of the result. The rest
+    of the lanes are set to zero.
+
+    @code
+    r0 = mask0 ? low(a0 * b0) : 0
+    ...
+    rN = maskN ? low(aN * bN) : 0
+    @endcode
+*/
+template<unsigned N, class M, class V1, class V2> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_mul_lo(const any_vec<N,M>& mask,
+                     const any_vec<N,V1>& a, const any_vec<N,V2>& b)
+{
+    using U = detail::masked_ops_nosign<V1>;
+    using R = detail::masked_ops_type<V1>;
+    return R(detail::insn::v_maskz_mul_lo(detail::masked_ops_mask<U>(mask),
+                                          U(a.wrapped().eval()),
+                                          U(b.wrapped().eval())));
+}
+
+/** Performs a fused multiply-add operation in the lanes selected by @a mask.
+    The rest of the lanes are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 * b0 + c0 : src0
+    ...
+    rN = maskN ? aN * bN + cN : srcN
+    @endcode
+
+    Only @c float32 and @c float64 vectors are supported. Implemented only on
+    architectures with @c X86_FMA3, @c X86_FMA4 or @c X86_AVX512F support.
+
+    @par 512-bit version:
+    @icost{AVX512F, 2}
+*/
+template<unsigned N, class M, class V1, class V2, class V3, class V4> SIMDPP_INL
+detail::masked_ops_result<V1>
+        fmadd(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+              const any_vec<N,V2>& a, const any_vec<N,V3>& b,
+              const any_vec<N,V4>& c)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_mask_fmadd(detail::masked_ops_mask<R>(mask),
+                                      R(src.wrapped().eval()),
+                                      R(a.wrapped().eval()),
+                                      R(b.wrapped().eval()),
+                                      R(c.wrapped().eval()));
+}
+
+/** Performs a fused multiply-add operation in the lanes selected by @a mask.
+    The rest of the lanes are set to zero.
+
+    @code
+    r0 = mask0 ? a0 * b0 + c0 : 0
+    ...
+    rN = maskN ? aN * bN + cN : 0
+    @endcode
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+*/
+template<unsigned N, class M, class V1, class V2, class V3> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_fmadd(const any_vec<N,M>& mask, const any_vec<N,V1>& a,
+                    const any_vec<N,V2>& b, const any_vec<N,V3>& c)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_maskz_fmadd(detail::masked_ops_mask<R>(mask),
+                                       R(a.wrapped().eval()),
+                                       R(b.wrapped().eval()),
+                                       R(c.wrapped().eval()));
+}
+
+/** Computes the minimum of the elements of @a a and @a b in the lanes
+    selected by @a mask. The rest of the lanes are copied from @a src. The
+    signedness of the comparison is determined by the type of @a src.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : src0
+    ...
+    rN = maskN ? min(aN, bN) : srcN
+    @endcode
+
+    64-bit integer elements are supported only where the unmasked @c min is.
+*/
+template<unsigned N, class M, class V1, class V2, class V3> SIMDPP_INL
+detail::masked_ops_result<V1>
+        min(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+            const any_vec<N,V2>& a, const any_vec<N,V3>& b)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_mask_min(detail::masked_ops_mask<R>(mask),
+                                    R(src.wrapped().eval()),
+                                    R(a.wrapped().eval()),
+                                    R(b.wrapped().eval()));
+}
+
+/** Computes the minimum of the elements of @a a and @a b in the lanes
+    selected by @a mask. The rest of the lanes are set to zero. The
+    signedness of the comparison is determined by the type of @a a.
+
+    @code
+    r0 = mask0 ? min(a0, b0) : 0
+    ...
+    rN = maskN ? min(aN, bN) : 0
+    @endcode
+*/
+template<unsigned N, class M, class V1, class V2> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_min(const any_vec<N,M>& mask,
+                  const any_vec<N,V1>& a, const any_vec<N,V2>& b)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_maskz_min(detail::masked_ops_mask<R>(mask),
+                                     R(a.wrapped().eval()),
+                                     R(b.wrapped().eval()));
+}
+
+/** Computes the maximum of the elements of @a a and @a b in the lanes
+    selected by @a mask. The rest of the lanes are copied from @a src. The
+    signedness of the comparison is determined by the type of @a src.
+
+    @code
+    r0 = mask0 ? max(a0, b0) : src0
+    ...
+    rN = maskN ? max(aN, bN) : srcN
+    @endcode
+
+    64-bit integer elements are supported only where the unmasked @c max is.
+*/
+template<unsigned N, class M, class V1, class V2, class V3> SIMDPP_INL
+detail::masked_ops_result<V1>
+        max(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+            const any_vec<N,V2>& a, const any_vec<N,V3>& b)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_mask_max(detail::masked_ops_mask<R>(mask),
+                                    R(src.wrapped().eval()),
+                                    R(a.wrapped().eval()),
+                                    R(b.wrapped().eval()));
+}
+
+/** Computes the maximum of the elements of @a a and @a b in the lanes
+    selected by @a mask. The rest of the lanes are set to zero. The
+    signedness of the comparison is determined by the type of @a a.
+
+    @code
+    r0 = mask0 ? max(a0, b0) : 0
+    ...
+    rN = maskN ? max(aN, bN) : 0
+    @endcode
+*/
+template<unsigned N, class M, class V1, class V2> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_max(const any_vec<N,M>& mask,
+                  const any_vec<N,V1>& a, const any_vec<N,V2>& b)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_maskz_max(detail::masked_ops_mask<R>(mask),
+                                     R(a.wrapped().eval()),
+                                     R(b.wrapped().eval()));
+}
+
+/** Shifts the integer elements of @a a left by @a count bits in the lanes
+    selected by @a mask. The rest of the lanes are copied from @a src.
+
+    @code
+    r0 = mask0 ? a0 << count : src0
+    ...
+    rN = maskN ? aN << count : srcN
+    @endcode
+
+    Native masked instructions are used for 16, 32 and 64-bit elements.
+*/
+template<unsigned N, class M, class V1, class V2> SIMDPP_INL
+detail::masked_ops_result<V1>
+        shift_l(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+                const any_vec<N,V2>& a, unsigned count)
+{
+    using U = detail::masked_ops_nosign<V1>;
+    using R = detail::masked_ops_type<V1>;
+    return R(detail::insn::v_mask_shift_l(detail::masked_ops_mask<U>(mask),
+                                          U(src.wrapped().eval()),
+                                          U(a.wrapped().eval()), count));
+}
+
+/** Shifts the integer elements of @a a left by @a count bits in the lanes
+    selected by @a mask. The rest of the lanes are set to zero.
+
+    @code
+    r0 = mask0 ? a0 << count : 0
+    ...
+    rN = maskN ? aN << count : 0
+    @endcode
+*/
+template<unsigned N, class M, class V1> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_shift_l(const any_vec<N,M>& mask, const any_vec<N,V1>& a,
+                      unsigned count)
+{
+    using U = detail::masked_ops_nosign<V1>;
+    using R = detail::masked_ops_type<V1>;
+    return R(detail::insn::v_maskz_shift_l(detail::masked_ops_mask<U>(mask),
+                                           U(a.wrapped().eval()), count));
+}
+
+/** Shifts the integer elements of @a a right by @a count bits in the lanes
+    selected by @a mask. The rest of the lanes are copied from @a src. The
+    shift is arithmetic if @a src is a signed vector and logical otherwise.
+
+    @code
+    r0 = mask0 ? a0 >> count : src0
+    ...
+    rN = maskN ? aN >> count : srcN
+    @endcode
+
+    Native masked instructions are used for 16, 32 and 64-bit elements.
+*/
+template<unsigned N, class M, class V1, class V2> SIMDPP_INL
+detail::masked_ops_result<V1>
+        shift_r(const any_vec<N,M>& mask, const any_vec<N,V1>& src,
+                const any_vec<N,V2>& a, unsigned count)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_mask_shift_r(detail::masked_ops_mask<R>(mask),
+                                        R(src.wrapped().eval()),
+                                        R(a.wrapped().eval()), count);
+}
+
+/** Shifts the integer elements of @a a right by @a count bits in the lanes
+    selected by @a mask. The rest of the lanes are set to zero. The shift is
+    arithmetic if @a a is a signed vector and logical otherwise.
+
+    @code
+    r0 = mask0 ? a0 >> count : 0
+    ...
+    rN = maskN ? aN >> count : 0
+    @endcode
+*/
+template<unsigned N, class M, class V1> SIMDPP_INL
+detail::masked_ops_result<V1>
+        maskz_shift_r(const any_vec<N,M>& mask, const any_vec<N,V1>& a,
+                      unsigned count)
+{
+    using R = detail::masked_ops_type<V1>;
+    return detail::insn::v_maskz_shift_r(detail::masked_ops_mask<R>(mask),
+                                         R(a.wrapped().eval()), count);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,183 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_PREFIX_SUM_H
+#define LIBSIMDPP_SIMDPP_CORE_PREFIX_SUM_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_prefix_sum.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the inclusive prefix sum of the elements of a vector. Integer
+    sums wrap around on overflow.
+
+    @code
+    r0 = a0
+    r1 = a0 + a1
+    ...
+    rN = a0 + a1 + ... + aN
+    @endcode
+
+    The elements are first summed within each 128-bit lane in log2(M) steps,
+    where M is the number of elements in the lane. The totals of the
+    preceding lanes are then added to each lane.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512, NEON, ALTIVEC, MSA, 2*log2(M)}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 4*log2(M)+2}
+    @icost{AVX2, 2*log2(M)+3}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N> prefix_sum(const uint8<N,E>& a)
+{
+    return detail::insn::i_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int8<N> prefix_sum(const int8<N,E>& a)
+{
+    return int8<N>(detail::insn::i_prefix_sum(uint8<N>(a.eval())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N> prefix_sum(const uint16<N,E>& a)
+{
+    return detail::insn::i_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N> prefix_sum(const int16<N,E>& a)
+{
+    return int16<N>(detail::insn::i_prefix_sum(uint16<N>(a.eval())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> prefix_sum(const uint32<N,E>& a)
+{
+    return detail::insn::i_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N> prefix_sum(const int32<N,E>& a)
+{
+    return int32<N>(detail::insn::i_prefix_sum(uint32<N>(a.eval())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> prefix_sum(const uint64<N,E>& a)
+{
+    return detail::insn::i_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N> prefix_sum(const int64<N,E>& a)
+{
+    return int64<N>(detail::insn::i_prefix_sum(uint64<N>(a.eval())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N> prefix_sum(const float32<N,E>& a)
+{
+    return detail::insn::i_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> prefix_sum(const float64<N,E>& a)
+{
+    return detail::insn::i_prefix_sum(a.eval());
+}
+
+/** Computes the exclusive prefix sum of the elements of a vector. Integer
+    sums wrap around on overflow.
+
+    @code
+    r0 = 0
+    r1 = a0
+    ...
+    rN = a0 + a1 + ... + a(N-1)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512, NEON, ALTIVEC, MSA, 2*log2(M)+1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 4*log2(M)+4}
+    @icost{AVX2, 2*log2(M)+4}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N> exclusive_prefix_sum(const uint8<N,E>& a)
+{
+    return detail::insn::i_exclusive_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int8<N> exclusive_prefix_sum(const int8<N,E>& a)
+{
+    return int8<N>(detail::insn::i_exclusive_prefix_sum(uint8<N>(a.eval())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N> exclusive_prefix_sum(const uint16<N,E>& a)
+{
+    return detail::insn::i_exclusive_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N> exclusive_prefix_sum(const int16<N,E>& a)
+{
+    return int16<N>(detail::insn::i_exclusive_prefix_sum(uint16<N>(a.eval())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> exclusive_prefix_sum(const uint32<N,E>& a)
+{
+    return detail::insn::i_exclusive_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N> exclusive_prefix_sum(const int32<N,E>& a)
+{
+    return int32<N>(detail::insn::i_exclusive_prefix_sum(uint32<N>(a.eval())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> exclusive_prefix_sum(const uint64<N,E>& a)
+{
+    return detail::insn::i_exclusive_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N> exclusive_prefix_sum(const int64<N,E>& a)
+{
+    return int64<N>(detail::insn::i_exclusive_prefix_sum(uint64<N>(a.eval())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N> exclusive_prefix_sum(const float32<N,E>& a)
+{
+    return detail::insn::i_exclusive_prefix_sum(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> exclusive_prefix_sum(const float64<N,E>& a)
+{
+    return detail::insn::i_exclusive_prefix_sum(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
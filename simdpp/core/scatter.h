@@ -0,0 +1,84 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+#define LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/gather.h>
+#include <simdpp/detail/insn/scatter.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores the elements of a vector to memory locations identified by a vector
+    of indices. The type of the vector is determined by the type of @a base,
+    see gather() for the details.
+
+    @code
+    base[idx0] = a0
+    ...
+    base[idxN] = aN
+    @endcode
+
+    The elements are stored in order from the first to the last, thus if
+    several indices are equal, the last of the corresponding elements is
+    stored.
+
+    The indices are in units of elements, not bytes. They are interpreted as
+    signed 32-bit values, thus must not exceed 2^31-1.
+
+    @a base must have the alignment of the element type.
+
+    Uses native scatter instructions on AVX-512F (and AVX-512VL for 128 and
+    256-bit vectors). Emulated element by element on other architectures.
+*/
+template<class T, unsigned N, class V> SIMDPP_INL
+void scatter(T* base, const any_int32<N,V>& idx,
+             const typename detail::gather_vector_type<T,N>::type& a)
+{
+    typename detail::remove_sign<
+            typename detail::gather_vector_type<T,N>::type>::type ra;
+    ra = a;
+    uint32<N> ri;
+    ri = idx.wrapped().eval();
+    detail::insn::i_scatter(reinterpret_cast<char*>(base), ri, ra);
+}
+
+/** Stores the elements of a vector that are selected by @a mask to memory
+    locations identified by a vector of indices. The memory locations of the
+    elements that are not selected are not accessed.
+
+    @code
+    if (mask0) base[idx0] = a0
+    ...
+    if (maskN) base[idxN] = aN
+    @endcode
+
+    See scatter() for the remaining requirements.
+*/
+template<class T, unsigned N, class V> SIMDPP_INL
+void scatter_masked(T* base, const any_int32<N,V>& idx,
+                    const typename detail::gather_vector_type<T,N>::type& a,
+                    const typename detail::gather_vector_type<T,N>::type::mask_vector_type& mask)
+{
+    typename detail::remove_sign<
+            typename detail::gather_vector_type<T,N>::type>::type ra;
+    ra = a;
+    uint32<N> ri;
+    ri = idx.wrapped().eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base), ri, ra, mask);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -43,6 +43,19 @@ void store(T* p, const any_vec<N,V>& a)
     detail::insn::i_store(reinterpret_cast<char*>(p), a.wrapped().eval());
 }
 
+/// Stores the raw bit patterns of a half-precision or bfloat16 vector
+template<class T, unsigned N> SIMDPP_INL
+void store(T* p, const float16<N>& a)
+{
+    detail::insn::i_store(reinterpret_cast<char*>(p), a.bits());
+}
+
+template<class T, unsigned N> SIMDPP_INL
+void store(T* p, const bfloat16<N>& a)
+{
+    detail::insn::i_store(reinterpret_cast<char*>(p), a.bits());
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
@@ -41,6 +41,19 @@ void store_u(T* p, const any_vec<N,V>& a)
     detail::insn::v_store_u(reinterpret_cast<char*>(p), a.wrapped().eval());
 }
 
+/// Stores the raw bit patterns of a half-precision or bfloat16 vector
+template<class T, unsigned N> SIMDPP_INL
+void store_u(T* p, const float16<N>& a)
+{
+    detail::insn::v_store_u(reinterpret_cast<char*>(p), a.bits());
+}
+
+template<class T, unsigned N> SIMDPP_INL
+void store_u(T* p, const bfloat16<N>& a)
+{
+    detail::insn::v_store_u(reinterpret_cast<char*>(p), a.bits());
+}
+
 #ifndef SIMDPP_DOXYGEN
 } // namespace SIMDPP_ARCH_NAMESPACE
 #endif
@@ -45,6 +45,18 @@ void stream(T* p, const any_vec<N,V>& a)
     detail::insn::i_stream(reinterpret_cast<char*>(p), a.wrapped().eval());
 }
 
+/** Orders the non-temporal stores made by @c stream() before any following
+    stores. Non-temporal stores are weakly ordered on x86, thus this function
+    must be called before the stored data is made visible to other threads.
+
+    @icost{SSE2-AVX512, 1}
+    @icost{NEON, ALTIVEC, MSA, 0}
+*/
+SIMDPP_INL void stream_fence()
+{
+    detail::insn::i_stream_fence();
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
@@ -0,0 +1,46 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STREAM_LOAD_H
+#define LIBSIMDPP_SIMDPP_CORE_STREAM_LOAD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/stream_load.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads a vector from an aligned memory location using a non-temporal hint,
+    if possible. The hint is effective mainly on write-combining memory; on
+    regular memory the function behaves like @c load() on most processors.
+
+    @code
+    a[0..N-1] = *(p)
+    @endcode
+
+    @a p must be aligned to the native vector size.
+
+    Native instructions are used on SSE4.1 (128-bit vectors), AVX2 (256-bit
+    vectors) and AVX512F (512-bit vectors). A regular aligned load is used
+    elsewhere.
+*/
+template<class V, class T> SIMDPP_INL
+V stream_load(const T* p)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value,
+                  "V must be a non-mask vector");
+    return detail::insn::i_stream_load_any<V>(reinterpret_cast<const char*>(p));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,92 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_float16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts single-precision floating-point values to half precision. The
+    values are rounded to nearest even. Values that are too large are converted
+    to infinities, NaNs are quieted.
+
+    @code
+    r0 = (float16) a0
+    ...
+    rN = (float16) aN
+    @endcode
+
+    F16C, AVX512F and NEON (AArch64 only) have native conversion instructions.
+    Other instruction sets use integer emulation.
+
+    @icost{SSE2-AVX2 (no F16C), ALTIVEC, 14-16}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float16<N> to_float16(const float32<N,E>& a)
+{
+    return float16<N>(detail::insn::i_float32_to_f16(a.eval()));
+}
+
+/** Converts single-precision floating-point values to bfloat16 values, i.e.
+    keeps the upper 16 bits of each value. The values are rounded to nearest
+    even, NaNs are quieted.
+
+    @code
+    r0 = (bfloat16) a0
+    ...
+    rN = (bfloat16) aN
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+bfloat16<N> to_bfloat16(const float32<N,E>& a)
+{
+    return bfloat16<N>(detail::insn::i_float32_to_bf16(a.eval()));
+}
+
+/** Converts half-precision floating-point values to single precision. The
+    conversion is exact, signaling NaNs are quieted.
+
+    @code
+    r0 = (float) a0
+    ...
+    rN = (float) aN
+    @endcode
+
+    @icost{SSE2-AVX2 (no F16C), ALTIVEC, 12-14}
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> to_float32(const float16<N>& a)
+{
+    return detail::insn::i_f16_to_float32(a.bits());
+}
+
+/** Converts bfloat16 values to single precision. The conversion is exact.
+
+    @code
+    r0 = (float) a0
+    ...
+    rN = (float) aN
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> to_float32(const bfloat16<N>& a)
+{
+    return detail::insn::i_bf16_to_float32(a.bits());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,158 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_ALGORITHM_BULK_H
+#define LIBSIMDPP_SIMDPP_DETAIL_ALGORITHM_BULK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <simdpp/types.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/core/stream.h>
+#include <simdpp/core/stream_load.h>
+#include <simdpp/detail/algorithm/common.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+/** @def SIMDPP_NONTEMPORAL_THRESHOLD
+    The number of bytes of memory that an operation such as @c bulk_copy()
+    must touch for non-temporal loads and stores to be used. If not defined
+    by the user, the size of the last level cache is detected at runtime.
+
+    The macro must be defined identically in all translation units that
+    include this file.
+*/
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace algorithm {
+
+// Used when the cache size can not be detected
+static const std::size_t default_llc_size = 8 * 1024 * 1024;
+
+inline std::size_t detect_llc_size()
+{
+#if defined(_SC_LEVEL3_CACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+    long size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (size <= 0)
+        size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (size > 0)
+        return static_cast<std::size_t>(size);
+#endif
+    return default_llc_size;
+}
+
+/*  Returns the number of touched bytes starting from which the non-temporal
+    code paths are used. The cache size is detected once and cached.
+*/
+inline std::size_t nontemporal_threshold()
+{
+#ifdef SIMDPP_NONTEMPORAL_THRESHOLD
+    return SIMDPP_NONTEMPORAL_THRESHOLD;
+#else
+    static std::atomic<std::size_t> cached(0);
+
+    std::size_t value = cached.load(std::memory_order_relaxed);
+    if (value == 0) {
+        value = detect_llc_size();
+        cached.store(value, std::memory_order_relaxed);
+    }
+    return value;
+#endif
+}
+
+// The vector type used for bulk memory operations
+using bulk_vec = uint8<uint32v::length_bytes>;
+
+/*  Copies @a size bytes using non-temporal stores. The destination is aligned
+    first. The source is loaded using non-temporal loads if it becomes aligned
+    too, otherwise regular unaligned loads are used. The stores are fenced
+    before returning.
+*/
+inline void bulk_copy_stream(void* vdst, const void* vsrc, std::size_t size)
+{
+    char* dst = reinterpret_cast<char*>(vdst);
+    const char* src = reinterpret_cast<const char*>(vsrc);
+    using V = bulk_vec;
+    const std::size_t L = V::length_bytes;
+
+    std::size_t i = peel_count(dst, size, L);
+    std::memcpy(dst, src, i);
+
+    if (reinterpret_cast<std::uintptr_t>(src + i) % L == 0) {
+        for (; i + unroll*L <= size; i += unroll*L) {
+            V a0 = stream_load<V>(src + i);
+            V a1 = stream_load<V>(src + i + L);
+            V a2 = stream_load<V>(src + i + 2*L);
+            V a3 = stream_load<V>(src + i + 3*L);
+            stream(dst + i, a0);
+            stream(dst + i + L, a1);
+            stream(dst + i + 2*L, a2);
+            stream(dst + i + 3*L, a3);
+        }
+    } else {
+        for (; i + unroll*L <= size; i += unroll*L) {
+            V a0 = load_u(src + i);
+            V a1 = load_u(src + i + L);
+            V a2 = load_u(src + i + 2*L);
+            V a3 = load_u(src + i + 3*L);
+            stream(dst + i, a0);
+            stream(dst + i + L, a1);
+            stream(dst + i + 2*L, a2);
+            stream(dst + i + 3*L, a3);
+        }
+    }
+    for (; i + L <= size; i += L) {
+        V a = load_u(src + i);
+        stream(dst + i, a);
+    }
+    std::memcpy(dst + i, src + i, size - i);
+    stream_fence();
+}
+
+/*  Fills @a size bytes with @a value using non-temporal stores. The stores
+    are fenced before returning.
+*/
+inline void bulk_fill_stream(void* vdst, uint8_t value, std::size_t size)
+{
+    char* dst = reinterpret_cast<char*>(vdst);
+    using V = bulk_vec;
+    const std::size_t L = V::length_bytes;
+
+    std::size_t i = peel_count(dst, size, L);
+    std::memset(dst, value, i);
+
+    V v = splat<V>(value);
+    for (; i + unroll*L <= size; i += unroll*L) {
+        stream(dst + i, v);
+        stream(dst + i + L, v);
+        stream(dst + i + 2*L, v);
+        stream(dst + i + 3*L, v);
+    }
+    for (; i + L <= size; i += L) {
+        stream(dst + i, v);
+    }
+    std::memset(dst + i, value, size - i);
+    stream_fence();
+}
+
+} // namespace algorithm
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,160 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_ALGORITHM_COMMON_H
+#define LIBSIMDPP_SIMDPP_DETAIL_ALGORITHM_COMMON_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace algorithm {
+
+/*  The algorithms process the arrays in three parts: a head that is
+    processed until the reference pointer becomes aligned, the main body that
+    is processed in full vectors and is unrolled to expose instruction level
+    parallelism, and the tail. The head and the tail are processed as partial
+    vectors loaded through a temporary buffer, thus the user-supplied
+    functions always operate on vectors.
+*/
+static const unsigned unroll = 4;
+
+// Maps the element type T to a vector type with N elements
+template<class T, unsigned N> struct vec_of;
+template<unsigned N> struct vec_of<float, N> { using type = float32<N>; };
+template<unsigned N> struct vec_of<double, N> { using type = float64<N>; };
+template<unsigned N> struct vec_of<int8_t, N> { using type = int8<N>; };
+template<unsigned N> struct vec_of<uint8_t, N> { using type = uint8<N>; };
+template<unsigned N> struct vec_of<int16_t, N> { using type = int16<N>; };
+template<unsigned N> struct vec_of<uint16_t, N> { using type = uint16<N>; };
+template<unsigned N> struct vec_of<int32_t, N> { using type = int32<N>; };
+template<unsigned N> struct vec_of<uint32_t, N> { using type = uint32<N>; };
+template<unsigned N> struct vec_of<int64_t, N> { using type = int64<N>; };
+template<unsigned N> struct vec_of<uint64_t, N> { using type = uint64<N>; };
+#if CHAR_MIN < 0
+template<unsigned N> struct vec_of<char, N> { using type = int8<N>; };
+#else
+template<unsigned N> struct vec_of<char, N> { using type = uint8<N>; };
+#endif
+
+template<class T, unsigned N>
+using vec_of_t = typename vec_of<T, N>::type;
+
+// Maps the element type T to the native vector type
+template<class T> struct native_vec;
+template<> struct native_vec<float> { using type = float32v; };
+template<> struct native_vec<double> { using type = float64v; };
+template<> struct native_vec<int8_t> { using type = int8v; };
+template<> struct native_vec<uint8_t> { using type = uint8v; };
+template<> struct native_vec<int16_t> { using type = int16v; };
+template<> struct native_vec<uint16_t> { using type = uint16v; };
+template<> struct native_vec<int32_t> { using type = int32v; };
+template<> struct native_vec<uint32_t> { using type = uint32v; };
+template<> struct native_vec<int64_t> { using type = int64v; };
+template<> struct native_vec<uint64_t> { using type = uint64v; };
+template<> struct native_vec<char> { using type = vec_of_t<char, SIMDPP_FAST_INT8_SIZE>; };
+
+template<class T>
+using native_vec_t = typename native_vec<T>::type;
+
+/*  Returns the alignment in bytes that is required to store or load vectors
+    of type V using the aligned memory operations.
+*/
+template<class V> SIMDPP_INL
+std::size_t vec_alignment()
+{
+    using E = typename V::element_type;
+    return sizeof(V) < sizeof(native_vec_t<E>) ? sizeof(V) :
+                                                 sizeof(native_vec_t<E>);
+}
+
+/*  Returns the number of elements that need to be processed until @a p
+    becomes aligned to @a align bytes. The result is limited to @a n.
+*/
+template<class T> SIMDPP_INL
+std::size_t peel_count(const T* p, std::size_t n, std::size_t align)
+{
+    std::size_t misalign = reinterpret_cast<std::uintptr_t>(p) % align;
+    std::size_t count = misalign == 0 ? 0 : (align - misalign) / sizeof(T);
+    return count < n ? count : n;
+}
+
+/*  Loads the first @a n elements from @a p. The remaining elements are set to
+    @a pad.
+*/
+template<class V, class T> SIMDPP_INL
+V load_partial(const T* p, std::size_t n, typename V::element_type pad)
+{
+    mem_block<V> b;
+    for (unsigned i = 0; i < V::length; ++i) {
+        b[i] = i < n ? p[i] : pad;
+    }
+    return b;
+}
+
+// Stores the first @a n elements of @a v to @a p
+template<class V, class T> SIMDPP_INL
+void store_partial(T* p, const V& v, std::size_t n)
+{
+    mem_block<V> b(v);
+    for (unsigned i = 0; i < n; ++i) {
+        p[i] = b[i];
+    }
+}
+
+// Replaces the elements starting at @a n by @a pad
+template<class V> SIMDPP_INL
+V pad_partial(const V& v, std::size_t n, typename V::element_type pad)
+{
+    mem_block<V> b(v);
+    for (unsigned i = n; i < V::length; ++i) {
+        b[i] = pad;
+    }
+    return b;
+}
+
+/*  Combines all elements of @a v using @a op, which must be associative and
+    commutative.
+*/
+template<class V, class Op> SIMDPP_INL
+typename V::element_type reduce_lanes(const V& v, Op op)
+{
+    mem_block<V> b(v);
+    V r = splat<V>(b[0]);
+    for (unsigned i = 1; i < V::length; ++i) {
+        r = op(r, splat<V>(b[i]));
+    }
+    mem_block<V> rb(r);
+    return rb[0];
+}
+
+/*  Returns the lanes of a mask returned by a predicate as an unsigned integer
+    vector. Set lanes have all bits set.
+*/
+template<class V, class P> SIMDPP_INL
+typename V::uint_vector_type eval_pred(const V& v, P& pred)
+{
+    typename V::mask_vector_type m = pred(v);
+    return bit_cast<typename V::uint_vector_type>(m.unmask());
+}
+
+} // namespace algorithm
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,572 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_ALGORITHM_SORT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_ALGORITHM_SORT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/capabilities.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_le.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/compress.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute4.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/algorithm/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace algorithm {
+
+/*  The vectors are sorted using bitonic sorting networks. Each step of the
+    network compares each element i with the element i ^ M and stores the
+    minimum to the element whose bit J is clear and the maximum to the other.
+    M is equal to J in the half-cleaner steps and to 2*J-1 in the first step
+    of each merge which compares the elements in reverse order, thus all
+    blocks are sorted in ascending order and no direction masks are needed.
+
+    If the distance is less than the length of the native vector, the
+    partners are moved into position using permutations within the vector.
+    Otherwise whole native vectors of a vector array are compared.
+*/
+
+// Permutes 32-bit elements within 128-bit lanes: r[i] = a[i ^ W]
+template<unsigned W> struct sort_perm_lanes;
+template<> struct sort_perm_lanes<0> {
+    template<class U> static SIMDPP_INL U run(const U& a) { return a; }
+};
+template<> struct sort_perm_lanes<1> {
+    template<class U> static SIMDPP_INL U run(const U& a) { return permute4<1,0,3,2>(a); }
+};
+template<> struct sort_perm_lanes<2> {
+    template<class U> static SIMDPP_INL U run(const U& a) { return permute4<2,3,0,1>(a); }
+};
+template<> struct sort_perm_lanes<3> {
+    template<class U> static SIMDPP_INL U run(const U& a) { return permute4<3,2,1,0>(a); }
+};
+
+/*  Swaps adjacent 128-bit lanes. The last argument selects the implementation
+    depending on the native vector type: the lanes of 128-bit vectors are
+    separate vectors of the array.
+*/
+template<unsigned N> SIMDPP_INL
+void sort_swap128_vecs(uint32<N>& r, const uint32<N>& a, const uint32<4>&)
+{
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = a.vec(i ^ 1);
+    }
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned N> SIMDPP_INL
+void sort_swap128_vecs(uint32<N>& r, const uint32<N>& a, const uint32<8>&)
+{
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        __m256i x = a.vec(i).native();
+        r.vec(i) = _mm256_permute2x128_si256(x, x, 0x01);
+    }
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned N> SIMDPP_INL
+void sort_swap128_vecs(uint32<N>& r, const uint32<N>& a, const uint32<16>&)
+{
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        __m512i x = a.vec(i).native();
+        r.vec(i) = _mm512_shuffle_i32x4(x, x, _MM_SHUFFLE(2,3,0,1));
+    }
+}
+#endif
+
+template<bool Swap> struct sort_swap128 {
+    template<class U> static SIMDPP_INL U run(const U& a) { return a; }
+};
+template<> struct sort_swap128<true> {
+    template<unsigned N> static SIMDPP_INL
+    uint32<N> run(const uint32<N>& a)
+    {
+        uint32<N> r;
+        sort_swap128_vecs(r, a, a.vec(0));
+        return r;
+    }
+};
+
+// Swaps the 256-bit halves of 512-bit vectors
+template<bool Swap> struct sort_swap256;
+template<> struct sort_swap256<false> {
+    template<class U> static SIMDPP_INL U run(const U& a) { return a; }
+};
+#if SIMDPP_USE_AVX512F
+template<> struct sort_swap256<true> {
+    template<unsigned N> static SIMDPP_INL
+    uint32<N> run(const uint32<N>& a)
+    {
+        uint32<N> r;
+        for (unsigned i = 0; i < r.vec_length; ++i) {
+            __m512i x = a.vec(i).native();
+            r.vec(i) = _mm512_shuffle_i64x2(x, x, _MM_SHUFFLE(1,0,3,2));
+        }
+        return r;
+    }
+};
+#endif
+
+/*  Permutes the elements within each native vector: r[i] = a[i ^ M]. M must
+    be less than the length of the native vector.
+*/
+template<unsigned M, class V> SIMDPP_INL
+V sort_xor_perm(const V& a)
+{
+    using U = uint32<sizeof(V) / 4>;
+    const unsigned D = M * sizeof(typename V::element_type);
+    U u = bit_cast<U>(a);
+    u = sort_perm_lanes<(D % 16) / 4>::run(u);
+    u = sort_swap128<(D & 16) != 0>::run(u);
+    u = sort_swap256<(D & 32) != 0>::run(u);
+    return bit_cast<V>(u);
+}
+
+// Returns a mask whose elements with the bit J of the index set are set
+template<unsigned J> struct sort_select_mask;
+template<> struct sort_select_mask<1> {
+    template<class U> static SIMDPP_INL U get()
+    {
+        const uint64_t o = ~uint64_t(0);
+        return make_uint(0, o);
+    }
+};
+template<> struct sort_select_mask<2> {
+    template<class U> static SIMDPP_INL U get()
+    {
+        const uint64_t o = ~uint64_t(0);
+        return make_uint(0, 0, o, o);
+    }
+};
+template<> struct sort_select_mask<4> {
+    template<class U> static SIMDPP_INL U get()
+    {
+        const uint64_t o = ~uint64_t(0);
+        return make_uint(0, 0, 0, 0, o, o, o, o);
+    }
+};
+template<> struct sort_select_mask<8> {
+    template<class U> static SIMDPP_INL U get()
+    {
+        const uint64_t o = ~uint64_t(0);
+        return make_uint(0, 0, 0, 0, 0, 0, 0, 0, o, o, o, o, o, o, o, o);
+    }
+};
+
+/*  Performs a compare-exchange step. The arguments of min and max are passed
+    in different order so that the elements are only permuted even if some of
+    them are unordered or compare equal while being different, e.g. -0.0 and
+    0.0, on architectures where min and max return the second argument in such
+    case.
+*/
+template<unsigned J, unsigned M, bool InVector> struct sort_cmp_xchg_impl;
+
+template<unsigned J, unsigned M> struct sort_cmp_xchg_impl<J, M, true> {
+    template<class V> static SIMDPP_INL void run(V& a)
+    {
+        using U = typename V::uint_vector_type;
+        V p = sort_xor_perm<M>(a);
+        V mn = min(a, p);
+        V mx = max(a, p);
+        U sel = sort_select_mask<J>::template get<U>();
+        a = blend(mx, mn, sel);
+    }
+};
+
+template<unsigned J, unsigned M> struct sort_cmp_xchg_impl<J, M, false> {
+    template<class V> static SIMDPP_INL void run(V& a)
+    {
+        using B = typename V::base_vector_type;
+        const unsigned vj = J / B::length;
+        const unsigned vm = M / B::length;
+        const unsigned lm = M % B::length;
+        for (unsigned i = 0; i < V::vec_length; ++i) {
+            if (i & vj)
+                continue;
+            unsigned k = i ^ vm;
+            B x = a.vec(i);
+            B y = sort_xor_perm<lm>(a.vec(k));
+            B mn = min(x, y);
+            B mx = max(y, x);
+            a.vec(i) = mn;
+            a.vec(k) = sort_xor_perm<lm>(mx);
+        }
+    }
+};
+
+template<unsigned J, unsigned M, class V> SIMDPP_INL
+void sort_cmp_xchg(V& a)
+{
+    sort_cmp_xchg_impl<J, M, (J < V::base_vector_type::length)>::run(a);
+}
+
+// Sorts bitonic sequences of 2*J elements
+template<unsigned J> struct sort_half_cleaners {
+    template<class V> static SIMDPP_INL void run(V& a)
+    {
+        sort_cmp_xchg<J, J>(a);
+        sort_half_cleaners<J/2>::run(a);
+    }
+};
+template<> struct sort_half_cleaners<0> {
+    template<class V> static SIMDPP_INL void run(V&) {}
+};
+
+// Merges the sorted blocks of S/2 elements into sorted blocks of S elements
+template<unsigned S, unsigned N, bool Done = (S > N)> struct sort_bitonic_stages {
+    template<class V> static SIMDPP_INL void run(V& a)
+    {
+        sort_cmp_xchg<S/2, S-1>(a);
+        sort_half_cleaners<S/4>::run(a);
+        sort_bitonic_stages<S*2, N>::run(a);
+    }
+};
+template<unsigned S, unsigned N> struct sort_bitonic_stages<S, N, true> {
+    template<class V> static SIMDPP_INL void run(V&) {}
+};
+
+// Reverses the order of the elements
+template<class V> SIMDPP_INL
+V sort_reverse(const V& a)
+{
+    using B = typename V::base_vector_type;
+    V r;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        r.vec(i) = sort_xor_perm<B::length - 1>(a.vec(V::vec_length - 1 - i));
+    }
+    return r;
+}
+
+template<class V> SIMDPP_INL
+V sort_network(const V& a)
+{
+    V r = a;
+    sort_bitonic_stages<2, V::length>::run(r);
+    return r;
+}
+
+template<class V> SIMDPP_INL
+void sort_merge_network(V& a, V& b)
+{
+    V rb = sort_reverse(b);
+    V lo = min(a, rb);
+    V hi = max(rb, a);
+    sort_half_cleaners<V::length/2>::run(lo);
+    sort_half_cleaners<V::length/2>::run(hi);
+    a = lo;
+    b = hi;
+}
+
+// -----------------------------------------------------------------------------
+
+/*  Whether the array sort is vectorized for the element type T. The arrays
+    are sorted using std::sort where the vectorized sort is slower: without
+    SSSE3 compress() of 32-bit elements is emulated element by element, and
+    on x86 below AVX512F the partitioning of 64-bit elements does not make up
+    for the cost of the sorting networks. Comparisons of 64-bit integers are
+    not available on all architectures either.
+*/
+template<class T> struct sort_traits;
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+template<> struct sort_traits<int32_t> : std::true_type {};
+template<> struct sort_traits<uint32_t> : std::true_type {};
+template<> struct sort_traits<float> : std::true_type {};
+#else
+template<> struct sort_traits<int32_t> : std::false_type {};
+template<> struct sort_traits<uint32_t> : std::false_type {};
+template<> struct sort_traits<float> : std::false_type {};
+#endif
+#if SIMDPP_USE_AVX512F || SIMDPP_USE_NEON64 || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+template<> struct sort_traits<int64_t> : std::true_type {};
+template<> struct sort_traits<uint64_t> : std::true_type {};
+template<> struct sort_traits<double> : std::true_type {};
+#else
+template<> struct sort_traits<int64_t> : std::false_type {};
+template<> struct sort_traits<uint64_t> : std::false_type {};
+template<> struct sort_traits<double> : std::false_type {};
+#endif
+
+// The value used to pad partial vectors. It is sorted after all other values
+template<class T> SIMDPP_INL
+T sort_pad_value()
+{
+    return std::numeric_limits<T>::has_infinity ?
+                std::numeric_limits<T>::infinity() :
+                std::numeric_limits<T>::max();
+}
+
+/*  Sorts up to K native vectors of elements using a single sorting network.
+    The unused elements are padded with a value that is sorted last.
+*/
+template<unsigned K, class T> SIMDPP_INL
+void sort_small_k(T* a, std::size_t n)
+{
+    using B = native_vec_t<T>;
+    using V = vec_of_t<T, K * B::length>;
+    const std::size_t L = B::length;
+
+    V v;
+    for (unsigned k = 0; k < K; ++k) {
+        if ((k+1)*L <= n) {
+            v.vec(k) = load_u(a + k*L);
+        } else {
+            std::size_t m = k*L < n ? n - k*L : 0;
+            v.vec(k) = load_partial<B>(a + k*L, m, sort_pad_value<T>());
+        }
+    }
+    v = sort_network(v);
+    for (unsigned k = 0; k < K && k*L < n; ++k) {
+        if ((k+1)*L <= n) {
+            store_u(a + k*L, v.vec(k));
+        } else {
+            store_partial(a + k*L, v.vec(k), n - k*L);
+        }
+    }
+}
+
+// The largest array that is sorted directly using a sorting network
+template<class T> SIMDPP_INL
+std::size_t sort_small_max()
+{
+    return 8 * native_vec_t<T>::length;
+}
+
+template<class T> SIMDPP_INL
+void sort_small(T* a, std::size_t n)
+{
+    const std::size_t L = native_vec_t<T>::length;
+    if (n <= 1)
+        return;
+    if (n <= L)
+        sort_small_k<1>(a, n);
+    else if (n <= 2*L)
+        sort_small_k<2>(a, n);
+    else if (n <= 4*L)
+        sort_small_k<4>(a, n);
+    else
+        sort_small_k<8>(a, n);
+}
+
+template<class T> SIMDPP_INL
+T sort_median3(T a, T b, T c)
+{
+    if (b < a)
+        std::swap(a, b);
+    if (c < b)
+        b = c < a ? a : c;
+    return b;
+}
+
+// Selects the pivot as the median of 3 or, for larger arrays, of 9 samples
+template<class T> SIMDPP_INL
+T sort_pivot(const T* a, std::size_t n)
+{
+    if (n < 1024) {
+        return sort_median3(a[n/4], a[n/2], a[n/4*3]);
+    }
+    std::size_t s = n / 8;
+    return sort_median3(sort_median3(a[0], a[s], a[2*s]),
+                        sort_median3(a[3*s], a[4*s], a[5*s]),
+                        sort_median3(a[6*s], a[7*s], a[n-1]));
+}
+
+template<bool Inclusive, class V> SIMDPP_INL
+typename V::mask_vector_type sort_pivot_mask(const V& v, const V& p)
+{
+    typename V::mask_vector_type m;
+    if (Inclusive)
+        m = cmp_le(v, p);
+    else
+        m = cmp_lt(v, p);
+    return m;
+}
+
+/*  Returns the elements of @a v that compare less than (or equal to, if
+    Inclusive is set) the pivot followed by the rest of the elements. The
+    number of the former is stored to @a count. The latter are stored in
+    reverse order, which does not matter as both parts are sorted later.
+*/
+template<bool Inclusive, class V> SIMDPP_INL
+V sort_partition_vec(const V& v, const V& p, std::size_t& count)
+{
+    using MI = typename V::uint_vector_type::mask_vector_type;
+    typename V::mask_vector_type m = sort_pivot_mask<Inclusive>(v, p);
+    count = insn::i_compress_count(bit_cast<MI>(m));
+    // compress() sets the unused elements to zero
+    V lo = compress(m, v);
+    V hi = compress(bit_not(m), v);
+    hi = sort_xor_perm<V::length - 1>(hi);
+    V r = bit_or(lo, hi);
+    return r;
+}
+
+/*  Partitions the array so that the elements that compare less than (or equal
+    to, if Inclusive is set) the pivot precede the rest. Returns the number of
+    such elements. @a n must be at least twice the length of the native
+    vector.
+
+    The first and the last vectors are loaded up front so that there is
+    always at least a full vector of free space at both write positions. The
+    next vector is loaded from the side which has less free space remaining.
+    Each partitioned vector is stored in full at both write positions, the
+    elements of the other part overwriting only the free space.
+*/
+template<bool Inclusive, class T> SIMDPP_INL
+std::size_t sort_partition(T* a, std::size_t n, T pivot)
+{
+    using V = native_vec_t<T>;
+    const std::size_t L = V::length;
+
+    V p = splat<V>(pivot);
+    V first = load_u(a);
+    V last = load_u(a + n - L);
+    std::size_t rl = L, rr = n - L;
+    std::size_t wl = 0, wr = n;
+
+    while (rr - rl >= L) {
+        V v;
+        if (rl - wl <= wr - rr) {
+            v = load_u(a + rl);
+            rl += L;
+        } else {
+            rr -= L;
+            v = load_u(a + rr);
+        }
+        std::size_t count;
+        V r = sort_partition_vec<Inclusive>(v, p, count);
+        store_u(a + wl, r);
+        store_u(a + wr - L, r);
+        wl += count;
+        wr -= L - count;
+    }
+
+    // the remaining elements are copied out before the free space is reused
+    mem_block<V> rem = load_partial<V>(a + rl, rr - rl, T());
+    for (std::size_t i = 0; i < rr - rl; ++i) {
+        T x = rem[i];
+        bool lo = Inclusive ? x <= pivot : x < pivot;
+        if (lo)
+            a[wl++] = x;
+        else
+            a[--wr] = x;
+    }
+
+    // the free space is now contiguous and fits exactly the two saved vectors
+    std::size_t count;
+    V r = sort_partition_vec<Inclusive>(first, p, count);
+    store_u(a + wl, r);
+    store_u(a + wr - L, r);
+    wl += count;
+    r = sort_partition_vec<Inclusive>(last, p, count);
+    store_u(a + wl, r);
+    return wl + count;
+}
+
+/*  Sorts the array using quicksort. The smaller part is sorted recursively
+    and the larger part iteratively. Once @a depth levels of partitioning have
+    been performed, the remaining parts are sorted using std::sort to bound
+    the worst case complexity.
+*/
+template<class T>
+inline void sort_impl(T* a, std::size_t n, unsigned depth)
+{
+    while (n > sort_small_max<T>()) {
+        if (depth == 0) {
+            std::sort(a, a + n);
+            return;
+        }
+        depth--;
+
+        T pivot = sort_pivot(a, n);
+        std::size_t m = sort_partition<false>(a, n, pivot);
+        if (m == 0) {
+            // The pivot is the smallest element. The elements that are equal
+            // to it are already in their final positions after this step.
+            // The array contains no NaNs, thus at least the pivot itself is
+            // moved.
+            m = sort_partition<true>(a, n, pivot);
+            a += m;
+            n -= m;
+            continue;
+        }
+        if (m < n - m) {
+            sort_impl(a, m, depth);
+            a += m;
+            n -= m;
+        } else {
+            sort_impl(a + m, n - m, depth);
+            n = m;
+        }
+    }
+    sort_small(a, n);
+}
+
+/*  Moves the NaN values to the end of the array and returns the number of the
+    other elements. All other values compare less than or equal to infinity,
+    thus the vectorized partition can be reused.
+*/
+template<class T> SIMDPP_INL
+std::size_t sort_partition_nan(T* a, std::size_t n, std::true_type)
+{
+    if (!std::numeric_limits<T>::has_quiet_NaN)
+        return n;
+    if (n < 2 * native_vec_t<T>::length)
+        return std::partition(a, a + n, [](T x) { return x == x; }) - a;
+    return sort_partition<true>(a, n, std::numeric_limits<T>::infinity());
+}
+
+template<class T> SIMDPP_INL
+std::size_t sort_partition_nan(T* a, std::size_t n, std::false_type)
+{
+    if (!std::numeric_limits<T>::has_quiet_NaN)
+        return n;
+    return std::partition(a, a + n, [](T x) { return x == x; }) - a;
+}
+
+template<class T> SIMDPP_INL
+void sort_array(T* a, std::size_t n, std::true_type)
+{
+    n = sort_partition_nan(a, n, std::true_type());
+    unsigned depth = 0;
+    for (std::size_t i = n; i > 1; i >>= 1)
+        depth += 2;
+    sort_impl(a, n, depth);
+}
+
+template<class T> SIMDPP_INL
+void sort_array(T* a, std::size_t n, std::false_type)
+{
+    n = sort_partition_nan(a, n, std::false_type());
+    std::sort(a, a + n);
+}
+
+} // namespace algorithm
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
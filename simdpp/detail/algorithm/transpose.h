@@ -0,0 +1,192 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_ALGORITHM_TRANSPOSE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_ALGORITHM_TRANSPOSE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/stream.h>
+#include <simdpp/core/zip_hi.h>
+#include <simdpp/core/zip_lo.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace algorithm {
+
+/*  The matrix is transposed in tiles. A tile has K columns, where K is the
+    number of elements in 128 bits, and K rows per 128-bit lane of the
+    vector. The rows i, i+K, i+2K, ... of the tile are loaded into the lanes
+    of the vector i, thus after the lanes are transposed independently, the
+    vector c contains the column c of all rows of the tile, which is a
+    contiguous part of the row c of the destination.
+*/
+
+// Maps the element size S to the unsigned vector type of B bytes
+template<unsigned S, unsigned B> struct transpose_vec;
+template<unsigned B> struct transpose_vec<1, B> { using type = uint8<B>; };
+template<unsigned B> struct transpose_vec<2, B> { using type = uint16<B/2>; };
+template<unsigned B> struct transpose_vec<4, B> { using type = uint32<B/4>; };
+template<unsigned B> struct transpose_vec<8, B> { using type = uint64<B/8>; };
+
+template<unsigned N> SIMDPP_INL
+uint8<N> transpose_zip_lo(const uint8<N>& a, const uint8<N>& b) { return zip16_lo(a, b); }
+template<unsigned N> SIMDPP_INL
+uint8<N> transpose_zip_hi(const uint8<N>& a, const uint8<N>& b) { return zip16_hi(a, b); }
+template<unsigned N> SIMDPP_INL
+uint16<N> transpose_zip_lo(const uint16<N>& a, const uint16<N>& b) { return zip8_lo(a, b); }
+template<unsigned N> SIMDPP_INL
+uint16<N> transpose_zip_hi(const uint16<N>& a, const uint16<N>& b) { return zip8_hi(a, b); }
+template<unsigned N> SIMDPP_INL
+uint32<N> transpose_zip_lo(const uint32<N>& a, const uint32<N>& b) { return zip4_lo(a, b); }
+template<unsigned N> SIMDPP_INL
+uint32<N> transpose_zip_hi(const uint32<N>& a, const uint32<N>& b) { return zip4_hi(a, b); }
+template<unsigned N> SIMDPP_INL
+uint64<N> transpose_zip_lo(const uint64<N>& a, const uint64<N>& b) { return zip2_lo(a, b); }
+template<unsigned N> SIMDPP_INL
+uint64<N> transpose_zip_hi(const uint64<N>& a, const uint64<N>& b) { return zip2_hi(a, b); }
+
+// Loads the 128-bit lanes from p, p + stride, p + 2*stride, ...
+SIMDPP_INL uint8<16> transpose_load_lanes(const char* p, std::size_t,
+                                          uint8<16>*)
+{
+    return load_u(p);
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> transpose_load_lanes(const char* p, std::size_t stride, uint8<N>*)
+{
+    uint8<N/2> a = transpose_load_lanes(p, stride, (uint8<N/2>*) nullptr);
+    uint8<N/2> b = transpose_load_lanes(p + N / 32 * stride, stride,
+                                        (uint8<N/2>*) nullptr);
+    return combine(a, b);
+}
+
+/*  Transposes a tile of elements of S bytes using vectors of B bytes. The
+    strides are in bytes. If Stream is true, the destination rows must be
+    aligned to B bytes.
+*/
+template<unsigned S, unsigned B, bool Stream> SIMDPP_INL
+void transpose_tile(const char* src, char* dst,
+                    std::size_t src_stride, std::size_t dst_stride)
+{
+    using V = typename transpose_vec<S, B>::type;
+    const unsigned K = 16 / S;
+
+    V r[K], t[K];
+    for (unsigned i = 0; i < K; ++i) {
+        r[i] = (V) transpose_load_lanes(src + i * src_stride, K * src_stride,
+                                        (uint8<B>*) nullptr);
+    }
+    /*  Each step interleaves the rows i and i + K/2. After log2(K) steps the
+        lanes are transposed and the rows are in order.
+    */
+    for (unsigned step = 1; step < K; step *= 2) {
+        for (unsigned j = 0; j < K / 2; ++j) {
+            t[2*j] = transpose_zip_lo(r[j], r[j + K/2]);
+            t[2*j + 1] = transpose_zip_hi(r[j], r[j + K/2]);
+        }
+        for (unsigned j = 0; j < K; ++j) {
+            r[j] = t[j];
+        }
+    }
+    for (unsigned i = 0; i < K; ++i) {
+        if (Stream)
+            stream(dst + i * dst_stride, r[i]);
+        else
+            store_u(dst + i * dst_stride, r[i]);
+    }
+}
+
+template<class U> SIMDPP_INL
+void transpose_scalar(const U* src, U* dst,
+                      std::size_t r0, std::size_t r1,
+                      std::size_t c0, std::size_t c1,
+                      std::size_t src_stride, std::size_t dst_stride)
+{
+    for (std::size_t r = r0; r < r1; ++r) {
+        for (std::size_t c = c0; c < c1; ++c) {
+            dst[c * dst_stride + r] = src[r * src_stride + c];
+        }
+    }
+}
+
+/*  The matrix is processed in square blocks of about 16 KiB of source data,
+    so that both the source and the destination lines of a block stay in the
+    L1 cache while the block is transposed. The size is a multiple of the
+    tile height for all vector sizes.
+*/
+template<class U> SIMDPP_INL
+std::size_t transpose_block_size()
+{
+    return sizeof(U) == 1 ? 128 : sizeof(U) == 8 ? 32 : 64;
+}
+
+/*  Transposes the rows x cols matrix of elements of type U. The strides are
+    in elements. If Stream is true, the destination and its stride must be
+    aligned to the vector size.
+*/
+template<class U, bool Stream> SIMDPP_INL
+void transpose_blocked(const U* src, U* dst,
+                       std::size_t rows, std::size_t cols,
+                       std::size_t src_stride, std::size_t dst_stride)
+{
+    const unsigned S = sizeof(U);
+    const unsigned B = uint32v::length_bytes;
+    const std::size_t K = 16 / S;           // tile width
+    const std::size_t H = K * (B / 16);     // tile height
+    const std::size_t bs = transpose_block_size<U>();
+    const std::size_t ss = src_stride * S;
+    const std::size_t ds = dst_stride * S;
+
+    for (std::size_t r0 = 0; r0 < rows; r0 += bs) {
+        std::size_t r1 = r0 + bs < rows ? r0 + bs : rows;
+        for (std::size_t c0 = 0; c0 < cols; c0 += bs) {
+            std::size_t c1 = c0 + bs < cols ? c0 + bs : cols;
+            std::size_t ce = c0 + (c1 - c0) / K * K;
+
+            std::size_t r = r0;
+            for (; r + H <= r1; r += H) {
+                for (std::size_t c = c0; c < ce; c += K) {
+                    transpose_tile<S, B, Stream>(
+                            reinterpret_cast<const char*>(src + r * src_stride + c),
+                            reinterpret_cast<char*>(dst + c * dst_stride + r),
+                            ss, ds);
+                }
+            }
+            // the remaining rows are processed using 128-bit tiles
+            for (; r + K <= r1; r += K) {
+                for (std::size_t c = c0; c < ce; c += K) {
+                    transpose_tile<S, 16, Stream>(
+                            reinterpret_cast<const char*>(src + r * src_stride + c),
+                            reinterpret_cast<char*>(dst + c * dst_stride + r),
+                            ss, ds);
+                }
+            }
+            transpose_scalar(src, dst, r, r1, c0, c1, src_stride, dst_stride);
+            transpose_scalar(src, dst, r0, r, ce, c1, src_stride, dst_stride);
+        }
+    }
+    if (Stream)
+        stream_fence();
+}
+
+} // namespace algorithm
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
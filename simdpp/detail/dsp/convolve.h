@@ -0,0 +1,158 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_DSP_CONVOLVE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_DSP_CONVOLVE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_dot_acc.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/load_splat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/dsp/fir.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace dsp {
+
+/*  Computes dst[c] = sum(g[v] * rows[v][c]) for v in [0, k) and c in
+    [0, cols). This is the vertical pass of a separable convolution.
+*/
+SIMDPP_INL void convolve_rows(const float* const* rows, const float* g,
+                              std::size_t k, float* dst, std::size_t cols)
+{
+    std::size_t c = 0;
+
+#if !SIMDPP_USE_NULL
+    using math::mul_add;
+    const unsigned L = float32v::length;
+    for (; c + 4 * L <= cols; c += 4 * L) {
+        float32v a0 = make_zero(), a1 = make_zero(), a2 = make_zero(), a3 = make_zero();
+        for (std::size_t v = 0; v < k; ++v) {
+            const float* r = rows[v] + c;
+            float32v w = load_splat(g + v);
+            a0 = mul_add(w, float32v(load_u(r)), a0);
+            a1 = mul_add(w, float32v(load_u(r + L)), a1);
+            a2 = mul_add(w, float32v(load_u(r + 2 * L)), a2);
+            a3 = mul_add(w, float32v(load_u(r + 3 * L)), a3);
+        }
+        store_u(dst + c, a0);
+        store_u(dst + c + L, a1);
+        store_u(dst + c + 2 * L, a2);
+        store_u(dst + c + 3 * L, a3);
+    }
+    for (; c + L <= cols; c += L) {
+        float32v a0 = make_zero();
+        for (std::size_t v = 0; v < k; ++v) {
+            float32v w = load_splat(g + v);
+            a0 = mul_add(w, float32v(load_u(rows[v] + c)), a0);
+        }
+        store_u(dst + c, a0);
+    }
+#endif
+    for (; c < cols; ++c) {
+        float r = 0;
+        for (std::size_t v = 0; v < k; ++v)
+            r += g[v] * rows[v][c];
+        dst[c] = r;
+    }
+}
+
+/*  The fixed-point version requires k to be even and g to be aligned to 4
+    bytes. The elements of two rows are interleaved into pairs by 32-bit
+    masks and shifts, separately for the even and the odd columns, so that
+    dot_acc_i16() multiplies them by the pair of coefficients of the rows.
+*/
+SIMDPP_INL void convolve_rows(const int16_t* const* rows, const int16_t* g,
+                              std::size_t k, int16_t* dst, std::size_t cols)
+{
+    std::size_t c = 0;
+
+#if !SIMDPP_USE_NULL
+    const unsigned L = int16v::length;
+    uint32v mask_lo = make_uint(0x0000ffff);
+    uint32v mask_hi = make_uint(0xffff0000);
+    for (; c + L <= cols; c += L) {
+        int32v e = make_zero(), o = make_zero();
+        for (std::size_t v = 0; v < k; v += 2) {
+            uint32v a = uint32v(load_u(rows[v] + c));
+            uint32v b = uint32v(load_u(rows[v + 1] + c));
+            int16v even = int16v(bit_or(bit_and(a, mask_lo), shift_l<16>(b)));
+            int16v odd = int16v(bit_or(shift_r<16>(a), bit_and(b, mask_hi)));
+            int16v w = fir_q15_coef_pair(g + v);
+            e = dot_acc_i16(e, even, w);
+            o = dot_acc_i16(o, odd, w);
+        }
+        store_u(dst + c, fir_q15_merge(fir_q15_narrow(e), fir_q15_narrow(o)));
+    }
+#endif
+    for (; c < cols; ++c) {
+        int32_t r = 0;
+        for (std::size_t v = 0; v < k; ++v)
+            r += int32_t(g[v]) * rows[v][c];
+        dst[c] = fir_q15_narrow(r);
+    }
+}
+
+/*  The rows of the source are filtered horizontally into a ring buffer that
+    holds the last ky rows, then each output row is computed from the rows in
+    the buffer. Thus the intermediate data stays in the cache even for large
+    images.
+*/
+template<class T> SIMDPP_INL
+void convolve_separable(const T* src, std::size_t rows, std::size_t cols,
+                        std::size_t src_stride,
+                        const T* kx, std::size_t kx_size,
+                        const T* ky, std::size_t ky_size,
+                        T* dst, std::size_t dst_stride)
+{
+    if (kx_size == 0 || ky_size == 0 || rows < ky_size || cols < kx_size)
+        return;
+    std::size_t out_cols = cols - kx_size + 1;
+
+    dsp_buffer<T> gx, gy;
+    fir_reverse(kx, kx_size, fir_pad<T>(), gx);
+    fir_reverse(ky, ky_size, fir_pad<T>(), gy);
+
+    dsp_buffer<T> ring(ky_size * out_cols);
+    // the padding coefficients are zero, thus any row may be used for them
+    std::vector<const T*> rp(gy.size(), ring.data());
+
+    for (std::size_t r = 0; r < rows; ++r) {
+        fir_phase<T> ph = { src + r * src_stride, cols, gx.data(), gx.size() };
+        fir_run(&ph, 1, ring.data() + r % ky_size * out_cols, out_cols);
+        if (r + 1 < ky_size)
+            continue;
+
+        std::size_t o = r + 1 - ky_size;
+        for (std::size_t v = 0; v < ky_size; ++v)
+            rp[v] = ring.data() + (o + v) % ky_size * out_cols;
+        convolve_rows(rp.data(), gy.data(), gy.size(), dst + o * dst_stride,
+                      out_cols);
+    }
+}
+
+} // namespace dsp
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
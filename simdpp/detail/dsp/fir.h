@@ -0,0 +1,286 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_DSP_FIR_H
+#define LIBSIMDPP_SIMDPP_DETAIL_DSP_FIR_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <simdpp/types.h>
+#include <simdpp/core/aligned_allocator.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_dot_acc.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/load_splat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace dsp {
+
+/*  The filters are computed in the correlation form
+
+        y[i] = sum(g[t] * x[i + t]) for t in [0, taps)
+
+    where g holds the coefficients in reverse order. A block of consecutive
+    outputs is computed by broadcasting each coefficient and multiplying it
+    by the window of x loaded at the offset of the tap, thus the inputs are
+    read with unaligned loads and no shuffles are needed.
+
+    A decimating filter is split into phases: the phase p of the input holds
+    the elements x[m * factor + p] and the phase p of the filter holds the
+    coefficients g[q * factor + p]. The output is the sum of the undecimated
+    filters applied to each phase.
+*/
+template<class T>
+struct fir_phase {
+    const T* x;         // input
+    std::size_t size;   // the number of readable elements of x
+    const T* g;         // coefficients in reverse order
+    std::size_t taps;   // the number of coefficients
+};
+
+template<class T>
+using dsp_buffer = std::vector<T, aligned_allocator<T, 64>>;
+
+/*  Computes count outputs of a floating-point filter consisting of the given
+    phases. x of each phase must hold at least count + taps - 1 elements.
+*/
+SIMDPP_INL void fir_run(const fir_phase<float>* ph, unsigned phases,
+                        float* y, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if !SIMDPP_USE_NULL
+    using math::mul_add;
+    const unsigned L = float32v::length;
+    // four blocks of outputs share each broadcast coefficient
+    for (; i + 4 * L <= count; i += 4 * L) {
+        float32v a0 = make_zero(), a1 = make_zero(), a2 = make_zero(), a3 = make_zero();
+        for (unsigned p = 0; p < phases; ++p) {
+            const float* x = ph[p].x + i;
+            const float* g = ph[p].g;
+            for (std::size_t t = 0; t < ph[p].taps; ++t) {
+                float32v c = load_splat(g + t);
+                a0 = mul_add(c, float32v(load_u(x + t)), a0);
+                a1 = mul_add(c, float32v(load_u(x + t + L)), a1);
+                a2 = mul_add(c, float32v(load_u(x + t + 2 * L)), a2);
+                a3 = mul_add(c, float32v(load_u(x + t + 3 * L)), a3);
+            }
+        }
+        store_u(y + i, a0);
+        store_u(y + i + L, a1);
+        store_u(y + i + 2 * L, a2);
+        store_u(y + i + 3 * L, a3);
+    }
+    for (; i + L <= count; i += L) {
+        float32v a0 = make_zero();
+        for (unsigned p = 0; p < phases; ++p) {
+            const float* x = ph[p].x + i;
+            const float* g = ph[p].g;
+            for (std::size_t t = 0; t < ph[p].taps; ++t) {
+                float32v c = load_splat(g + t);
+                a0 = mul_add(c, float32v(load_u(x + t)), a0);
+            }
+        }
+        store_u(y + i, a0);
+    }
+#endif
+    for (; i < count; ++i) {
+        float r = 0;
+        for (unsigned p = 0; p < phases; ++p) {
+            for (std::size_t t = 0; t < ph[p].taps; ++t)
+                r += ph[p].g[t] * ph[p].x[i + t];
+        }
+        y[i] = r;
+    }
+}
+
+/*  The fixed-point filters use Q15 coefficients and accumulate the products
+    in 32 bits. The result is rounded to nearest and saturated to 16 bits.
+*/
+SIMDPP_INL int16_t fir_q15_narrow(int32_t acc)
+{
+    int32_t r = (acc + (1 << 14)) >> 15;
+    return int16_t(r < -32768 ? -32768 : r > 32767 ? 32767 : r);
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> fir_q15_narrow(const int32<N>& acc)
+{
+    int32<N> r = shift_r<15>(add(acc, int32<N>(make_int(1 << 14))));
+    r = max(r, int32<N>(make_int(-32768)));
+    return min(r, int32<N>(make_int(32767)));
+}
+
+/*  Merges the results for the even elements, held in e, and for the odd
+    elements, held in o, into a vector of 16-bit elements. The 32-bit
+    elements of e and o must be in the range of 16-bit integers.
+*/
+template<unsigned N> SIMDPP_INL
+int16<N*2> fir_q15_merge(const int32<N>& e, const int32<N>& o)
+{
+    int32<N> lo = bit_and(e, int32<N>(make_int(0xffff)));
+    return int16<N*2>(bit_or(lo, shift_l<16>(o)));
+}
+
+/*  Returns the coefficients g[t] and g[t + 1] in each pair of 16-bit
+    elements
+*/
+SIMDPP_INL int16v fir_q15_coef_pair(const int16_t* g)
+{
+    return int16v(int32v(load_splat(reinterpret_cast<const int32_t*>(g))));
+}
+
+/*  Computes count outputs of a fixed-point filter consisting of the given
+    phases. The coefficients of each phase are padded with zeros to an even
+    number of taps and g must be aligned to 4 bytes. x of each phase must
+    hold at least count + taps - 1 elements, where taps is the unpadded
+    number of coefficients.
+
+    The products of two adjacent coefficients are summed by dot_acc_i16().
+    The even outputs pair x[i + t] with x[i + t + 1] directly in the loaded
+    window, the odd outputs use the window loaded one element later.
+*/
+SIMDPP_INL void fir_run(const fir_phase<int16_t>* ph, unsigned phases,
+                        int16_t* y, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if !SIMDPP_USE_NULL
+    const unsigned L = int16v::length;
+    // the padded coefficient must not cause a read past the end of x
+    std::size_t vcount = count;
+    for (unsigned p = 0; p < phases; ++p) {
+        if (ph[p].taps == 0)
+            continue;
+        std::size_t avail = ph[p].size + 1 < ph[p].taps ? 0 : ph[p].size + 1 - ph[p].taps;
+        if (avail < vcount)
+            vcount = avail;
+    }
+    for (; i + L <= vcount; i += L) {
+        int32v e = make_zero(), o = make_zero();
+        for (unsigned p = 0; p < phases; ++p) {
+            const int16_t* x = ph[p].x + i;
+            const int16_t* g = ph[p].g;
+            for (std::size_t t = 0; t < ph[p].taps; t += 2) {
+                int16v c = fir_q15_coef_pair(g + t);
+                e = dot_acc_i16(e, int16v(load_u(x + t)), c);
+                o = dot_acc_i16(o, int16v(load_u(x + t + 1)), c);
+            }
+        }
+        store_u(y + i, fir_q15_merge(fir_q15_narrow(e), fir_q15_narrow(o)));
+    }
+#endif
+    for (; i < count; ++i) {
+        int32_t r = 0;
+        for (unsigned p = 0; p < phases; ++p) {
+            for (std::size_t t = 0; t < ph[p].taps && i + t < ph[p].size; ++t)
+                r += int32_t(ph[p].g[t]) * ph[p].x[i + t];
+        }
+        y[i] = fir_q15_narrow(r);
+    }
+}
+
+// Reverses the coefficients and pads them with zeros to a multiple of pad
+template<class T> SIMDPP_INL
+void fir_reverse(const T* h, std::size_t taps, std::size_t pad,
+                 dsp_buffer<T>& g)
+{
+    g.assign((taps + pad - 1) / pad * pad, T(0));
+    for (std::size_t t = 0; t < taps; ++t)
+        g[t] = h[taps - 1 - t];
+}
+
+template<class T> SIMDPP_INL
+std::size_t fir_pad() { return 1; }
+template<> SIMDPP_INL
+std::size_t fir_pad<int16_t>() { return 2; }
+
+template<class T> SIMDPP_INL
+std::size_t fir(const T* x, std::size_t n, const T* h, std::size_t taps, T* y)
+{
+    if (taps == 0 || n < taps)
+        return 0;
+    dsp_buffer<T> g;
+    fir_reverse(h, taps, fir_pad<T>(), g);
+    fir_phase<T> ph = { x, n, g.data(), g.size() };
+    std::size_t count = n - taps + 1;
+    fir_run(&ph, 1, y, count);
+    return count;
+}
+
+/*  The input is split into phases in chunks of outputs, so that the phase
+    buffers stay in the cache.
+*/
+template<class T> SIMDPP_INL
+std::size_t fir_decimate(const T* x, std::size_t n, const T* h,
+                         std::size_t taps, std::size_t factor, T* y)
+{
+    if (taps == 0 || n < taps || factor == 0)
+        return 0;
+    std::size_t count = (n - taps) / factor + 1;
+    if (factor == 1)
+        return fir(x, n, h, taps, y);
+
+    dsp_buffer<T> g;
+    fir_reverse(h, taps, 1, g);
+
+    const std::size_t chunk = 1024;
+    std::size_t phases = factor < taps ? factor : taps;
+    std::vector<fir_phase<T>> ph(phases);
+    std::vector<dsp_buffer<T>> xs(phases), gs(phases);
+    std::size_t max_taps = (taps + factor - 1) / factor;
+    for (std::size_t p = 0; p < phases; ++p) {
+        std::size_t tp = (taps - p + factor - 1) / factor;
+        gs[p].assign((tp + fir_pad<T>() - 1) / fir_pad<T>() * fir_pad<T>(), T(0));
+        for (std::size_t q = 0; q < tp; ++q)
+            gs[p][q] = g[q * factor + p];
+        xs[p].resize(chunk + max_taps);
+        ph[p].g = gs[p].data();
+        ph[p].taps = gs[p].size();
+        ph[p].x = xs[p].data();
+    }
+
+    for (std::size_t i = 0; i < count; i += chunk) {
+        std::size_t cc = count - i < chunk ? count - i : chunk;
+        for (std::size_t p = 0; p < phases; ++p) {
+            // the elements x[(i + m) * factor + p] that exist in the input
+            std::size_t first = i * factor + p;
+            std::size_t avail = (n - first + factor - 1) / factor;
+            std::size_t size = cc + max_taps < avail ? cc + max_taps : avail;
+            const T* src = x + first;
+            T* dst = xs[p].data();
+            for (std::size_t m = 0; m < size; ++m)
+                dst[m] = src[m * factor];
+            ph[p].size = size;
+        }
+        fir_run(ph.data(), unsigned(phases), y + i, cc);
+    }
+    return count;
+}
+
+} // namespace dsp
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -188,16 +188,8 @@ mask_int64x2 i_cmp_neq(const uint64x2& a, const uint64x2& b)
 {
 #if SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
     return _mm_comneq_epi64(a.native(), b.native());
-#elif SIMDPP_USE_SSE4_1 || SIMDPP_USE_NEON || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
     return bit_not(cmp_eq(a, b));
-#elif SIMDPP_USE_SSE2
-    uint64x2 r32, r32s;
-    r32 = (uint32x4)cmp_eq(uint32x4(a), uint32x4(b));
-    // swap the 32-bit halves
-    r32s = bit_or(shift_l<32>(r32), shift_r<32>(r32));
-    // combine the results. Each 32-bit half is ORed with the neighbouring pair
-    r32 = bit_or(r32, r32s);
-    return r32;
 #elif SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
     return detail::null::cmp_neq(a, b);
 #endif
@@ -0,0 +1,498 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/load.h>
+#include <simdpp/detail/insn/extract_bits.h>
+#include <simdpp/detail/insn/permute_zbytes16.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The emulation of compress and expand on instruction sets without native
+    support is based on lookup tables indexed by the bits of the mask, one bit
+    per 32-bit lane. 64-bit lanes are handled as pairs of 32-bit lanes.
+
+    The 128-bit tables contain byte shuffle masks suitable for
+    permute_zbytes16, the 256-bit tables contain 8 packed 4-bit lane indices
+    suitable for _mm256_permutevar8x32_epi32.
+*/
+SIMDPP_INL const uint8_t* compress_lut_bytes16()
+{
+    SIMDPP_ALIGN(16) static const uint8_t lut[256] = {
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x04,0x05,0x06,0x07,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x08,0x09,0x0a,0x0b,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x08,0x09,0x0a,0x0b,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x08,0x09,0x0a,0x0b,0x80,0x80,0x80,0x80,
+        0x0c,0x0d,0x0e,0x0f,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x0c,0x0d,0x0e,0x0f,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x04,0x05,0x06,0x07,0x0c,0x0d,0x0e,0x0f,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x0c,0x0d,0x0e,0x0f,0x80,0x80,0x80,0x80,
+        0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x08,0x09,0x0a,0x0b,
+        0x0c,0x0d,0x0e,0x0f,0x80,0x80,0x80,0x80,
+        0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,
+        0x0c,0x0d,0x0e,0x0f,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
+    };
+    return lut;
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL const uint32_t* compress_lut_perm8()
+{
+    static const uint32_t lut[256] = {
+        0x00000000, 0x00000000, 0x00000001, 0x00000010,
+        0x00000002, 0x00000020, 0x00000021, 0x00000210,
+        0x00000003, 0x00000030, 0x00000031, 0x00000310,
+        0x00000032, 0x00000320, 0x00000321, 0x00003210,
+        0x00000004, 0x00000040, 0x00000041, 0x00000410,
+        0x00000042, 0x00000420, 0x00000421, 0x00004210,
+        0x00000043, 0x00000430, 0x00000431, 0x00004310,
+        0x00000432, 0x00004320, 0x00004321, 0x00043210,
+        0x00000005, 0x00000050, 0x00000051, 0x00000510,
+        0x00000052, 0x00000520, 0x00000521, 0x00005210,
+        0x00000053, 0x00000530, 0x00000531, 0x00005310,
+        0x00000532, 0x00005320, 0x00005321, 0x00053210,
+        0x00000054, 0x00000540, 0x00000541, 0x00005410,
+        0x00000542, 0x00005420, 0x00005421, 0x00054210,
+        0x00000543, 0x00005430, 0x00005431, 0x00054310,
+        0x00005432, 0x00054320, 0x00054321, 0x00543210,
+        0x00000006, 0x00000060, 0x00000061, 0x00000610,
+        0x00000062, 0x00000620, 0x00000621, 0x00006210,
+        0x00000063, 0x00000630, 0x00000631, 0x00006310,
+        0x00000632, 0x00006320, 0x00006321, 0x00063210,
+        0x00000064, 0x00000640, 0x00000641, 0x00006410,
+        0x00000642, 0x00006420, 0x00006421, 0x00064210,
+        0x00000643, 0x00006430, 0x00006431, 0x00064310,
+        0x00006432, 0x00064320, 0x00064321, 0x00643210,
+        0x00000065, 0x00000650, 0x00000651, 0x00006510,
+        0x00000652, 0x00006520, 0x00006521, 0x00065210,
+        0x00000653, 0x00006530, 0x00006531, 0x00065310,
+        0x00006532, 0x00065320, 0x00065321, 0x00653210,
+        0x00000654, 0x00006540, 0x00006541, 0x00065410,
+        0x00006542, 0x00065420, 0x00065421, 0x00654210,
+        0x00006543, 0x00065430, 0x00065431, 0x00654310,
+        0x00065432, 0x00654320, 0x00654321, 0x06543210,
+        0x00000007, 0x00000070, 0x00000071, 0x00000710,
+        0x00000072, 0x00000720, 0x00000721, 0x00007210,
+        0x00000073, 0x00000730, 0x00000731, 0x00007310,
+        0x00000732, 0x00007320, 0x00007321, 0x00073210,
+        0x00000074, 0x00000740, 0x00000741, 0x00007410,
+        0x00000742, 0x00007420, 0x00007421, 0x00074210,
+        0x00000743, 0x00007430, 0x00007431, 0x00074310,
+        0x00007432, 0x00074320, 0x00074321, 0x00743210,
+        0x00000075, 0x00000750, 0x00000751, 0x00007510,
+        0x00000752, 0x00007520, 0x00007521, 0x00075210,
+        0x00000753, 0x00007530, 0x00007531, 0x00075310,
+        0x00007532, 0x00075320, 0x00075321, 0x00753210,
+        0x00000754, 0x00007540, 0x00007541, 0x00075410,
+        0x00007542, 0x00075420, 0x00075421, 0x00754210,
+        0x00007543, 0x00075430, 0x00075431, 0x00754310,
+        0x00075432, 0x00754320, 0x00754321, 0x07543210,
+        0x00000076, 0x00000760, 0x00000761, 0x00007610,
+        0x00000762, 0x00007620, 0x00007621, 0x00076210,
+        0x00000763, 0x00007630, 0x00007631, 0x00076310,
+        0x00007632, 0x00076320, 0x00076321, 0x00763210,
+        0x00000764, 0x00007640, 0x00007641, 0x00076410,
+        0x00007642, 0x00076420, 0x00076421, 0x00764210,
+        0x00007643, 0x00076430, 0x00076431, 0x00764310,
+        0x00076432, 0x00764320, 0x00764321, 0x07643210,
+        0x00000765, 0x00007650, 0x00007651, 0x00076510,
+        0x00007652, 0x00076520, 0x00076521, 0x00765210,
+        0x00007653, 0x00076530, 0x00076531, 0x00765310,
+        0x00076532, 0x00765320, 0x00765321, 0x07653210,
+        0x00007654, 0x00076540, 0x00076541, 0x00765410,
+        0x00076542, 0x00765420, 0x00765421, 0x07654210,
+        0x00076543, 0x00765430, 0x00765431, 0x07654310,
+        0x00765432, 0x07654320, 0x07654321, 0x76543210,
+    };
+    return lut;
+}
+#endif
+
+// Counts the set bits of a lane mask of at most 16 bits. Note that the unused
+// bits of AVX-512 masks for vectors with less than 8 elements may be set.
+static SIMDPP_INL
+unsigned i_compress_popcnt(unsigned m)
+{
+    m = m - ((m >> 1) & 0x5555);
+    m = (m & 0x3333) + ((m >> 2) & 0x3333);
+    m = (m + (m >> 4)) & 0x0f0f;
+    return (m + (m >> 8)) & 0x1f;
+}
+
+// Returns one bit per 32-bit lane of a mask that has been converted to vector
+static SIMDPP_INL
+unsigned i_compress_lane_bits(const uint32<4>& m)
+{
+#if SIMDPP_USE_NULL
+    unsigned r = 0;
+    for (unsigned i = 0; i < m.length; i++) {
+        r |= (m.el(i) ? 1 : 0) << i;
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_ps(_mm_castsi128_ps(m.native()));
+#else
+    unsigned b = i_extract_bits_any(uint8<16>(m));
+    return (b & 1) | ((b >> 3) & 2) | ((b >> 6) & 4) | ((b >> 9) & 8);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_compress_lane_bits(const uint32<8>& m)
+{
+    return _mm256_movemask_ps(_mm256_castsi256_ps(m.native()));
+}
+#endif
+
+#if SIMDPP_USE_AVX2
+// Compresses 32-bit lanes of a according to one bit per lane in m
+static SIMDPP_INL
+uint32<8> i_compress_perm8(const uint32<8>& a, unsigned m)
+{
+    __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    __m256i ids = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i idx = _mm256_srlv_epi32(_mm256_set1_epi32(compress_lut_perm8()[m]), shifts);
+    __m256i r = _mm256_permutevar8x32_epi32(a.native(), idx);
+    __m256i count = _mm256_set1_epi32(i_compress_popcnt(m));
+    return _mm256_and_si256(r, _mm256_cmpgt_epi32(count, ids));
+}
+#endif
+
+template<class V> SIMDPP_INL
+V i_compress_emul(const V& mask, const V& a)
+{
+    mem_block<V> ma(a), mm(mask), mr;
+    unsigned j = 0;
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (mm[i])
+            mr[j++] = ma[i];
+    }
+    for (; j < V::length; ++j) {
+        mr[j] = 0;
+    }
+    return mr;
+}
+
+// -----------------------------------------------------------------------------
+// Returns the number of set lanes in the mask
+
+static SIMDPP_INL
+unsigned i_compress_count(const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_compress_popcnt(mask.native() & 0xf);
+#else
+    return i_compress_popcnt(i_compress_lane_bits(mask.unmask()));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_compress_count(const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_compress_popcnt(mask.native());
+#else
+    return i_compress_popcnt(i_compress_lane_bits(mask.unmask()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_compress_count(const mask_int32<16>& mask)
+{
+    return i_compress_popcnt(mask.native());
+}
+#endif
+
+static SIMDPP_INL
+unsigned i_compress_count(const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_compress_popcnt(mask.native() & 0x3);
+#elif SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    mem_block<uint64<2>> m(mask.unmask());
+    return (m[0] ? 1 : 0) + (m[1] ? 1 : 0);
+#else
+    return i_compress_popcnt(i_compress_lane_bits(uint32<4>(mask.unmask()))) / 2;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_compress_count(const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return i_compress_popcnt(mask.native() & 0xf);
+#else
+    return i_compress_popcnt(i_compress_lane_bits(uint32<8>(mask.unmask()))) / 2;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_compress_count(const mask_int64<8>& mask)
+{
+    return i_compress_popcnt(mask.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+unsigned i_compress_count(const mask_int32<N>& mask)
+{
+    unsigned r = 0;
+    for (unsigned i = 0; i < mask.vec_length; ++i) {
+        r += i_compress_count(mask.vec(i));
+    }
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+unsigned i_compress_count(const mask_int64<N>& mask)
+{
+    unsigned r = 0;
+    for (unsigned i = 0; i < mask.vec_length; ++i) {
+        r += i_compress_count(mask.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_compress(const mask_int32<4>& mask, const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_maskz_compress_epi32(mask.native(), a.native());
+#elif SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_compress_emul(mask.unmask(), a);
+#else
+    unsigned m = i_compress_lane_bits(mask.unmask());
+    uint8<16> sh = load(compress_lut_bytes16() + m*16);
+    return uint32<4>(i_permute_zbytes16(uint8<16>(a), sh));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_compress(const mask_int32<8>& mask, const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_compress_epi32(mask.native(), a.native());
+#else
+    return i_compress_perm8(a, i_compress_lane_bits(mask.unmask()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_compress(const mask_int32<16>& mask, const uint32<16>& a)
+{
+    return _mm512_maskz_compress_epi32(mask.native(), a.native());
+}
+#endif
+
+static SIMDPP_INL
+uint64<2> i_compress(const mask_int64<2>& mask, const uint64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_maskz_compress_epi64(mask.native(), a.native());
+#elif SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3) || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    return i_compress_emul(mask.unmask(), a);
+#else
+    // each 64-bit lane sets two bits
+    unsigned m = i_compress_lane_bits(uint32<4>(mask.unmask()));
+    uint8<16> sh = load(compress_lut_bytes16() + m*16);
+    return uint64<2>(i_permute_zbytes16(uint8<16>(a), sh));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_compress(const mask_int64<4>& mask, const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_compress_epi64(mask.native(), a.native());
+#else
+    // each 64-bit lane sets two bits
+    unsigned m = i_compress_lane_bits(uint32<8>(mask.unmask()));
+    return uint64<4>(i_compress_perm8(uint32<8>(a), m));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_compress(const mask_int64<8>& mask, const uint64<8>& a)
+{
+    return _mm512_maskz_compress_epi64(mask.native(), a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const mask_int32<4>& mask, const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native() & 0xf);
+#else
+    unsigned n = i_compress_count(mask);
+    mem_block<uint32<4>> r(i_compress(mask, a));
+    std::memcpy(p, r.data(), n * 4);
+    return n;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const mask_int32<8>& mask, const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+#else
+    unsigned n = i_compress_count(mask);
+    mem_block<uint32<8>> r(i_compress(mask, a));
+    std::memcpy(p, r.data(), n * 4);
+    return n;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const mask_int32<16>& mask, const uint32<16>& a)
+{
+    _mm512_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+#endif
+
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const mask_int64<2>& mask, const uint64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native() & 0x3);
+#else
+    unsigned n = i_compress_count(mask);
+    mem_block<uint64<2>> r(i_compress(mask, a));
+    std::memcpy(p, r.data(), n * 8);
+    return n;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const mask_int64<4>& mask, const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native() & 0xf);
+#else
+    unsigned n = i_compress_count(mask);
+    mem_block<uint64<4>> r(i_compress(mask, a));
+    std::memcpy(p, r.data(), n * 8);
+    return n;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_compress_store_u(char* p, const mask_int64<8>& mask, const uint64<8>& a)
+{
+    _mm512_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return i_compress_popcnt(mask.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+unsigned i_compress_store_u(char* p, const mask_int32<N>& mask, const uint32<N>& a)
+{
+    char* pi = p;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        pi += i_compress_store_u(pi, mask.vec(i), a.vec(i)) * 4;
+    }
+    return (pi - p) / 4;
+}
+
+template<unsigned N> SIMDPP_INL
+unsigned i_compress_store_u(char* p, const mask_int64<N>& mask, const uint64<N>& a)
+{
+    char* pi = p;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        pi += i_compress_store_u(pi, mask.vec(i), a.vec(i)) * 8;
+    }
+    return (pi - p) / 8;
+}
+
+// Elements are compressed within each native vector and then packed together
+// through memory.
+template<unsigned N> SIMDPP_INL
+uint32<N> i_compress(const mask_int32<N>& mask, const uint32<N>& a)
+{
+    uint32<N> zero = make_zero();
+    mem_block<uint32<N>> r(zero);
+    i_compress_store_u(reinterpret_cast<char*>(&r[0]), mask, a);
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_compress(const mask_int64<N>& mask, const uint64<N>& a)
+{
+    uint64<N> zero = make_zero();
+    mem_block<uint64<N>> r(zero);
+    i_compress_store_u(reinterpret_cast<char*>(&r[0]), mask, a);
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,276 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/core/split.h>
+#include <simdpp/detail/insn/conv_extend_to_int32.h>
+#include <simdpp/detail/insn/conv_shrink_to_int16.h>
+#include <simdpp/detail/vector_array_conv_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Converts half-precision values to single precision using integer
+    operations. Denormal inputs are normalized via a floating-point subtraction.
+    Signaling NaNs are quieted, as the hardware conversion instructions do.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_emul_f16_to_float32(const uint16<N>& a)
+{
+    using U = uint32<N>;
+    using I = int32<N>;
+    const uint32_t shifted_exp = 0x7c00 << 13;
+
+    U u = i_to_uint32(a);
+    U em = bit_and(u, 0x7fff);
+    U sign = shift_l<16>(bit_and(u, 0x8000));
+    U o = shift_l<13>(em);
+    U exp = bit_and(o, shifted_exp);
+    o = add(o, (127 - 15) << 23);
+
+    // Inf and NaN: adjust the exponent once more, quiet the NaNs
+    mask_int32<N> is_infnan = cmp_eq(exp, shifted_exp);
+    mask_int32<N> is_nan = cmp_gt(I(em), 0x7c00);
+    U infnan = add(o, (128 - 16) << 23);
+    infnan = bit_or(infnan, blend(splat<U>(0x00400000), U(make_zero()), is_nan));
+    o = blend(infnan, o, is_infnan);
+
+    // zero and denormals: renormalize
+    mask_int32<N> is_denorm = cmp_eq(exp, 0);
+    float32<N> fd = float32<N>(add(o, 1 << 23));
+    fd = sub(fd, float32<N>(splat<U>(113 << 23)));
+    o = blend(U(fd), o, is_denorm);
+
+    o = bit_or(o, sign);
+    return float32<N>(o);
+}
+
+/*  Converts single-precision values to half precision using integer
+    operations. The values are rounded to nearest even. NaNs are quieted and
+    the upper bits of the payload are preserved, as the hardware conversion
+    instructions do.
+*/
+template<unsigned N> SIMDPP_INL
+uint16<N> v_emul_float32_to_f16(const float32<N>& a)
+{
+    using U = uint32<N>;
+    using I = int32<N>;
+    const uint32_t f16max = (127 + 16) << 23;
+    const uint32_t denorm_magic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+    U u; u = a;
+    U sign = bit_and(u, 0x80000000);
+    u = bit_xor(u, sign);
+
+    // normal values: adjust the exponent and round to nearest even
+    U mant_odd = bit_and(shift_r<13>(u), 1);
+    // 0xc8000fff == ((15 - 127) << 23) + 0xfff modulo 2^32
+    U n = add(u, 0xc8000fff);
+    n = add(n, mant_odd);
+    n = shift_r<13>(n);
+
+    // denormal results: align the mantissa using floating-point addition
+    float32<N> fd = add(float32<N>(u), float32<N>(splat<U>(denorm_magic)));
+    U d = sub(U(fd), denorm_magic);
+    n = blend(d, n, cmp_lt(I(u), int32_t(113 << 23)));
+
+    // overflow, Inf and NaN
+    U nan = bit_or(bit_and(shift_r<13>(u), 0x1ff), 0x7e00);
+    U infnan = blend(nan, splat<U>(0x7c00), cmp_gt(I(u), 0x7f800000));
+    n = blend(infnan, n, cmp_gt(I(u), int32_t(f16max - 1)));
+
+    n = bit_or(n, shift_r<16>(sign));
+    return i_to_uint16(n);
+}
+
+// bfloat16 values are the upper halves of single-precision values
+template<unsigned N> SIMDPP_INL
+float32<N> v_bf16_to_float32(const uint16<N>& a)
+{
+    uint32<N> u = i_to_uint32(a);
+    u = shift_l<16>(u);
+    return float32<N>(u);
+}
+
+/*  Rounds single-precision values to nearest even bfloat16 values. NaNs are
+    quieted instead of being rounded, as that could turn them into infinities.
+*/
+template<unsigned N> SIMDPP_INL
+uint16<N> v_float32_to_bf16(const float32<N>& a)
+{
+    using U = uint32<N>;
+    using I = int32<N>;
+
+    U u; u = a;
+    U r = add(u, bit_and(shift_r<16>(u), 1));
+    r = add(r, 0x7fff);
+    U nan = bit_or(u, 0x00400000);
+    U abs = bit_and(u, 0x7fffffff);
+    r = blend(nan, r, cmp_gt(I(abs), 0x7f800000));
+    r = shift_r<16>(r);
+    return i_to_uint16(r);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32<8> i_f16_to_float32(const uint16<8>& a)
+{
+#if SIMDPP_USE_F16C
+    return _mm256_cvtph_ps(a.native());
+#elif SIMDPP_USE_AVX512F
+    __m512 r = _mm512_cvtph_ps(_mm256_castsi128_si256(a.native()));
+    return _mm512_castps512_ps256(r);
+#elif SIMDPP_USE_NEON64
+    float32<8> r;
+    float16x4_t lo = vreinterpret_f16_u16(vget_low_u16(a.native()));
+    float16x4_t hi = vreinterpret_f16_u16(vget_high_u16(a.native()));
+    r.vec(0) = vcvt_f32_f16(lo);
+    r.vec(1) = vcvt_f32_f16(hi);
+    return r;
+#else
+    return v_emul_f16_to_float32(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+float32<16> i_f16_to_float32(const uint16<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtph_ps(a.native());
+#elif SIMDPP_USE_F16C
+    float32<16> r;
+    uint16<8> a0, a1;
+    split(a, a0, a1);
+    r.vec(0) = _mm256_cvtph_ps(a0.native());
+    r.vec(1) = _mm256_cvtph_ps(a1.native());
+    return r;
+#else
+    return v_emul_f16_to_float32(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+float32<32> i_f16_to_float32(const uint16<32>& a)
+{
+    float32<32> r;
+    uint16<16> a0, a1;
+    split(a, a0, a1);
+    r.vec(0) = _mm512_cvtph_ps(a0.native());
+    r.vec(1) = _mm512_cvtph_ps(a1.native());
+    return r;
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_f16_to_float32(const uint16<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_INSERT(float32<N>, i_f16_to_float32, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_float32_to_f16(const float32<8>& a)
+{
+#if SIMDPP_USE_F16C
+    return _mm256_cvtps_ph(a.native(), _MM_FROUND_TO_NEAREST_INT);
+#elif SIMDPP_USE_AVX512F
+    __m256i r = _mm512_cvtps_ph(_mm512_castps256_ps512(a.native()),
+                                _MM_FROUND_TO_NEAREST_INT);
+    return _mm256_castsi256_si128(r);
+#elif SIMDPP_USE_NEON64
+    float16x4_t lo = vcvt_f16_f32(a.vec(0).native());
+    float16x4_t hi = vcvt_f16_f32(a.vec(1).native());
+    return vcombine_u16(vreinterpret_u16_f16(lo), vreinterpret_u16_f16(hi));
+#else
+    return v_emul_float32_to_f16(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_float32_to_f16(const float32<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtps_ph(a.native(), _MM_FROUND_TO_NEAREST_INT);
+#elif SIMDPP_USE_F16C
+    uint16<8> r0, r1;
+    r0 = _mm256_cvtps_ph(a.vec(0).native(), _MM_FROUND_TO_NEAREST_INT);
+    r1 = _mm256_cvtps_ph(a.vec(1).native(), _MM_FROUND_TO_NEAREST_INT);
+    return combine(r0, r1);
+#else
+    return v_emul_float32_to_f16(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_float32_to_f16(const float32<32>& a)
+{
+    uint16<16> r0, r1;
+    r0 = _mm512_cvtps_ph(a.vec(0).native(), _MM_FROUND_TO_NEAREST_INT);
+    r1 = _mm512_cvtps_ph(a.vec(1).native(), _MM_FROUND_TO_NEAREST_INT);
+    return combine(r0, r1);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_float32_to_f16(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint16<N>, i_float32_to_f16, a)
+}
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_bf16_to_float32(const uint16<N>& a)
+{
+    return v_bf16_to_float32(a);
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_float32_to_bf16(const float32<N>& a)
+{
+    return v_float32_to_bf16(a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,272 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_EXPAND_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_EXPAND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/detail/insn/compress.h>
+#include <simdpp/detail/insn/permute_zbytes16.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// See the comment in compress.h for the layout of the lookup tables
+SIMDPP_INL const uint8_t* expand_lut_bytes16()
+{
+    SIMDPP_ALIGN(16) static const uint8_t lut[256] = {
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x00,0x01,0x02,0x03,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x80,
+        0x04,0x05,0x06,0x07,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x00,0x01,0x02,0x03,
+        0x04,0x05,0x06,0x07,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x08,0x09,0x0a,0x0b,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x00,0x01,0x02,0x03,
+        0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x04,0x05,0x06,0x07,
+        0x80,0x80,0x80,0x80,0x00,0x01,0x02,0x03,
+        0x80,0x80,0x80,0x80,0x04,0x05,0x06,0x07,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x80,0x80,0x80,0x80,0x08,0x09,0x0a,0x0b,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x80,
+        0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,
+        0x80,0x80,0x80,0x80,0x00,0x01,0x02,0x03,
+        0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
+    };
+    return lut;
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL const uint32_t* expand_lut_perm8()
+{
+    static const uint32_t lut[256] = {
+        0x00000000, 0x00000000, 0x00000000, 0x00000010,
+        0x00000000, 0x00000100, 0x00000100, 0x00000210,
+        0x00000000, 0x00001000, 0x00001000, 0x00002010,
+        0x00001000, 0x00002100, 0x00002100, 0x00003210,
+        0x00000000, 0x00010000, 0x00010000, 0x00020010,
+        0x00010000, 0x00020100, 0x00020100, 0x00030210,
+        0x00010000, 0x00021000, 0x00021000, 0x00032010,
+        0x00021000, 0x00032100, 0x00032100, 0x00043210,
+        0x00000000, 0x00100000, 0x00100000, 0x00200010,
+        0x00100000, 0x00200100, 0x00200100, 0x00300210,
+        0x00100000, 0x00201000, 0x00201000, 0x00302010,
+        0x00201000, 0x00302100, 0x00302100, 0x00403210,
+        0x00100000, 0x00210000, 0x00210000, 0x00320010,
+        0x00210000, 0x00320100, 0x00320100, 0x00430210,
+        0x00210000, 0x00321000, 0x00321000, 0x00432010,
+        0x00321000, 0x00432100, 0x00432100, 0x00543210,
+        0x00000000, 0x01000000, 0x01000000, 0x02000010,
+        0x01000000, 0x02000100, 0x02000100, 0x03000210,
+        0x01000000, 0x02001000, 0x02001000, 0x03002010,
+        0x02001000, 0x03002100, 0x03002100, 0x04003210,
+        0x01000000, 0x02010000, 0x02010000, 0x03020010,
+        0x02010000, 0x03020100, 0x03020100, 0x04030210,
+        0x02010000, 0x03021000, 0x03021000, 0x04032010,
+        0x03021000, 0x04032100, 0x04032100, 0x05043210,
+        0x01000000, 0x02100000, 0x02100000, 0x03200010,
+        0x02100000, 0x03200100, 0x03200100, 0x04300210,
+        0x02100000, 0x03201000, 0x03201000, 0x04302010,
+        0x03201000, 0x04302100, 0x04302100, 0x05403210,
+        0x02100000, 0x03210000, 0x03210000, 0x04320010,
+        0x03210000, 0x04320100, 0x04320100, 0x05430210,
+        0x03210000, 0x04321000, 0x04321000, 0x05432010,
+        0x04321000, 0x05432100, 0x05432100, 0x06543210,
+        0x00000000, 0x10000000, 0x10000000, 0x20000010,
+        0x10000000, 0x20000100, 0x20000100, 0x30000210,
+        0x10000000, 0x20001000, 0x20001000, 0x30002010,
+        0x20001000, 0x30002100, 0x30002100, 0x40003210,
+        0x10000000, 0x20010000, 0x20010000, 0x30020010,
+        0x20010000, 0x30020100, 0x30020100, 0x40030210,
+        0x20010000, 0x30021000, 0x30021000, 0x40032010,
+        0x30021000, 0x40032100, 0x40032100, 0x50043210,
+        0x10000000, 0x20100000, 0x20100000, 0x30200010,
+        0x20100000, 0x30200100, 0x30200100, 0x40300210,
+        0x20100000, 0x30201000, 0x30201000, 0x40302010,
+        0x30201000, 0x40302100, 0x40302100, 0x50403210,
+        0x20100000, 0x30210000, 0x30210000, 0x40320010,
+        0x30210000, 0x40320100, 0x40320100, 0x50430210,
+        0x30210000, 0x40321000, 0x40321000, 0x50432010,
+        0x40321000, 0x50432100, 0x50432100, 0x60543210,
+        0x10000000, 0x21000000, 0x21000000, 0x32000010,
+        0x21000000, 0x32000100, 0x32000100, 0x43000210,
+        0x21000000, 0x32001000, 0x32001000, 0x43002010,
+        0x32001000, 0x43002100, 0x43002100, 0x54003210,
+        0x21000000, 0x32010000, 0x32010000, 0x43020010,
+        0x32010000, 0x43020100, 0x43020100, 0x54030210,
+        0x32010000, 0x43021000, 0x43021000, 0x54032010,
+        0x43021000, 0x54032100, 0x54032100, 0x65043210,
+        0x21000000, 0x32100000, 0x32100000, 0x43200010,
+        0x32100000, 0x43200100, 0x43200100, 0x54300210,
+        0x32100000, 0x43201000, 0x43201000, 0x54302010,
+        0x43201000, 0x54302100, 0x54302100, 0x65403210,
+        0x32100000, 0x43210000, 0x43210000, 0x54320010,
+        0x43210000, 0x54320100, 0x54320100, 0x65430210,
+        0x43210000, 0x54321000, 0x54321000, 0x65432010,
+        0x54321000, 0x65432100, 0x65432100, 0x76543210,
+    };
+    return lut;
+}
+#endif
+
+#if SIMDPP_USE_AVX2
+// Expands 32-bit lanes of a according to the mask m converted to vector
+static SIMDPP_INL
+uint32<8> i_expand_perm8(const uint32<8>& a, const uint32<8>& m)
+{
+    unsigned bits = i_compress_lane_bits(m);
+    __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    __m256i idx = _mm256_srlv_epi32(_mm256_set1_epi32(expand_lut_perm8()[bits]), shifts);
+    __m256i r = _mm256_permutevar8x32_epi32(a.native(), idx);
+    return _mm256_and_si256(r, m.native());
+}
+#endif
+
+template<class V> SIMDPP_INL
+V i_expand_emul(const V& mask, const V& a)
+{
+    mem_block<V> ma(a), mm(mask), mr;
+    unsigned j = 0;
+    for (unsigned i = 0; i < V::length; ++i) {
+        mr[i] = mm[i] ? ma[j++] : 0;
+    }
+    return mr;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_expand(const mask_int32<4>& mask, const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_maskz_expand_epi32(mask.native(), a.native());
+#elif SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_expand_emul(mask.unmask(), a);
+#else
+    unsigned m = i_compress_lane_bits(mask.unmask());
+    uint8<16> sh = load(expand_lut_bytes16() + m*16);
+    return uint32<4>(i_permute_zbytes16(uint8<16>(a), sh));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_expand(const mask_int32<8>& mask, const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_expand_epi32(mask.native(), a.native());
+#else
+    return i_expand_perm8(a, mask.unmask());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_expand(const mask_int32<16>& mask, const uint32<16>& a)
+{
+    return _mm512_maskz_expand_epi32(mask.native(), a.native());
+}
+#endif
+
+static SIMDPP_INL
+uint64<2> i_expand(const mask_int64<2>& mask, const uint64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_maskz_expand_epi64(mask.native(), a.native());
+#elif SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3) || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    return i_expand_emul(mask.unmask(), a);
+#else
+    // each 64-bit lane sets two bits
+    unsigned m = i_compress_lane_bits(uint32<4>(mask.unmask()));
+    uint8<16> sh = load(expand_lut_bytes16() + m*16);
+    return uint64<2>(i_permute_zbytes16(uint8<16>(a), sh));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_expand(const mask_int64<4>& mask, const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_expand_epi64(mask.native(), a.native());
+#else
+    return uint64<4>(i_expand_perm8(uint32<8>(a), uint32<8>(mask.unmask())));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_expand(const mask_int64<8>& mask, const uint64<8>& a)
+{
+    return _mm512_maskz_expand_epi64(mask.native(), a.native());
+}
+#endif
+
+// Each native vector consumes as many source elements as there are set lanes
+// in the corresponding part of the mask.
+template<unsigned N> SIMDPP_INL
+uint32<N> i_expand(const mask_int32<N>& mask, const uint32<N>& a)
+{
+    using Base = typename uint32<N>::base_vector_type;
+    mem_block<uint32<N>> src(a);
+    uint32<N> r;
+    unsigned pos = 0;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        Base s = load_u(src.data() + pos);
+        r.vec(i) = i_expand(mask.vec(i), s);
+        pos += i_compress_count(mask.vec(i));
+    }
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_expand(const mask_int64<N>& mask, const uint64<N>& a)
+{
+    using Base = typename uint64<N>::base_vector_type;
+    mem_block<uint64<N>> src(a);
+    uint64<N> r;
+    unsigned pos = 0;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        Base s = load_u(src.data() + pos);
+        r.vec(i) = i_expand(mask.vec(i), s);
+        pos += i_compress_count(mask.vec(i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
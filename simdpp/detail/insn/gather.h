@@ -0,0 +1,512 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  Maps the element type of the memory accessed by gather() and scatter() to
+    the vector type that holds N such elements.
+*/
+template<class T, unsigned N> struct gather_vector_type;
+template<unsigned N> struct gather_vector_type<int32_t, N> { using type = int32<N>; };
+template<unsigned N> struct gather_vector_type<uint32_t, N> { using type = uint32<N>; };
+template<unsigned N> struct gather_vector_type<int64_t, N> { using type = int64<N>; };
+template<unsigned N> struct gather_vector_type<uint64_t, N> { using type = uint64<N>; };
+template<unsigned N> struct gather_vector_type<float, N> { using type = float32<N>; };
+template<unsigned N> struct gather_vector_type<double, N> { using type = float64<N>; };
+
+namespace insn {
+
+// The hardware interprets the indices as signed 32-bit values, the emulation
+// paths mirror that.
+template<class V> SIMDPP_INL
+void i_gather_emul(V& a, const char* base, const uint32_t* idx)
+{
+    using T = typename V::element_type;
+    const T* pt = reinterpret_cast<const T*>(base);
+    mem_block<V> r;
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = pt[static_cast<int32_t>(idx[i])];
+    }
+    a = r;
+}
+
+template<class U, class V, class M> SIMDPP_INL
+void i_gather_masked_emul(V& a, const char* base, const uint32_t* idx,
+                          const M& mask)
+{
+    using T = typename V::element_type;
+    const T* pt = reinterpret_cast<const T*>(base);
+    mem_block<V> r;
+    mem_block<U> m(bit_cast<U>(mask.unmask()));
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = m[i] ? pt[static_cast<int32_t>(idx[i])] : T(0);
+    }
+    a = r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather(uint32<4>& a, const char* base, const uint32<4>& idx)
+{
+#if SIMDPP_USE_AVX2
+    a = _mm_i32gather_epi32(reinterpret_cast<const int*>(base), idx.native(), 4);
+#else
+    mem_block<uint32<4>> ix(idx);
+    i_gather_emul(a, base, ix.data());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather(uint32<8>& a, const char* base, const uint32<8>& idx)
+{
+    a = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx.native(), 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(uint32<16>& a, const char* base, const uint32<16>& idx)
+{
+    a = _mm512_i32gather_epi32(idx.native(), base, 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather(float32<4>& a, const char* base, const uint32<4>& idx)
+{
+#if SIMDPP_USE_AVX2
+    a = _mm_i32gather_ps(reinterpret_cast<const float*>(base), idx.native(), 4);
+#else
+    mem_block<uint32<4>> ix(idx);
+    i_gather_emul(a, base, ix.data());
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_gather(float32<8>& a, const char* base, const uint32<8>& idx)
+{
+#if SIMDPP_USE_AVX2
+    a = _mm256_i32gather_ps(reinterpret_cast<const float*>(base), idx.native(), 4);
+#else
+    mem_block<uint32<8>> ix(idx);
+    i_gather_emul(a, base, ix.data());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(float32<16>& a, const char* base, const uint32<16>& idx)
+{
+    a = _mm512_i32gather_ps(idx.native(), base, 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// 64-bit elements: the index vector is twice as narrow as the result, thus the
+// indices are passed via memory and each native result vector consumes
+// V::length of them.
+
+static SIMDPP_INL
+void i_gather(uint64<2>& a, const char* base, const uint32_t* idx)
+{
+#if SIMDPP_USE_AVX2
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+#if __INTEL_COMPILER
+    a = _mm_i32gather_epi64(reinterpret_cast<const __int64*>(base), ix, 8);
+#else
+    a = _mm_i32gather_epi64(reinterpret_cast<const long long*>(base), ix, 8);
+#endif
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather(uint64<4>& a, const char* base, const uint32_t* idx)
+{
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+#if __INTEL_COMPILER
+    a = _mm256_i32gather_epi64(reinterpret_cast<const __int64*>(base), ix, 8);
+#else
+    a = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(base), ix, 8);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(uint64<8>& a, const char* base, const uint32_t* idx)
+{
+    __m256i ix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx));
+    a = _mm512_i32gather_epi64(ix, base, 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather(float64<2>& a, const char* base, const uint32_t* idx)
+{
+#if SIMDPP_USE_AVX2
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+    a = _mm_i32gather_pd(reinterpret_cast<const double*>(base), ix, 8);
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_gather(float64<4>& a, const char* base, const uint32_t* idx)
+{
+#if SIMDPP_USE_AVX2
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+    a = _mm256_i32gather_pd(reinterpret_cast<const double*>(base), ix, 8);
+#else
+    i_gather_emul(a, base, idx);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(float64<8>& a, const char* base, const uint32_t* idx)
+{
+    __m256i ix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx));
+    a = _mm512_i32gather_pd(ix, base, 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(uint32<4>& a, const char* base, const uint32<4>& idx,
+                     const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_mmask_i32gather_epi32(_mm_setzero_si128(), mask.native(),
+                                  idx.native(), base, 4);
+#elif SIMDPP_USE_AVX2
+    a = _mm_mask_i32gather_epi32(_mm_setzero_si128(),
+                                 reinterpret_cast<const int*>(base),
+                                 idx.native(), mask.native(), 4);
+#else
+    mem_block<uint32<4>> ix(idx);
+    i_gather_masked_emul<uint32<4>>(a, base, ix.data(), mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather_masked(uint32<8>& a, const char* base, const uint32<8>& idx,
+                     const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_mmask_i32gather_epi32(_mm256_setzero_si256(), mask.native(),
+                                     idx.native(), base, 4);
+#else
+    a = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                    reinterpret_cast<const int*>(base),
+                                    idx.native(), mask.native(), 4);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(uint32<16>& a, const char* base, const uint32<16>& idx,
+                     const mask_int32<16>& mask)
+{
+    a = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask.native(),
+                                    idx.native(), base, 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(float32<4>& a, const char* base, const uint32<4>& idx,
+                     const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_mmask_i32gather_ps(_mm_setzero_ps(), mask.native(),
+                               idx.native(), base, 4);
+#elif SIMDPP_USE_AVX2
+    a = _mm_mask_i32gather_ps(_mm_setzero_ps(),
+                              reinterpret_cast<const float*>(base),
+                              idx.native(), mask.native(), 4);
+#else
+    mem_block<uint32<4>> ix(idx);
+    i_gather_masked_emul<uint32<4>>(a, base, ix.data(), mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_gather_masked(float32<8>& a, const char* base, const uint32<8>& idx,
+                     const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_mmask_i32gather_ps(_mm256_setzero_ps(), mask.native(),
+                                  idx.native(), base, 4);
+#elif SIMDPP_USE_AVX2
+    a = _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                 reinterpret_cast<const float*>(base),
+                                 idx.native(), mask.native(), 4);
+#else
+    mem_block<uint32<8>> ix(idx);
+    i_gather_masked_emul<uint32<8>>(a, base, ix.data(), mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(float32<16>& a, const char* base, const uint32<16>& idx,
+                     const mask_float32<16>& mask)
+{
+    a = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask.native(),
+                                 idx.native(), base, 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(uint64<2>& a, const char* base, const uint32_t* idx,
+                     const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX2
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+#if SIMDPP_USE_AVX512VL
+    a = _mm_mmask_i32gather_epi64(_mm_setzero_si128(), mask.native(), ix, base, 8);
+#elif __INTEL_COMPILER
+    a = _mm_mask_i32gather_epi64(_mm_setzero_si128(),
+                                 reinterpret_cast<const __int64*>(base),
+                                 ix, mask.native(), 8);
+#else
+    a = _mm_mask_i32gather_epi64(_mm_setzero_si128(),
+                                 reinterpret_cast<const long long*>(base),
+                                 ix, mask.native(), 8);
+#endif
+#else
+    i_gather_masked_emul<uint64<2>>(a, base, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather_masked(uint64<4>& a, const char* base, const uint32_t* idx,
+                     const mask_int64<4>& mask)
+{
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_mmask_i32gather_epi64(_mm256_setzero_si256(), mask.native(),
+                                     ix, base, 8);
+#elif __INTEL_COMPILER
+    a = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(),
+                                    reinterpret_cast<const __int64*>(base),
+                                    ix, mask.native(), 8);
+#else
+    a = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(),
+                                    reinterpret_cast<const long long*>(base),
+                                    ix, mask.native(), 8);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(uint64<8>& a, const char* base, const uint32_t* idx,
+                     const mask_int64<8>& mask)
+{
+    __m256i ix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx));
+    a = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask.native(),
+                                    ix, base, 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(float64<2>& a, const char* base, const uint32_t* idx,
+                     const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+    a = _mm_mmask_i32gather_pd(_mm_setzero_pd(), mask.native(), ix, base, 8);
+#elif SIMDPP_USE_AVX2
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+    a = _mm_mask_i32gather_pd(_mm_setzero_pd(),
+                              reinterpret_cast<const double*>(base),
+                              ix, mask.native(), 8);
+#else
+    i_gather_masked_emul<uint64<2>>(a, base, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_gather_masked(float64<4>& a, const char* base, const uint32_t* idx,
+                     const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+    a = _mm256_mmask_i32gather_pd(_mm256_setzero_pd(), mask.native(),
+                                  ix, base, 8);
+#elif SIMDPP_USE_AVX2
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+    a = _mm256_mask_i32gather_pd(_mm256_setzero_pd(),
+                                 reinterpret_cast<const double*>(base),
+                                 ix, mask.native(), 8);
+#else
+    i_gather_masked_emul<uint64<4>>(a, base, idx, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(float64<8>& a, const char* base, const uint32_t* idx,
+                     const mask_float64<8>& mask)
+{
+    __m256i ix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx));
+    a = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask.native(),
+                                 ix, base, 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+void i_gather(uint32<N>& a, const char* base, const uint32<N>& idx)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_gather(a.vec(i), base, idx.vec(i));
+    }
+}
+
+template<unsigned N> SIMDPP_INL
+void i_gather(float32<N>& a, const char* base, const uint32<N>& idx)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    // float32 vectors are twice as wide as integer vectors
+    using Base = typename float32<N>::base_vector_type;
+    mem_block<uint32<N>> ix(idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_gather_emul(a.vec(i), base, ix.data() + i * Base::length);
+    }
+#else
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_gather(a.vec(i), base, idx.vec(i));
+    }
+#endif
+}
+
+template<class V, unsigned N> SIMDPP_INL
+void i_gather64(V& a, const char* base, const uint32<N>& idx)
+{
+    using Base = typename V::base_vector_type;
+    mem_block<uint32<N>> ix(idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_gather(a.vec(i), base, ix.data() + i * Base::length);
+    }
+}
+
+template<unsigned N> SIMDPP_INL
+void i_gather(uint64<N>& a, const char* base, const uint32<N>& idx)
+{
+    i_gather64(a, base, idx);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_gather(float64<N>& a, const char* base, const uint32<N>& idx)
+{
+    i_gather64(a, base, idx);
+}
+
+template<unsigned N, class M> SIMDPP_INL
+void i_gather_masked(uint32<N>& a, const char* base, const uint32<N>& idx,
+                     const M& mask)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_gather_masked(a.vec(i), base, idx.vec(i), mask.vec(i));
+    }
+}
+
+template<unsigned N, class M> SIMDPP_INL
+void i_gather_masked(float32<N>& a, const char* base, const uint32<N>& idx,
+                     const M& mask)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    // float32 vectors are twice as wide as integer vectors
+    using Base = typename float32<N>::base_vector_type;
+    mem_block<uint32<N>> ix(idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_gather_masked_emul<uint32<Base::length>>(a.vec(i), base,
+                                                   ix.data() + i * Base::length,
+                                                   mask.vec(i));
+    }
+#else
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_gather_masked(a.vec(i), base, idx.vec(i), mask.vec(i));
+    }
+#endif
+}
+
+template<class V, unsigned N, class M> SIMDPP_INL
+void i_gather64_masked(V& a, const char* base, const uint32<N>& idx,
+                       const M& mask)
+{
+    using Base = typename V::base_vector_type;
+    mem_block<uint32<N>> ix(idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_gather_masked(a.vec(i), base, ix.data() + i * Base::length,
+                        mask.vec(i));
+    }
+}
+
+template<unsigned N, class M> SIMDPP_INL
+void i_gather_masked(uint64<N>& a, const char* base, const uint32<N>& idx,
+                     const M& mask)
+{
+    i_gather64_masked(a, base, idx, mask);
+}
+
+template<unsigned N, class M> SIMDPP_INL
+void i_gather_masked(float64<N>& a, const char* base, const uint32<N>& idx,
+                     const M& mask)
+{
+    i_gather64_masked(a, base, idx, mask);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
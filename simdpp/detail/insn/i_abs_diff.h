@@ -0,0 +1,361 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_ABS_DIFF_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_ABS_DIFF_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/i_sub_sat.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/detail/subvec_extract.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The absolute difference of two B-bit values always fits into an unsigned
+    B-bit value. It is computed either as the sum of the two saturated
+    differences, only one of which is nonzero, or as max(a, b) - min(a, b).
+    The subtraction in the latter wraps around, but the result is correct when
+    interpreted as unsigned.
+*/
+template<class V> SIMDPP_INL
+V v_abs_diff_sat(const V& a, const V& b)
+{
+    V ab, ba;
+    ab = sub_sat(a, b);
+    ba = sub_sat(b, a);
+    ab = bit_or(ab, ba);
+    return ab;
+}
+
+template<class R, class V> SIMDPP_INL
+R v_abs_diff_minmax(const V& a, const V& b)
+{
+    V hi, lo;
+    hi = max(a, b);
+    lo = min(a, b);
+    hi = sub(hi, lo);
+    return R(hi);
+}
+
+static SIMDPP_INL
+uint8<16> i_abs_diff(const uint8<16>& a, const uint8<16>& b)
+{
+#if SIMDPP_USE_NEON
+    return vabdq_u8(a.native(), b.native());
+#elif SIMDPP_USE_MSA
+    return __msa_asub_u_b(a.native(), b.native());
+#else
+    return v_abs_diff_sat(a, b);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_abs_diff(const uint8<N>& a, const uint8<N>& b)
+{
+#if SIMDPP_USE_NEON || SIMDPP_USE_MSA
+    SIMDPP_VEC_ARRAY_IMPL2(uint8<N>, i_abs_diff, a, b)
+#else
+    return v_abs_diff_sat(a, b);
+#endif
+}
+
+static SIMDPP_INL
+uint8<16> i_abs_diff(const int8<16>& a, const int8<16>& b)
+{
+#if SIMDPP_USE_NEON
+    return vreinterpretq_u8_s8(vabdq_s8(a.native(), b.native()));
+#elif SIMDPP_USE_MSA
+    return (v16u8) __msa_asub_s_b(a.native(), b.native());
+#else
+    return v_abs_diff_minmax<uint8<16>>(a, b);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_abs_diff(const int8<N>& a, const int8<N>& b)
+{
+#if SIMDPP_USE_NEON || SIMDPP_USE_MSA
+    SIMDPP_VEC_ARRAY_IMPL2(uint8<N>, i_abs_diff, a, b)
+#else
+    return v_abs_diff_minmax<uint8<N>>(a, b);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_abs_diff(const uint16<8>& a, const uint16<8>& b)
+{
+#if SIMDPP_USE_NEON
+    return vabdq_u16(a.native(), b.native());
+#elif SIMDPP_USE_MSA
+    return __msa_asub_u_h(a.native(), b.native());
+#else
+    return v_abs_diff_sat(a, b);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_abs_diff(const uint16<N>& a, const uint16<N>& b)
+{
+#if SIMDPP_USE_NEON || SIMDPP_USE_MSA
+    SIMDPP_VEC_ARRAY_IMPL2(uint16<N>, i_abs_diff, a, b)
+#else
+    return v_abs_diff_sat(a, b);
+#endif
+}
+
+static SIMDPP_INL
+uint16<8> i_abs_diff(const int16<8>& a, const int16<8>& b)
+{
+#if SIMDPP_USE_NEON
+    return vreinterpretq_u16_s16(vabdq_s16(a.native(), b.native()));
+#elif SIMDPP_USE_MSA
+    return (v8u16) __msa_asub_s_h(a.native(), b.native());
+#else
+    return v_abs_diff_minmax<uint16<8>>(a, b);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_abs_diff(const int16<N>& a, const int16<N>& b)
+{
+#if SIMDPP_USE_NEON || SIMDPP_USE_MSA
+    SIMDPP_VEC_ARRAY_IMPL2(uint16<N>, i_abs_diff, a, b)
+#else
+    return v_abs_diff_minmax<uint16<N>>(a, b);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_abs_diff(const uint32<4>& a, const uint32<4>& b)
+{
+#if SIMDPP_USE_NEON
+    return vabdq_u32(a.native(), b.native());
+#elif SIMDPP_USE_MSA
+    return __msa_asub_u_w(a.native(), b.native());
+#else
+    return v_abs_diff_minmax<uint32<4>>(a, b);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_abs_diff(const uint32<N>& a, const uint32<N>& b)
+{
+#if SIMDPP_USE_NEON || SIMDPP_USE_MSA
+    SIMDPP_VEC_ARRAY_IMPL2(uint32<N>, i_abs_diff, a, b)
+#else
+    return v_abs_diff_minmax<uint32<N>>(a, b);
+#endif
+}
+
+static SIMDPP_INL
+uint32<4> i_abs_diff(const int32<4>& a, const int32<4>& b)
+{
+#if SIMDPP_USE_NEON
+    return vreinterpretq_u32_s32(vabdq_s32(a.native(), b.native()));
+#elif SIMDPP_USE_MSA
+    return (v4u32) __msa_asub_s_w(a.native(), b.native());
+#else
+    return v_abs_diff_minmax<uint32<4>>(a, b);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_abs_diff(const int32<N>& a, const int32<N>& b)
+{
+#if SIMDPP_USE_NEON || SIMDPP_USE_MSA
+    SIMDPP_VEC_ARRAY_IMPL2(uint32<N>, i_abs_diff, a, b)
+#else
+    return v_abs_diff_minmax<uint32<N>>(a, b);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+/*  64-bit comparisons are not available on many instruction sets, thus the
+    sign of a - b is derived from the borrow (unsigned) or from the overflow
+    corrected sign bit (signed) of the difference and the difference is
+    conditionally negated.
+*/
+template<unsigned N> SIMDPP_INL
+uint64<N> v_emul_abs_diff_u64(const uint64<N>& a, const uint64<N>& b)
+{
+    uint64<N> d, lt, mask;
+    d = sub(a, b);
+    // borrow = (~a & b) | (~(a ^ b) & d)
+    lt = bit_or(bit_andnot(b, a), bit_andnot(d, bit_xor(a, b)));
+    mask = sub(uint64<N>(make_zero()), shift_r<63>(lt));
+    d = bit_xor(d, mask);
+    d = sub(d, mask);
+    return d;
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> v_emul_abs_diff_i64(const int64<N>& a, const int64<N>& b)
+{
+    uint64<N> ua = uint64<N>(a), ub = uint64<N>(b);
+    uint64<N> d, lt, mask;
+    d = sub(ua, ub);
+    // a < b iff the sign of d differs from the overflow flag
+    lt = bit_xor(d, bit_and(bit_xor(ua, ub), bit_xor(d, ua)));
+    mask = sub(uint64<N>(make_zero()), shift_r<63>(lt));
+    d = bit_xor(d, mask);
+    d = sub(d, mask);
+    return d;
+}
+
+static SIMDPP_INL
+uint64<2> i_abs_diff(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_MSA
+    return __msa_asub_u_d(a.native(), b.native());
+#elif SIMDPP_USE_AVX512VL
+    return v_abs_diff_minmax<uint64<2>>(a, b);
+#else
+    return v_emul_abs_diff_u64(a, b);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_abs_diff(const uint64<N>& a, const uint64<N>& b)
+{
+#if SIMDPP_USE_MSA
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, i_abs_diff, a, b)
+#elif SIMDPP_USE_AVX512VL
+    return v_abs_diff_minmax<uint64<N>>(a, b);
+#else
+    return v_emul_abs_diff_u64(a, b);
+#endif
+}
+
+static SIMDPP_INL
+uint64<2> i_abs_diff(const int64<2>& a, const int64<2>& b)
+{
+#if SIMDPP_USE_MSA
+    return (v2u64) __msa_asub_s_d(a.native(), b.native());
+#elif SIMDPP_USE_AVX512VL
+    return v_abs_diff_minmax<uint64<2>>(a, b);
+#else
+    return v_emul_abs_diff_i64(a, b);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_abs_diff(const int64<N>& a, const int64<N>& b)
+{
+#if SIMDPP_USE_MSA
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, i_abs_diff, a, b)
+#elif SIMDPP_USE_AVX512VL
+    return v_abs_diff_minmax<uint64<N>>(a, b);
+#else
+    return v_emul_abs_diff_i64(a, b);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+// Sums each group of 8 adjacent 8-bit absolute differences by widening in steps
+template<unsigned N> SIMDPP_INL
+uint64<N/8> v_emul_sad_u8(const uint8<N>& a, const uint8<N>& b)
+{
+    uint8<N> d = i_abs_diff(a, b);
+    uint16<N/2> d16 = uint16<N/2>(d);
+    uint16<N/2> s16 = add(bit_and(d16, 0xff), shift_r<8>(d16));
+    uint32<N/4> d32 = uint32<N/4>(s16);
+    uint32<N/4> s32 = add(bit_and(d32, 0xffff), shift_r<16>(d32));
+    uint64<N/8> d64 = uint64<N/8>(s32);
+    uint64<N/8> s64 = add(bit_and(d64, 0xffffffff), shift_r<32>(d64));
+    return s64;
+}
+
+static SIMDPP_INL
+uint64<2> i_sad_u8(const uint8<16>& a, const uint8<16>& b)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < 2; i++) {
+        uint64_t s = 0;
+        for (unsigned j = 0; j < 8; j++) {
+            uint8_t x = a.el(i*8+j), y = b.el(i*8+j);
+            s += x > y ? x - y : y - x;
+        }
+        r.el(i) = s;
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    return _mm_sad_epu8(a.native(), b.native());
+#elif SIMDPP_USE_NEON
+    uint8x16_t d = vabdq_u8(a.native(), b.native());
+    return vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(d)));
+#else
+    return v_emul_sad_u8(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_sad_u8(const uint8<32>& a, const uint8<32>& b)
+{
+    return _mm256_sad_epu8(a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_sad_u8(const uint8<64>& a, const uint8<64>& b)
+{
+#if SIMDPP_USE_AVX512BW
+    return _mm512_sad_epu8(a.native(), b.native());
+#else
+    uint64<4> r0, r1;
+    r0 = _mm256_sad_epu8(a.vec(0).native(), b.vec(0).native());
+    r1 = _mm256_sad_epu8(a.vec(1).native(), b.vec(1).native());
+    return combine(r0, r1);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N/8> i_sad_u8(const uint8<N>& a, const uint8<N>& b)
+{
+    const unsigned L = uint64<N/8>::base_length;
+    uint64<N/8> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_sad_u8(subvec_extract<L*8>(a, i), subvec_extract<L*8>(b, i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,304 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_BIT_REVERSE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_BIT_REVERSE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The bytes are reordered using a single byte permutation where one is
+    available. Otherwise the halves of each element are swapped recursively
+    using shifts.
+*/
+template<unsigned N> SIMDPP_INL
+uint16<N> v_emul_byte_swap(const uint16<N>& a)
+{
+    uint16<N> r = bit_or(shift_l<8>(a), shift_r<8>(a));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> v_emul_byte_swap(const uint32<N>& a)
+{
+    uint32<N> r = (uint32<N>) v_emul_byte_swap(uint16<N*2>(a));
+    r = bit_or(shift_l<16>(r), shift_r<16>(r));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> v_emul_byte_swap(const uint64<N>& a)
+{
+    uint64<N> r = (uint64<N>) v_emul_byte_swap(uint32<N*2>(a));
+    r = bit_or(shift_l<32>(r), shift_r<32>(r));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> v_perm_byte_swap(const uint16<N>& a)
+{
+    uint8<N*2> mask = make_uint(1, 0, 3, 2, 5, 4, 7, 6,
+                                9, 8, 11, 10, 13, 12, 15, 14);
+    return (uint16<N>) permute_bytes16(uint8<N*2>(a), mask);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> v_perm_byte_swap(const uint32<N>& a)
+{
+    uint8<N*4> mask = make_uint(3, 2, 1, 0, 7, 6, 5, 4,
+                                11, 10, 9, 8, 15, 14, 13, 12);
+    return (uint32<N>) permute_bytes16(uint8<N*4>(a), mask);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> v_perm_byte_swap(const uint64<N>& a)
+{
+    uint8<N*8> mask = make_uint(7, 6, 5, 4, 3, 2, 1, 0,
+                                15, 14, 13, 12, 11, 10, 9, 8);
+    return (uint64<N>) permute_bytes16(uint8<N*8>(a), mask);
+}
+
+static SIMDPP_INL
+uint16<8> i_byte_swap(const uint16<8>& a)
+{
+#if SIMDPP_USE_NULL
+    uint16<8> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint16_t x = a.el(i);
+        r.el(i) = uint16_t((x << 8) | (x >> 8));
+    }
+    return r;
+#elif SIMDPP_USE_NEON
+    return vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(a.native())));
+#elif SIMDPP_USE_MSA
+    return (v8u16) __msa_shf_b((v16i8) a.native(), 0xb1);
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_ALTIVEC
+    return v_perm_byte_swap(a);
+#else
+    return v_emul_byte_swap(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_byte_swap(const uint16<16>& a)
+{
+    return v_perm_byte_swap(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_byte_swap(const uint16<32>& a)
+{
+    return v_perm_byte_swap(a);
+}
+#endif
+
+static SIMDPP_INL
+uint32<4> i_byte_swap(const uint32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint32_t x = a.el(i);
+        x = (x << 16) | (x >> 16);
+        r.el(i) = ((x & 0x00ff00ff) << 8) | ((x >> 8) & 0x00ff00ff);
+    }
+    return r;
+#elif SIMDPP_USE_NEON
+    return vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(a.native())));
+#elif SIMDPP_USE_MSA
+    return (v4u32) __msa_shf_b((v16i8) a.native(), 0x1b);
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_ALTIVEC
+    return v_perm_byte_swap(a);
+#else
+    return v_emul_byte_swap(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_byte_swap(const uint32<8>& a)
+{
+    return v_perm_byte_swap(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_byte_swap(const uint32<16>& a)
+{
+    return v_perm_byte_swap(a);
+}
+#endif
+
+static SIMDPP_INL
+uint64<2> i_byte_swap(const uint64<2>& a)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint64_t x = a.el(i);
+        x = (x << 32) | (x >> 32);
+        x = ((x & 0x0000ffff0000ffff) << 16) | ((x >> 16) & 0x0000ffff0000ffff);
+        r.el(i) = ((x & 0x00ff00ff00ff00ff) << 8) | ((x >> 8) & 0x00ff00ff00ff00ff);
+    }
+    return r;
+#elif SIMDPP_USE_NEON
+    return vreinterpretq_u64_u8(vrev64q_u8(vreinterpretq_u8_u64(a.native())));
+#elif SIMDPP_USE_MSA
+    v16i8 r = __msa_shf_b((v16i8) a.native(), 0x1b);
+    return (v2u64) __msa_shf_w((v4i32) r, 0xb1);
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_ALTIVEC
+    return v_perm_byte_swap(a);
+#else
+    return v_emul_byte_swap(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_byte_swap(const uint64<4>& a)
+{
+    return v_perm_byte_swap(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_byte_swap(const uint64<8>& a)
+{
+    return v_perm_byte_swap(a);
+}
+#endif
+
+template<class V> SIMDPP_INL
+V i_byte_swap(const V& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, i_byte_swap, a)
+}
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+uint8<N> v_emul_bit_reverse(const uint8<N>& a)
+{
+    // 16-bit shifts are used as 8-bit shifts are not available on x86. The
+    // bits that cross byte boundaries are masked out.
+    uint16<N/2> p = (uint16<N/2>) a;
+    p = bit_or(bit_and(shift_r<4>(p), 0x0f0f), shift_l<4>(bit_and(p, 0x0f0f)));
+    p = bit_or(bit_and(shift_r<2>(p), 0x3333), shift_l<2>(bit_and(p, 0x3333)));
+    p = bit_or(bit_and(shift_r<1>(p), 0x5555), shift_l<1>(bit_and(p, 0x5555)));
+    return (uint8<N>) p;
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> v_perm_bit_reverse(const uint8<N>& a)
+{
+    // each nibble is reversed using a table lookup and moved to the other half
+    uint8<N> lut_lo = make_uint(0x00, 0x80, 0x40, 0xc0, 0x20, 0xa0, 0x60, 0xe0,
+                                0x10, 0x90, 0x50, 0xd0, 0x30, 0xb0, 0x70, 0xf0);
+    uint8<N> lut_hi = make_uint(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+                                0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+    uint8<N> lo, hi;
+    uint16<N/2> t;
+    lo = bit_and(a, 0x0f);
+    t = bit_and(shift_r<4>(uint16<N/2>(a)), 0x0f0f);
+    hi = t;
+    lo = permute_bytes16(lut_lo, lo);
+    hi = permute_bytes16(lut_hi, hi);
+    uint8<N> r = bit_or(lo, hi);
+    return r;
+}
+
+static SIMDPP_INL
+uint8<16> i_bit_reverse(const uint8<16>& a)
+{
+#if SIMDPP_USE_NULL
+    uint8<16> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint8_t x = a.el(i);
+        x = uint8_t((x >> 4) | (x << 4));
+        x = uint8_t(((x >> 2) & 0x33) | ((x & 0x33) << 2));
+        r.el(i) = uint8_t(((x >> 1) & 0x55) | ((x & 0x55) << 1));
+    }
+    return r;
+#elif SIMDPP_USE_NEON64
+    return vrbitq_u8(a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return v_perm_bit_reverse(a);
+#else
+    return v_emul_bit_reverse(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_bit_reverse(const uint8<32>& a)
+{
+    return v_perm_bit_reverse(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_bit_reverse(const uint8<64>& a)
+{
+    return v_perm_bit_reverse(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_bit_reverse(const uint8<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(uint8<N>, i_bit_reverse, a)
+}
+
+// Wider elements are reversed by reversing the bits in each byte first
+template<unsigned N> SIMDPP_INL
+uint16<N> i_bit_reverse(const uint16<N>& a)
+{
+    uint16<N> r = (uint16<N>) i_bit_reverse(uint8<N*2>(a));
+    return i_byte_swap(r);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_bit_reverse(const uint32<N>& a)
+{
+    uint32<N> r = (uint32<N>) i_bit_reverse(uint8<N*4>(a));
+    return i_byte_swap(r);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_bit_reverse(const uint64<N>& a)
+{
+    uint64<N> r = (uint64<N>) i_bit_reverse(uint8<N*8>(a));
+    return i_byte_swap(r);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
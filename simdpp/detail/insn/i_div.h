@@ -0,0 +1,78 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/i_mul_hi.h>
+#include <simdpp/detail/insn/i_shift_r.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Unsigned division:
+        t = mul_hi(m, n)
+        q = (t + ((n - t) >> s1)) >> s2
+
+    The subtraction can not overflow as t <= n and the addition can not
+    overflow because (n - t) is halved whenever s1 is nonzero.
+*/
+template<class V, class T> SIMDPP_INL
+V i_div_unsigned(const V& a, const divider<T>& d)
+{
+    V m = splat<V>(d.magic());
+    V t, q;
+    t = i_mul_hi(a, m);
+    q = sub(a, t);
+    q = i_shift_r(q, d.shift1());
+    q = add(q, t);
+    q = i_shift_r(q, d.shift2());
+    return q;
+}
+
+/*  Signed division:
+        q = ((n + mul_hi(m, n)) >> s2) - (n >> (B-1))
+        q = (q ^ sign) - sign
+
+    The shifts are arithmetic. Subtracting the sign of n rounds the quotient
+    towards zero; the final step negates the quotient for negative divisors.
+*/
+template<class V, class T> SIMDPP_INL
+V i_div_signed(const V& a, const divider<T>& d)
+{
+    V m = splat<V>(d.magic());
+    V sign = splat<V>(d.sign());
+    V q, an;
+    q = i_mul_hi(a, m);
+    q = add(q, a);
+    q = i_shift_r(q, d.shift2());
+    an = i_shift_r(a, sizeof(T)*8 - 1);
+    q = sub(q, an);
+    q = bit_xor(q, sign);
+    q = sub(q, sign);
+    return q;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
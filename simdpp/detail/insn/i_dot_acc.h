@@ -0,0 +1,224 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DOT_ACC_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DOT_ACC_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/detail/subvec_extract.h>
+#include <simdpp/detail/insn/i_shift_l.h>
+#include <simdpp/detail/insn/i_shift_r.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Note: the result of each dot product is accumulated into the corresponding
+    32-bit element with wrap-around semantics, matching AVX512-VNNI vpdpwssd and
+    vpdpbusd. Intermediate results are never saturated. For this reason
+    pmaddubsw, which saturates the sums of adjacent 8-bit products to 16 bits,
+    is not used. Instead, the 8-bit elements are widened in place to 16 bits
+    and pmaddwd is used on the even and the odd elements separately.
+*/
+
+static SIMDPP_INL
+int32<4> i_dot_acc_i16(const int32<4>& acc, const int16<8>& a, const int16<8>& b)
+{
+#if SIMDPP_USE_NULL
+    int32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        int32_t p0 = int32_t(a.el(i*2)) * b.el(i*2);
+        int32_t p1 = int32_t(a.el(i*2+1)) * b.el(i*2+1);
+        r.el(i) = int32_t(uint32_t(acc.el(i)) + uint32_t(p0) + uint32_t(p1));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512VL
+    return _mm_dpwssd_epi32(acc.native(), a.native(), b.native());
+#elif SIMDPP_USE_SSE2
+    int32<4> r = _mm_madd_epi16(a.native(), b.native());
+    r = add(acc, r);
+    return r;
+#elif SIMDPP_USE_NEON
+    int32x4_t lo = vmull_s16(vget_low_s16(a.native()), vget_low_s16(b.native()));
+    int32x4_t hi = vmull_s16(vget_high_s16(a.native()), vget_high_s16(b.native()));
+#if SIMDPP_USE_NEON64
+    int32<4> r = vpaddq_s32(lo, hi);
+#else
+    int32<4> r = vcombine_s32(vpadd_s32(vget_low_s32(lo), vget_high_s32(lo)),
+                              vpadd_s32(vget_low_s32(hi), vget_high_s32(hi)));
+#endif
+    r = add(acc, r);
+    return r;
+#elif SIMDPP_USE_ALTIVEC
+    return vec_msum(a.native(), b.native(), acc.native());
+#elif SIMDPP_USE_MSA
+    return __msa_dpadd_s_w(acc.native(), a.native(), b.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int32<8> i_dot_acc_i16(const int32<8>& acc, const int16<16>& a, const int16<16>& b)
+{
+#if SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512VL
+    return _mm256_dpwssd_epi32(acc.native(), a.native(), b.native());
+#else
+    int32<8> r = _mm256_madd_epi16(a.native(), b.native());
+    r = add(acc, r);
+    return r;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_dot_acc_i16(const int32<16>& acc, const int16<32>& a, const int16<32>& b)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VNNI
+    return _mm512_dpwssd_epi32(acc.native(), a.native(), b.native());
+#elif SIMDPP_USE_AVX512BW
+    int32<16> r = _mm512_madd_epi16(a.native(), b.native());
+    r = add(acc, r);
+    return r;
+#else
+    int32<8> acc0, acc1;
+    split(acc, acc0, acc1);
+    acc0 = i_dot_acc_i16(acc0, a.vec(0), b.vec(0));
+    acc1 = i_dot_acc_i16(acc1, a.vec(1), b.vec(1));
+    return combine(acc0, acc1);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_dot_acc_i16(const int32<N>& acc, const int16<N*2>& a, const int16<N*2>& b)
+{
+    const unsigned L = int32<N>::base_length;
+    int32<N> r;
+    for (unsigned i = 0; i < acc.vec_length; ++i) {
+        r.vec(i) = i_dot_acc_i16(acc.vec(i), subvec_extract<L*2>(a, i),
+                                 subvec_extract<L*2>(b, i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+int32<N> v_emul_dot_acc_u8s8(const int32<N>& acc, const uint8<N*4>& a, const int8<N*4>& b)
+{
+    // each 16-bit element holds one even and one odd 8-bit element
+    uint16<N*2> a16 = uint16<N*2>(a);
+    int16<N*2> b16 = int16<N*2>(b);
+    int16<N*2> a_even, a_odd, b_even, b_odd;
+    a_even = bit_and(a16, 0x00ff);
+    a_odd = i_shift_r(a16, 8);
+    b_even = i_shift_l(uint16<N*2>(b), 8);
+    b_even = i_shift_r(b_even, 8);
+    b_odd = i_shift_r(b16, 8);
+
+    int32<N> r = i_dot_acc_i16(acc, a_even, b_even);
+    r = i_dot_acc_i16(r, a_odd, b_odd);
+    return r;
+}
+
+static SIMDPP_INL
+int32<4> i_dot_acc_u8s8(const int32<4>& acc, const uint8<16>& a, const int8<16>& b)
+{
+#if SIMDPP_USE_NULL
+    int32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        uint32_t s = acc.el(i);
+        for (unsigned j = 0; j < 4; j++) {
+            s += uint32_t(int32_t(a.el(i*4+j)) * b.el(i*4+j));
+        }
+        r.el(i) = int32_t(s);
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512VL
+    return _mm_dpbusd_epi32(acc.native(), a.native(), b.native());
+#elif SIMDPP_USE_NEON
+    // the products of unsigned and signed 8-bit values fit into 16 bits
+    int16x8_t a_lo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(a.native())));
+    int16x8_t a_hi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(a.native())));
+    int16x8_t p_lo = vmulq_s16(a_lo, vmovl_s8(vget_low_s8(b.native())));
+    int16x8_t p_hi = vmulq_s16(a_hi, vmovl_s8(vget_high_s8(b.native())));
+    int32x4_t lo = vpaddlq_s16(p_lo);
+    int32x4_t hi = vpaddlq_s16(p_hi);
+#if SIMDPP_USE_NEON64
+    int32<4> r = vpaddq_s32(lo, hi);
+#else
+    int32<4> r = vcombine_s32(vpadd_s32(vget_low_s32(lo), vget_high_s32(lo)),
+                              vpadd_s32(vget_low_s32(hi), vget_high_s32(hi)));
+#endif
+    r = add(acc, r);
+    return r;
+#elif SIMDPP_USE_ALTIVEC
+    return vec_msum(b.native(), a.native(), acc.native());
+#else
+    return v_emul_dot_acc_u8s8(acc, a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int32<8> i_dot_acc_u8s8(const int32<8>& acc, const uint8<32>& a, const int8<32>& b)
+{
+#if SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512VL
+    return _mm256_dpbusd_epi32(acc.native(), a.native(), b.native());
+#else
+    return v_emul_dot_acc_u8s8(acc, a, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_dot_acc_u8s8(const int32<16>& acc, const uint8<64>& a, const int8<64>& b)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VNNI
+    return _mm512_dpbusd_epi32(acc.native(), a.native(), b.native());
+#elif SIMDPP_USE_AVX512BW
+    return v_emul_dot_acc_u8s8(acc, a, b);
+#else
+    int32<8> acc0, acc1;
+    split(acc, acc0, acc1);
+    acc0 = i_dot_acc_u8s8(acc0, a.vec(0), b.vec(0));
+    acc1 = i_dot_acc_u8s8(acc1, a.vec(1), b.vec(1));
+    return combine(acc0, acc1);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_dot_acc_u8s8(const int32<N>& acc, const uint8<N*4>& a, const int8<N*4>& b)
+{
+    const unsigned L = int32<N>::base_length;
+    int32<N> r;
+    for (unsigned i = 0; i < acc.vec_length; ++i) {
+        r.vec(i) = i_dot_acc_u8s8(acc.vec(i), subvec_extract<L*4>(a, i),
+                                  subvec_extract<L*4>(b, i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
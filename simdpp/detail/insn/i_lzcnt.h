@@ -0,0 +1,371 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_LZCNT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_LZCNT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/i_popcnt.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Where no native instruction is available, the leading zeros of 8-bit
+    elements are counted using a table lookup on each nibble. The counts of
+    wider elements are then computed from the counts of their halves: the
+    count of the low half is added only if the high half is zero.
+*/
+template<unsigned N> SIMDPP_INL
+uint8<N> v_perm_lzcnt(const uint8<N>& a)
+{
+    uint8<N> lut = make_uint(4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+    uint8<N> zero = make_zero();
+    uint8<N> lo, hi, z_lo, z_hi, m;
+    uint16<N/2> t;
+    lo = bit_and(a, 0x0f);
+    t = bit_and(shift_r<4>(uint16<N/2>(a)), 0x0f0f);
+    hi = t;
+    z_lo = permute_bytes16(lut, lo);
+    z_hi = permute_bytes16(lut, hi);
+    // the count of the low nibble is used only if the high nibble is zero,
+    // in which case z_hi is 4
+    t = bit_and(shift_r<2>(uint16<N/2>(z_hi)), 0x0101);
+    m = sub(zero, uint8<N>(t));
+    uint8<N> r = add(z_hi, bit_and(z_lo, m));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> v_emul_lzcnt(const uint8<N>& a)
+{
+    // set all bits after the first set bit and count the bits that remain
+    // unset
+    uint16<N/2> p = (uint16<N/2>) a;
+    p = bit_or(p, bit_and(shift_r<1>(p), 0x7f7f));
+    p = bit_or(p, bit_and(shift_r<2>(p), 0x3f3f));
+    p = bit_or(p, bit_and(shift_r<4>(p), 0x0f0f));
+    uint8<N> r = sub(splat<uint8<N>>(8), i_popcnt(uint8<N>(p)));
+    return r;
+}
+
+/*  Computes the leading zero counts of W-bit elements given the leading zero
+    counts @a z of their W/2-bit halves.
+*/
+template<unsigned HalfBits, class V> SIMDPP_INL
+V v_lzcnt_combine(const V& z)
+{
+    V zero = make_zero();
+    V hi, lo, m;
+    hi = shift_r<HalfBits>(z);
+    lo = bit_and(z, (uint64_t(1) << HalfBits) - 1);
+    // hi == HalfBits only if the high half is zero; HalfBits is a power of two
+    m = shift_r<HalfBits == 32 ? 5 : HalfBits == 16 ? 4 : 3>(hi);
+    m = sub(zero, m);
+    V r = add(hi, bit_and(lo, m));
+    return r;
+}
+
+#if SIMDPP_USE_SSE2
+/*  The float conversion produces the index of the highest set bit in the
+    exponent. Only the highest bits of each run of set bits are kept so that
+    the conversion never rounds up to the next power of two. The result of the
+    conversion of values with the highest bit set is negative and the result
+    of zero is out of range; both are fixed by clamping the count to [0, 32].
+*/
+static SIMDPP_INL
+__m128i v_lzcnt_via_float(__m128i a)
+{
+    __m128i v = _mm_andnot_si128(_mm_srli_epi32(a, 1), a);
+    __m128i e = _mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(v)), 23);
+    __m128i r = _mm_sub_epi32(_mm_set1_epi32(158), e);
+    // the upper 16 bits of each valid count are zero
+    r = _mm_max_epi16(r, _mm_setzero_si128());
+    return _mm_min_epi16(r, _mm_set1_epi32(32));
+}
+#endif
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+__m256i v_lzcnt_via_float(__m256i a)
+{
+    __m256i v = _mm256_andnot_si256(_mm256_srli_epi32(a, 1), a);
+    __m256i e = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(v)), 23);
+    __m256i r = _mm256_sub_epi32(_mm256_set1_epi32(158), e);
+    r = _mm256_max_epi32(r, _mm256_setzero_si256());
+    return _mm256_min_epi32(r, _mm256_set1_epi32(32));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+__m512i v_lzcnt_via_float(__m512i a)
+{
+    __m512i v = _mm512_andnot_si512(_mm512_srli_epi32(a, 1), a);
+    __m512i e = _mm512_srli_epi32(_mm512_castps_si512(_mm512_cvtepi32_ps(v)), 23);
+    __m512i r = _mm512_sub_epi32(_mm512_set1_epi32(158), e);
+    r = _mm512_max_epi32(r, _mm512_setzero_si512());
+    return _mm512_min_epi32(r, _mm512_set1_epi32(32));
+}
+#endif
+
+static SIMDPP_INL
+uint8<16> i_lzcnt(const uint8<16>& a)
+{
+#if SIMDPP_USE_NULL
+    uint8<16> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        unsigned x = a.el(i), n = 8;
+        for (; x != 0; x >>= 1)
+            n--;
+        r.el(i) = n;
+    }
+    return r;
+#elif SIMDPP_USE_NEON
+    return vclzq_u8(a.native());
+#elif SIMDPP_USE_MSA
+    return (v16u8) __msa_nlzc_b((v16i8) a.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_cntlz(a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_ALTIVEC
+    return v_perm_lzcnt(a);
+#else
+    return v_emul_lzcnt(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_lzcnt(const uint8<32>& a)
+{
+    return v_perm_lzcnt(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_lzcnt(const uint8<64>& a)
+{
+    return v_perm_lzcnt(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_lzcnt(const uint8<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(uint8<N>, i_lzcnt, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_lzcnt(const uint16<8>& a)
+{
+#if SIMDPP_USE_NULL
+    uint16<8> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        unsigned x = a.el(i), n = 16;
+        for (; x != 0; x >>= 1)
+            n--;
+        r.el(i) = n;
+    }
+    return r;
+#elif SIMDPP_USE_NEON
+    return vclzq_u16(a.native());
+#elif SIMDPP_USE_MSA
+    return (v8u16) __msa_nlzc_h((v8i16) a.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_cntlz(a.native());
+#else
+    uint16<8> z = (uint16<8>) i_lzcnt(uint8<16>(a));
+    return v_lzcnt_combine<8>(z);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_lzcnt(const uint16<16>& a)
+{
+    uint16<16> z = (uint16<16>) i_lzcnt(uint8<32>(a));
+    return v_lzcnt_combine<8>(z);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_lzcnt(const uint16<32>& a)
+{
+    uint16<32> z = (uint16<32>) i_lzcnt(uint8<64>(a));
+    return v_lzcnt_combine<8>(z);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_lzcnt(const uint16<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(uint16<N>, i_lzcnt, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_lzcnt(const uint32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint32_t x = a.el(i);
+        unsigned n = 32;
+        for (; x != 0; x >>= 1)
+            n--;
+        r.el(i) = n;
+    }
+    return r;
+#elif SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm_lzcnt_epi32(a.native());
+#elif SIMDPP_USE_SSE2
+    return v_lzcnt_via_float(a.native());
+#elif SIMDPP_USE_NEON
+    return vclzq_u32(a.native());
+#elif SIMDPP_USE_MSA
+    return (v4u32) __msa_nlzc_w((v4i32) a.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_cntlz(a.native());
+#else
+    uint32<4> z = (uint32<4>) i_lzcnt(uint16<8>(a));
+    return v_lzcnt_combine<16>(z);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_lzcnt(const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm256_lzcnt_epi32(a.native());
+#else
+    return v_lzcnt_via_float(a.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_lzcnt(const uint32<16>& a)
+{
+#if SIMDPP_USE_AVX512CD
+    return _mm512_lzcnt_epi32(a.native());
+#else
+    return v_lzcnt_via_float(a.native());
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_lzcnt(const uint32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(uint32<N>, i_lzcnt, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_lzcnt(const uint64<2>& a)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint64_t x = a.el(i);
+        unsigned n = 64;
+        for (; x != 0; x >>= 1)
+            n--;
+        r.el(i) = n;
+    }
+    return r;
+#elif SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm_lzcnt_epi64(a.native());
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_nlzc_d((v2i64) a.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_cntlz(a.native());
+#else
+    uint64<2> z = (uint64<2>) i_lzcnt(uint32<4>(a));
+    return v_lzcnt_combine<32>(z);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_lzcnt(const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm256_lzcnt_epi64(a.native());
+#else
+    uint64<4> z = (uint64<4>) i_lzcnt(uint32<8>(a));
+    return v_lzcnt_combine<32>(z);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_lzcnt(const uint64<8>& a)
+{
+#if SIMDPP_USE_AVX512CD
+    return _mm512_lzcnt_epi64(a.native());
+#else
+    uint64<8> z = (uint64<8>) i_lzcnt(uint32<16>(a));
+    return v_lzcnt_combine<32>(z);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_lzcnt(const uint64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(uint64<N>, i_lzcnt, a)
+}
+
+// -----------------------------------------------------------------------------
+
+/*  The trailing zeros are turned into ones and all other bits are cleared,
+    (a - 1) & ~a. The ones are then counted either directly, where population
+    count is cheap, or as the number of bits minus the leading zero count.
+*/
+template<class V> SIMDPP_INL
+V i_tzcnt(const V& a)
+{
+    V t = bit_andnot(sub(a, 1), a);
+#if SIMDPP_USE_NEON || SIMDPP_USE_MSA || SIMDPP_USE_VSX_207
+    return i_popcnt(t);
+#else
+    V r = sub(splat<V>(V::num_bits), i_lzcnt(t));
+    return r;
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
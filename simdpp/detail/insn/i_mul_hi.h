@@ -13,8 +13,18 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
 #include <simdpp/core/i_mull.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
 #include <simdpp/core/unzip_hi.h>
+#include <simdpp/detail/insn/i_mul_lo.h>
+#include <simdpp/detail/insn/i_shift_l.h>
+#include <simdpp/detail/insn/i_shift_r.h>
+#include <simdpp/detail/mem_block.h>
 #include <simdpp/detail/null/math.h>
 #include <simdpp/detail/vector_array_macros.h>
 
@@ -113,6 +123,350 @@ uint16<32> i_mul_hi(const uint16<32>& a, const uint16<32>& b)
 
 // -----------------------------------------------------------------------------
 
+static SIMDPP_INL int8_t mul_hi_el(int8_t a, int8_t b)
+{
+    return (int16_t(a) * b) >> 8;
+}
+static SIMDPP_INL uint8_t mul_hi_el(uint8_t a, uint8_t b)
+{
+    return (uint16_t(a) * b) >> 8;
+}
+static SIMDPP_INL int32_t mul_hi_el(int32_t a, int32_t b)
+{
+    return (int64_t(a) * b) >> 32;
+}
+static SIMDPP_INL uint32_t mul_hi_el(uint32_t a, uint32_t b)
+{
+    return (uint64_t(a) * b) >> 32;
+}
+static SIMDPP_INL uint64_t mul_hi_el(uint64_t a, uint64_t b)
+{
+    uint64_t al = a & 0xffffffff, ah = a >> 32;
+    uint64_t bl = b & 0xffffffff, bh = b >> 32;
+    uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+    uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+}
+static SIMDPP_INL int64_t mul_hi_el(int64_t a, int64_t b)
+{
+    uint64_t r = mul_hi_el(uint64_t(a), uint64_t(b));
+    r -= a < 0 ? uint64_t(b) : 0;
+    r -= b < 0 ? uint64_t(a) : 0;
+    return int64_t(r);
+}
+
+// Multiplies the elements one by one
+template<class V> SIMDPP_INL
+V v_emul_mul_hi_scalar(const V& a, const V& b)
+{
+    mem_block<V> ba(a), bb(b);
+    for (unsigned i = 0; i < V::length; ++i) {
+        ba[i] = mul_hi_el(ba[i], bb[i]);
+    }
+    return ba;
+}
+
+/*  Computes the high half of a signed multiplication out of the high half of
+    the corresponding unsigned multiplication @a hu:
+        hi(a * b) = hu - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+*/
+template<class V, class U> SIMDPP_INL
+V v_mul_hi_fix_sign(const U& hu, const V& a, const V& b)
+{
+    const unsigned sign_shift = sizeof(typename V::element_type) * 8 - 1;
+    V sa, sb;
+    U fa, fb, r;
+    sa = i_shift_r<sign_shift>(a);
+    sb = i_shift_r<sign_shift>(b);
+    fa = bit_and(sa, b);
+    fb = bit_and(sb, a);
+    r = sub(hu, fa);
+    r = sub(r, fb);
+    return V(r);
+}
+
+// -----------------------------------------------------------------------------
+
+/*  Multiplies the even and odd 8-bit elements separately using 16-bit
+    multiplications and merges the high halves of the results.
+*/
+template<class V> SIMDPP_INL
+V v_emul_mul_hi_u8(const V& a, const V& b)
+{
+    using W = uint16<V::length/2>;
+    W a16, b16, ae, be, lo_mask;
+    a16 = a; b16 = b;
+    lo_mask = splat<W>(0x00ff);
+
+    ae = bit_and(a16, lo_mask);
+    be = bit_and(b16, lo_mask);
+    ae = i_mul_lo(ae, be);
+    ae = i_shift_r<8>(ae);
+
+    a16 = i_shift_r<8>(a16);
+    b16 = i_shift_r<8>(b16);
+    a16 = i_mul_lo(a16, b16);
+    a16 = bit_andnot(a16, lo_mask);
+
+    V r; r = bit_or(ae, a16);
+    return r;
+}
+
+template<class V> SIMDPP_INL
+V v_emul_mul_hi_i8(const V& a, const V& b)
+{
+    using W = int16<V::length/2>;
+    using U = uint16<V::length/2>;
+    U ua, ub, ae, be, ao, bo, lo_mask;
+    W s;
+    ua = a; ub = b;
+    lo_mask = splat<U>(0x00ff);
+
+    // sign-extend the even and odd elements to 16 bits
+    s = i_shift_l<8>(ua); ae = i_shift_r<8>(s);
+    s = i_shift_l<8>(ub); be = i_shift_r<8>(s);
+    s = ua; ao = i_shift_r<8>(s);
+    s = ub; bo = i_shift_r<8>(s);
+
+    ae = i_mul_lo(ae, be);
+    ae = i_shift_r<8>(ae);
+    ao = i_mul_lo(ao, bo);
+    ao = bit_andnot(ao, lo_mask);
+
+    V r; r = bit_or(ae, ao);
+    return r;
+}
+
+static SIMDPP_INL
+int8<16> i_mul_hi(const int8<16>& a, const int8<16>& b)
+{
+#if SIMDPP_USE_NULL
+    return v_emul_mul_hi_scalar(a, b);
+#elif SIMDPP_USE_NEON
+    int16x8 lo = vmull_s8(vget_low_s8(a.native()), vget_low_s8(b.native()));
+    int16x8 hi = vmull_s8(vget_high_s8(a.native()), vget_high_s8(b.native()));
+    return unzip16_hi(int8x16(lo), int8x16(hi));
+#else
+    return v_emul_mul_hi_i8(a, b);
+#endif
+}
+
+static SIMDPP_INL
+uint8<16> i_mul_hi(const uint8<16>& a, const uint8<16>& b)
+{
+#if SIMDPP_USE_NULL
+    return v_emul_mul_hi_scalar(a, b);
+#elif SIMDPP_USE_NEON
+    uint16x8 lo = vmull_u8(vget_low_u8(a.native()), vget_low_u8(b.native()));
+    uint16x8 hi = vmull_u8(vget_high_u8(a.native()), vget_high_u8(b.native()));
+    return unzip16_hi(uint8x16(lo), uint8x16(hi));
+#else
+    return v_emul_mul_hi_u8(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int8<32> i_mul_hi(const int8<32>& a, const int8<32>& b)
+{
+    return v_emul_mul_hi_i8(a, b);
+}
+
+static SIMDPP_INL
+uint8<32> i_mul_hi(const uint8<32>& a, const uint8<32>& b)
+{
+    return v_emul_mul_hi_u8(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+int8<64> i_mul_hi(const int8<64>& a, const int8<64>& b)
+{
+    return v_emul_mul_hi_i8(a, b);
+}
+
+static SIMDPP_INL
+uint8<64> i_mul_hi(const uint8<64>& a, const uint8<64>& b)
+{
+    return v_emul_mul_hi_u8(a, b);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_SSE2
+/*  Multiplies the even and odd 32-bit elements separately using
+    32x32->64-bit multiplications and merges the high halves of the results.
+    W selects whether the multiplication is signed.
+*/
+template<class V, class W> SIMDPP_INL
+V v_emul_mul_hi_32(const V& a, const V& b)
+{
+    using U = typename W::uint_vector_type;
+    U ua, ub, ev, od;
+    W wa, wb;
+    ua = a; ub = b;
+
+    wa = ua; wb = ub;
+    ev = i_mul_32x32_64(wa, wb);
+    ev = i_shift_r<32>(ev);
+
+    ua = i_shift_r<32>(ua);
+    ub = i_shift_r<32>(ub);
+    wa = ua; wb = ub;
+    od = i_mul_32x32_64(wa, wb);
+    od = bit_and(od, splat<U>(0xffffffff00000000));
+
+    V r; r = bit_or(ev, od);
+    return r;
+}
+#endif
+
+static SIMDPP_INL
+int32<4> i_mul_hi(const int32<4>& a, const int32<4>& b)
+{
+#if SIMDPP_USE_SSE4_1
+    return v_emul_mul_hi_32<int32<4>, int64<2>>(a, b);
+#elif SIMDPP_USE_SSE2
+    uint32<4> r = v_emul_mul_hi_32<uint32<4>, uint64<2>>(uint32<4>(a), uint32<4>(b));
+    return v_mul_hi_fix_sign(r, a, b);
+#elif SIMDPP_USE_NEON
+    int64x2 lo = vmull_s32(vget_low_s32(a.native()), vget_low_s32(b.native()));
+    int64x2 hi = vmull_s32(vget_high_s32(a.native()), vget_high_s32(b.native()));
+    return unzip4_hi(int32x4(lo), int32x4(hi));
+#else
+    return v_emul_mul_hi_scalar(a, b);
+#endif
+}
+
+static SIMDPP_INL
+uint32<4> i_mul_hi(const uint32<4>& a, const uint32<4>& b)
+{
+#if SIMDPP_USE_SSE2
+    return v_emul_mul_hi_32<uint32<4>, uint64<2>>(a, b);
+#elif SIMDPP_USE_NEON
+    uint64x2 lo = vmull_u32(vget_low_u32(a.native()), vget_low_u32(b.native()));
+    uint64x2 hi = vmull_u32(vget_high_u32(a.native()), vget_high_u32(b.native()));
+    return unzip4_hi(uint32x4(lo), uint32x4(hi));
+#else
+    return v_emul_mul_hi_scalar(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int32<8> i_mul_hi(const int32<8>& a, const int32<8>& b)
+{
+    return v_emul_mul_hi_32<int32<8>, int64<4>>(a, b);
+}
+
+static SIMDPP_INL
+uint32<8> i_mul_hi(const uint32<8>& a, const uint32<8>& b)
+{
+    return v_emul_mul_hi_32<uint32<8>, uint64<4>>(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_mul_hi(const int32<16>& a, const int32<16>& b)
+{
+    return v_emul_mul_hi_32<int32<16>, int64<8>>(a, b);
+}
+
+static SIMDPP_INL
+uint32<16> i_mul_hi(const uint32<16>& a, const uint32<16>& b)
+{
+    return v_emul_mul_hi_32<uint32<16>, uint64<8>>(a, b);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_SSE2 || SIMDPP_USE_NEON
+/*  Computes the high half of the product out of four 32x32->64-bit
+    multiplications, propagating the carries out of the middle terms.
+*/
+template<class V> SIMDPP_INL
+V v_emul_mul_hi_u64(const V& a, const V& b)
+{
+    V ah, bh, ll, lh, hl, hh, mid, lo_mask;
+    ah = i_shift_r<32>(a);
+    bh = i_shift_r<32>(b);
+    ll = i_mul_32x32_64(a, b);
+    lh = i_mul_32x32_64(a, bh);
+    hl = i_mul_32x32_64(ah, b);
+    hh = i_mul_32x32_64(ah, bh);
+
+    lo_mask = splat<V>(0xffffffff);
+    ll = i_shift_r<32>(ll);
+    mid = add(ll, bit_and(lh, lo_mask));
+    mid = add(mid, bit_and(hl, lo_mask));
+    mid = i_shift_r<32>(mid);
+
+    lh = i_shift_r<32>(lh);
+    hl = i_shift_r<32>(hl);
+    hh = add(hh, lh);
+    hh = add(hh, hl);
+    V r; r = add(hh, mid);
+    return r;
+}
+#endif
+
+static SIMDPP_INL
+int64<2> i_mul_hi(const int64<2>& a, const int64<2>& b)
+{
+#if SIMDPP_USE_SSE2 || SIMDPP_USE_NEON
+    uint64<2> r = v_emul_mul_hi_u64(uint64<2>(a), uint64<2>(b));
+    return v_mul_hi_fix_sign(r, a, b);
+#else
+    return v_emul_mul_hi_scalar(a, b);
+#endif
+}
+
+static SIMDPP_INL
+uint64<2> i_mul_hi(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_SSE2 || SIMDPP_USE_NEON
+    return v_emul_mul_hi_u64(a, b);
+#else
+    return v_emul_mul_hi_scalar(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int64<4> i_mul_hi(const int64<4>& a, const int64<4>& b)
+{
+    uint64<4> r = v_emul_mul_hi_u64(uint64<4>(a), uint64<4>(b));
+    return v_mul_hi_fix_sign(r, a, b);
+}
+
+static SIMDPP_INL
+uint64<4> i_mul_hi(const uint64<4>& a, const uint64<4>& b)
+{
+    return v_emul_mul_hi_u64(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int64<8> i_mul_hi(const int64<8>& a, const int64<8>& b)
+{
+    uint64<8> r = v_emul_mul_hi_u64(uint64<8>(a), uint64<8>(b));
+    return v_mul_hi_fix_sign(r, a, b);
+}
+
+static SIMDPP_INL
+uint64<8> i_mul_hi(const uint64<8>& a, const uint64<8>& b)
+{
+    return v_emul_mul_hi_u64(a, b);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 template<class V> SIMDPP_INL
 V i_mul_hi(const V& a, const V& b)
 {
@@ -13,10 +13,17 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
 #include <simdpp/core/i_mull.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/permute4.h>
+#include <simdpp/core/set_splat.h>
 #include <simdpp/core/shuffle2.h>
+#include <simdpp/detail/insn/i_shift_l.h>
+#include <simdpp/detail/insn/i_shift_r.h>
+#include <simdpp/detail/mem_block.h>
 #include <simdpp/detail/null/math.h>
 #include <simdpp/detail/vector_array_macros.h>
 
@@ -140,6 +147,183 @@ uint32<16> i_mul_lo(const uint32<16>& a, const uint32<16>& b)
 
 // -----------------------------------------------------------------------------
 
+// Multiplies the elements one by one
+template<class V> SIMDPP_INL
+V v_emul_mul_lo_scalar(const V& a, const V& b)
+{
+    mem_block<V> ba(a), bb(b);
+    for (unsigned i = 0; i < V::length; ++i) {
+        ba[i] = ba[i] * bb[i];
+    }
+    return ba;
+}
+
+/*  Multiplies the even and odd 8-bit elements separately using 16-bit
+    multiplications and merges the results.
+*/
+template<class V> SIMDPP_INL
+V v_emul_mul_lo_u8(const V& a, const V& b)
+{
+    using W = uint16<V::length/2>;
+    W a16, b16, lo, hi;
+    a16 = a; b16 = b;
+
+    lo = i_mul_lo(a16, b16);
+    lo = bit_and(lo, splat<W>(0x00ff));
+
+    a16 = i_shift_r<8>(a16);
+    b16 = i_shift_r<8>(b16);
+    hi = i_mul_lo(a16, b16);
+    hi = i_shift_l<8>(hi);
+
+    V r; r = bit_or(lo, hi);
+    return r;
+}
+
+static SIMDPP_INL
+uint8<16> i_mul_lo(const uint8<16>& a, const uint8<16>& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::mul(a, b);
+#elif SIMDPP_USE_NEON
+    return vmulq_u8(a.native(), b.native());
+#elif SIMDPP_USE_MSA
+    return (v16u8) __msa_mulv_b((v16i8) a.native(), (v16i8) b.native());
+#else
+    return v_emul_mul_lo_u8(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_mul_lo(const uint8<32>& a, const uint8<32>& b)
+{
+    return v_emul_mul_lo_u8(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_mul_lo(const uint8<64>& a, const uint8<64>& b)
+{
+    return v_emul_mul_lo_u8(a, b);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_SSE2 || SIMDPP_USE_NEON
+/*  Multiplies the lower 32 bits of the 64-bit elements producing 64-bit
+    results. The signed variant interprets the lower 32 bits as signed.
+*/
+static SIMDPP_INL
+uint64<2> i_mul_32x32_64(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_SSE2
+    return _mm_mul_epu32(a.native(), b.native());
+#else
+    return vmull_u32(vmovn_u64(a.native()), vmovn_u64(b.native()));
+#endif
+}
+
+#if SIMDPP_USE_SSE4_1
+static SIMDPP_INL
+int64<2> i_mul_32x32_64(const int64<2>& a, const int64<2>& b)
+{
+    return _mm_mul_epi32(a.native(), b.native());
+}
+#endif
+#endif
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_mul_32x32_64(const uint64<4>& a, const uint64<4>& b)
+{
+    return _mm256_mul_epu32(a.native(), b.native());
+}
+
+static SIMDPP_INL
+int64<4> i_mul_32x32_64(const int64<4>& a, const int64<4>& b)
+{
+    return _mm256_mul_epi32(a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_mul_32x32_64(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_mul_epu32(a.native(), b.native());
+}
+
+static SIMDPP_INL
+int64<8> i_mul_32x32_64(const int64<8>& a, const int64<8>& b)
+{
+    return _mm512_mul_epi32(a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_SSE2 || SIMDPP_USE_NEON
+/*  Computes the lower half of the product out of three 32x32->64-bit
+    multiplications:
+        a * b = (ah * bh) << 64 + (ah * bl + al * bh) << 32 + al * bl
+*/
+template<class V> SIMDPP_INL
+V v_emul_mul_lo_u64(const V& a, const V& b)
+{
+    V ah, bh, ll, lh, hl;
+    ah = i_shift_r<32>(a);
+    bh = i_shift_r<32>(b);
+    ll = i_mul_32x32_64(a, b);
+    lh = i_mul_32x32_64(a, bh);
+    hl = i_mul_32x32_64(ah, b);
+    lh = add(lh, hl);
+    lh = i_shift_l<32>(lh);
+    V r; r = add(ll, lh);
+    return r;
+}
+#endif
+
+static SIMDPP_INL
+uint64<2> i_mul_lo(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm_mullo_epi64(a.native(), b.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON
+    return v_emul_mul_lo_u64(a, b);
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_mulv_d((v2i64) a.native(), (v2i64) b.native());
+#elif SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    return v_emul_mul_lo_scalar(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_mul_lo(const uint64<4>& a, const uint64<4>& b)
+{
+#if SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm256_mullo_epi64(a.native(), b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_mul_lo(const uint64<8>& a, const uint64<8>& b)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_mullo_epi64(a.native(), b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 template<class V> SIMDPP_INL
 V i_mul_lo(const V& a, const V& b)
 {
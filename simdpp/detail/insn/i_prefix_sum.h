@@ -0,0 +1,305 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_PREFIX_SUM_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_PREFIX_SUM_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/move_r.h>
+#include <simdpp/detail/insn/splat.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The prefix sum is computed in three steps. First, a log-step scan is
+    performed within each 128-bit lane using the element moves which don't
+    cross lanes and are thus cheap on all architectures. Then the totals of
+    the preceding lanes of a native 256-bit or 512-bit vector are added to
+    each lane. Finally, vectors of a vector array are processed sequentially,
+    the last element of the previous vector being broadcast and added to the
+    next one.
+
+    Signed integer vectors are processed as unsigned ones, the sums wrap
+    around in both cases.
+*/
+
+// Inclusive scan within each 128-bit lane
+template<unsigned N> SIMDPP_INL
+uint8<N> v_scan_lanes(const uint8<N>& a)
+{
+    uint8<N> r = a;
+    r = add(r, move16_r<1>(r));
+    r = add(r, move16_r<2>(r));
+    r = add(r, move16_r<4>(r));
+    r = add(r, move16_r<8>(r));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> v_scan_lanes(const uint16<N>& a)
+{
+    uint16<N> r = a;
+    r = add(r, move8_r<1>(r));
+    r = add(r, move8_r<2>(r));
+    r = add(r, move8_r<4>(r));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> v_scan_lanes(const uint32<N>& a)
+{
+    uint32<N> r = a;
+    r = add(r, move4_r<1>(r));
+    r = add(r, move4_r<2>(r));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> v_scan_lanes(const uint64<N>& a)
+{
+    uint64<N> r = a;
+    r = add(r, move2_r<1>(r));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> v_scan_lanes(const float32<N>& a)
+{
+    float32<N> r = a;
+    r = add(r, move4_r<1>(r));
+    r = add(r, move4_r<2>(r));
+    return r;
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_scan_lanes(const float64<N>& a)
+{
+    float64<N> r = a;
+    r = add(r, move2_r<1>(r));
+    return r;
+}
+
+// Moves the elements within each 128-bit lane by one position
+template<unsigned N> SIMDPP_INL
+uint8<N> v_move1_lanes(const uint8<N>& a) { return move16_r<1>(a); }
+template<unsigned N> SIMDPP_INL
+uint16<N> v_move1_lanes(const uint16<N>& a) { return move8_r<1>(a); }
+template<unsigned N> SIMDPP_INL
+uint32<N> v_move1_lanes(const uint32<N>& a) { return move4_r<1>(a); }
+template<unsigned N> SIMDPP_INL
+uint64<N> v_move1_lanes(const uint64<N>& a) { return move2_r<1>(a); }
+template<unsigned N> SIMDPP_INL
+float32<N> v_move1_lanes(const float32<N>& a) { return move4_r<1>(a); }
+template<unsigned N> SIMDPP_INL
+float64<N> v_move1_lanes(const float64<N>& a) { return move2_r<1>(a); }
+
+/*  Returns the sum of the totals of the preceding 128-bit lanes for each lane
+    of a native vector. The argument must contain the in-lane inclusive scan.
+*/
+template<class V> SIMDPP_INL
+V i_lane_carry(const V&)
+{
+    // 128-bit vectors consist of a single lane
+    return (V) make_zero();
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+__m256i v_lane_carry_256(__m256i last)
+{
+    // [0, lane0]
+    return _mm256_permute2x128_si256(last, last, 0x08);
+}
+
+static SIMDPP_INL
+uint8<32> i_lane_carry(const uint8<32>& a)
+{
+    __m256i last = _mm256_shuffle_epi8(a.native(), _mm256_set1_epi8(15));
+    return v_lane_carry_256(last);
+}
+
+static SIMDPP_INL
+uint16<16> i_lane_carry(const uint16<16>& a)
+{
+    __m256i last = _mm256_shuffle_epi8(a.native(), _mm256_set1_epi16(0x0f0e));
+    return v_lane_carry_256(last);
+}
+
+static SIMDPP_INL
+uint32<8> i_lane_carry(const uint32<8>& a)
+{
+    return v_lane_carry_256(_mm256_shuffle_epi32(a.native(), 0xff));
+}
+
+static SIMDPP_INL
+uint64<4> i_lane_carry(const uint64<4>& a)
+{
+    return v_lane_carry_256(_mm256_shuffle_epi32(a.native(), 0xee));
+}
+#endif
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32<8> i_lane_carry(const float32<8>& a)
+{
+    __m256 last = _mm256_permute_ps(a.native(), 0xff);
+    return _mm256_permute2f128_ps(last, last, 0x08);
+}
+
+static SIMDPP_INL
+float64<4> i_lane_carry(const float64<4>& a)
+{
+    __m256d last = _mm256_permute_pd(a.native(), 0x0f);
+    return _mm256_permute2f128_pd(last, last, 0x08);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+// Moves the 128-bit lanes by the given number of positions
+template<unsigned lanes> SIMDPP_INL
+__m512i v_move_lanes_512(__m512i a)
+{
+    return _mm512_alignr_epi32(a, _mm512_setzero_si512(), 16 - lanes*4);
+}
+
+/*  Computes the exclusive scan of the 128-bit lanes of @a last, each of which
+    contains the total of the lane in all elements.
+*/
+template<class V> SIMDPP_INL
+V v_lane_carry_512(const V& last)
+{
+    V x, y;
+    // [0, t0, t1, t2]
+    x = V(v_move_lanes_512<1>(last.native()));
+    // [0, t0, t0+t1, t1+t2]
+    y = add(x, V(v_move_lanes_512<1>(x.native())));
+    // [0, t0, t0+t1, t0+t1+t2]
+    y = add(y, V(v_move_lanes_512<2>(y.native())));
+    return y;
+}
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_lane_carry(const uint8<64>& a)
+{
+    uint8<64> last = _mm512_shuffle_epi8(a.native(), _mm512_set1_epi8(15));
+    return v_lane_carry_512(last);
+}
+
+static SIMDPP_INL
+uint16<32> i_lane_carry(const uint16<32>& a)
+{
+    uint16<32> last = _mm512_shuffle_epi8(a.native(), _mm512_set1_epi16(0x0f0e));
+    return v_lane_carry_512(last);
+}
+#endif
+
+static SIMDPP_INL
+uint32<16> i_lane_carry(const uint32<16>& a)
+{
+    uint32<16> last = _mm512_shuffle_epi32(a.native(), _MM_PERM_DDDD);
+    return v_lane_carry_512(last);
+}
+
+static SIMDPP_INL
+uint64<8> i_lane_carry(const uint64<8>& a)
+{
+    uint64<8> last = _mm512_shuffle_epi32(a.native(), _MM_PERM_DCDC);
+    return v_lane_carry_512(last);
+}
+
+static SIMDPP_INL
+float32<16> i_lane_carry(const float32<16>& a)
+{
+    uint32<16> last = _mm512_castps_si512(_mm512_permute_ps(a.native(), 0xff));
+    float32<16> x, y;
+    x = _mm512_castsi512_ps(v_move_lanes_512<1>(last.native()));
+    y = add(x, float32<16>(_mm512_castsi512_ps(
+                v_move_lanes_512<1>(_mm512_castps_si512(x.native())))));
+    y = add(y, float32<16>(_mm512_castsi512_ps(
+                v_move_lanes_512<2>(_mm512_castps_si512(y.native())))));
+    return y;
+}
+
+static SIMDPP_INL
+float64<8> i_lane_carry(const float64<8>& a)
+{
+    uint64<8> last = _mm512_castpd_si512(_mm512_permute_pd(a.native(), 0xff));
+    float64<8> x, y;
+    x = _mm512_castsi512_pd(v_move_lanes_512<1>(last.native()));
+    y = add(x, float64<8>(_mm512_castsi512_pd(
+                v_move_lanes_512<1>(_mm512_castpd_si512(x.native())))));
+    y = add(y, float64<8>(_mm512_castsi512_pd(
+                v_move_lanes_512<2>(_mm512_castpd_si512(y.native())))));
+    return y;
+}
+#endif
+
+/*  Computes the inclusive and the exclusive prefix sums of a native vector.
+    Both are computed from the same inclusive scan so that the results are
+    consistent for floating-point values.
+*/
+template<class V> SIMDPP_INL
+void v_prefix_sum_base(const V& a, V& incl, V& excl)
+{
+    V s = v_scan_lanes(a);
+    V carry = i_lane_carry(s);
+    incl = add(s, carry);
+    excl = v_move1_lanes(s);
+    excl = add(excl, carry);
+}
+
+/*  Computes the inclusive and the exclusive prefix sums of a vector. The
+    vectors of a vector array are processed sequentially.
+*/
+template<class V> SIMDPP_INL
+void i_prefix_sum2(const V& a, V& incl, V& excl)
+{
+    using B = typename V::base_vector_type;
+    B carry = (B) make_zero();
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        B vi, ve;
+        v_prefix_sum_base(a.vec(i), vi, ve);
+        vi = add(vi, carry);
+        ve = add(ve, carry);
+        incl.vec(i) = vi;
+        excl.vec(i) = ve;
+        carry = i_splat<B::length - 1>(vi);
+    }
+}
+
+template<class V> SIMDPP_INL
+V i_prefix_sum(const V& a)
+{
+    V incl, excl;
+    i_prefix_sum2(a, incl, excl);
+    return incl;
+}
+
+template<class V> SIMDPP_INL
+V i_exclusive_prefix_sum(const V& a)
+{
+    V incl, excl;
+    i_prefix_sum2(a, incl, excl);
+    return excl;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,444 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_ROTATE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_ROTATE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/capabilities.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/mem_block.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Where no native rotate is available, the rotates are computed as the
+    bitwise OR of a left and a right shift. The count of the right shift is
+    taken modulo the element width, thus a rotate by zero is computed as
+    a | a.
+*/
+template<unsigned count, class V> SIMDPP_INL
+V v_emul_rotl(const V& a)
+{
+    const unsigned bits = V::num_bits;
+    V r = bit_or(shift_l<count>(a), shift_r<(bits - count) % bits>(a));
+    return r;
+}
+
+template<unsigned count> SIMDPP_INL
+uint8<16> i_rotl(const uint8<16>& a)
+{
+#if SIMDPP_USE_NULL
+    uint8<16> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        unsigned x = a.el(i);
+        r.el(i) = uint8_t((x << count) | (x >> (8 - count)));
+    }
+    return r;
+#elif SIMDPP_USE_XOP
+    return _mm_roti_epi8(a.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u8(vshlq_n_u8(a.native(), count), a.native(), 8 - count);
+#elif SIMDPP_USE_ALTIVEC
+    uint8<16> c = splat(count);
+    return vec_rl(a.native(), c.native());
+#else
+    return v_emul_rotl<count>(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint8<32> i_rotl(const uint8<32>& a)
+{
+    return v_emul_rotl<count>(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint8<64> i_rotl(const uint8<64>& a)
+{
+    return v_emul_rotl<count>(a);
+}
+#endif
+
+template<unsigned count> SIMDPP_INL
+uint16<8> i_rotl(const uint16<8>& a)
+{
+#if SIMDPP_USE_NULL
+    uint16<8> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        unsigned x = a.el(i);
+        r.el(i) = uint16_t((x << count) | (x >> (16 - count)));
+    }
+    return r;
+#elif SIMDPP_USE_XOP
+    return _mm_roti_epi16(a.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u16(vshlq_n_u16(a.native(), count), a.native(), 16 - count);
+#elif SIMDPP_USE_ALTIVEC
+    uint16<8> c = splat(count);
+    return vec_rl(a.native(), c.native());
+#else
+    return v_emul_rotl<count>(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint16<16> i_rotl(const uint16<16>& a)
+{
+    return v_emul_rotl<count>(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint16<32> i_rotl(const uint16<32>& a)
+{
+    return v_emul_rotl<count>(a);
+}
+#endif
+
+template<unsigned count> SIMDPP_INL
+uint32<4> i_rotl(const uint32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint32_t x = a.el(i);
+        r.el(i) = (x << count) | (x >> ((32 - count) % 32));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VL
+    return _mm_rol_epi32(a.native(), count);
+#elif SIMDPP_USE_XOP
+    return _mm_roti_epi32(a.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u32(vshlq_n_u32(a.native(), count), a.native(), 32 - count);
+#elif SIMDPP_USE_ALTIVEC
+    uint32<4> c = splat(count);
+    return vec_rl(a.native(), c.native());
+#else
+    return v_emul_rotl<count>(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint32<8> i_rotl(const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rol_epi32(a.native(), count);
+#else
+    return v_emul_rotl<count>(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned count> SIMDPP_INL
+uint32<16> i_rotl(const uint32<16>& a)
+{
+    return _mm512_rol_epi32(a.native(), count);
+}
+#endif
+
+template<unsigned count> SIMDPP_INL
+uint64<2> i_rotl(const uint64<2>& a)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint64_t x = a.el(i);
+        r.el(i) = (x << count) | (x >> ((64 - count) % 64));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VL
+    return _mm_rol_epi64(a.native(), count);
+#elif SIMDPP_USE_XOP
+    return _mm_roti_epi64(a.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u64(vshlq_n_u64(a.native(), count), a.native(), 64 - count);
+#elif SIMDPP_USE_VSX_207
+    uint64<2> c = splat(count);
+    return vec_rl(a.native(), c.native());
+#else
+    return v_emul_rotl<count>(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint64<4> i_rotl(const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rol_epi64(a.native(), count);
+#else
+    return v_emul_rotl<count>(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned count> SIMDPP_INL
+uint64<8> i_rotl(const uint64<8>& a)
+{
+    return _mm512_rol_epi64(a.native(), count);
+}
+#endif
+
+template<unsigned count, class V> SIMDPP_INL
+V i_rotl(const V& a)
+{
+    V r;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        r.vec(i) = i_rotl<count>(a.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+/*  The variable rotates take the counts modulo the element width, thus the
+    right shift count is never equal to the element width.
+*/
+template<class V> SIMDPP_INL
+V v_emul_rotl_v(const V& a, const V& count)
+{
+    const unsigned bits = V::num_bits;
+    V c, rc;
+    c = bit_and(count, bits - 1);
+    rc = bit_and(sub(splat<V>(bits), c), bits - 1);
+    V r = bit_or(shift_l(a, c), shift_r(a, rc));
+    return r;
+}
+
+#if SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR
+static SIMDPP_INL
+uint8<16> i_rotl_v(const uint8<16>& a, const uint8<16>& count)
+{
+#if SIMDPP_USE_NULL
+    uint8<16> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        unsigned x = a.el(i), c = count.el(i) % 8;
+        r.el(i) = uint8_t((x << c) | (x >> ((8 - c) % 8)));
+    }
+    return r;
+#elif SIMDPP_USE_XOP
+    return _mm_rot_epi8(a.native(), count.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_rl(a.native(), count.native());
+#else
+    return v_emul_rotl_v(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_rotl_v(const uint8<32>& a, const uint8<32>& count)
+{
+    return v_emul_rotl_v(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_rotl_v(const uint8<64>& a, const uint8<64>& count)
+{
+    return v_emul_rotl_v(a, count);
+}
+#endif
+#endif
+
+#if SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR
+static SIMDPP_INL
+uint16<8> i_rotl_v(const uint16<8>& a, const uint16<8>& count)
+{
+#if SIMDPP_USE_NULL
+    uint16<8> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        unsigned x = a.el(i), c = count.el(i) % 16;
+        r.el(i) = uint16_t((x << c) | (x >> ((16 - c) % 16)));
+    }
+    return r;
+#elif SIMDPP_USE_XOP
+    return _mm_rot_epi16(a.native(), count.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_rl(a.native(), count.native());
+#else
+    return v_emul_rotl_v(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_rotl_v(const uint16<16>& a, const uint16<16>& count)
+{
+    return v_emul_rotl_v(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_rotl_v(const uint16<32>& a, const uint16<32>& count)
+{
+    return v_emul_rotl_v(a, count);
+}
+#endif
+#endif
+
+#if SIMDPP_HAS_UINT32_ROTATE_BY_VECTOR
+static SIMDPP_INL
+uint32<4> i_rotl_v(const uint32<4>& a, const uint32<4>& count)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint32_t x = a.el(i);
+        unsigned c = count.el(i) % 32;
+        r.el(i) = (x << c) | (x >> ((32 - c) % 32));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VL
+    return _mm_rolv_epi32(a.native(), count.native());
+#elif SIMDPP_USE_XOP
+    return _mm_rot_epi32(a.native(), count.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_rl(a.native(), count.native());
+#else
+    return v_emul_rotl_v(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_rotl_v(const uint32<8>& a, const uint32<8>& count)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rolv_epi32(a.native(), count.native());
+#else
+    return v_emul_rotl_v(a, count);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_rotl_v(const uint32<16>& a, const uint32<16>& count)
+{
+    return _mm512_rolv_epi32(a.native(), count.native());
+}
+#endif
+#endif
+
+#if SIMDPP_HAS_UINT64_ROTATE_BY_VECTOR
+/*  There are no 64-bit variable shifts before AVX2. On SSE2 each element is
+    rotated using the shifts that take the count from the low element of a
+    vector and the results are merged. Other instruction sets rotate the
+    elements one by one.
+*/
+static SIMDPP_INL
+uint64<2> i_rotl_v(const uint64<2>& a, const uint64<2>& count)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        uint64_t x = a.el(i);
+        unsigned c = count.el(i) % 64;
+        r.el(i) = (x << c) | (x >> ((64 - c) % 64));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VL
+    return _mm_rolv_epi64(a.native(), count.native());
+#elif SIMDPP_USE_XOP
+    return _mm_rot_epi64(a.native(), count.native());
+#elif SIMDPP_USE_AVX2
+    // the right shift by 64 produces zero
+    uint64<2> c = bit_and(count, 63);
+    uint64<2> rc = sub(splat<uint64<2>>(64), c);
+    return _mm_or_si128(_mm_sllv_epi64(a.native(), c.native()),
+                        _mm_srlv_epi64(a.native(), rc.native()));
+#elif SIMDPP_USE_SSE2
+    uint64<2> c = bit_and(count, 63);
+    uint64<2> rc = sub(splat<uint64<2>>(64), c);
+    __m128i c_hi = _mm_unpackhi_epi64(c.native(), c.native());
+    __m128i rc_hi = _mm_unpackhi_epi64(rc.native(), rc.native());
+    __m128i r_lo = _mm_or_si128(_mm_sll_epi64(a.native(), c.native()),
+                                _mm_srl_epi64(a.native(), rc.native()));
+    __m128i r_hi = _mm_or_si128(_mm_sll_epi64(a.native(), c_hi),
+                                _mm_srl_epi64(a.native(), rc_hi));
+    return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(r_hi),
+                                        _mm_castsi128_pd(r_lo)));
+#elif SIMDPP_USE_NEON
+    // negative counts shift right, the right shift by 64 produces zero
+    int64x2_t c = vreinterpretq_s64_u64(vandq_u64(count.native(),
+                                                  vdupq_n_u64(63)));
+    int64x2_t rc = vsubq_s64(c, vdupq_n_s64(64));
+    return vorrq_u64(vshlq_u64(a.native(), c), vshlq_u64(a.native(), rc));
+#elif SIMDPP_USE_VSX_207
+    return vec_rl(a.native(), count.native());
+#else
+    detail::mem_block<uint64<2>> ma(a), mc(count);
+    for (unsigned i = 0; i < 2; i++) {
+        uint64_t x = ma[i];
+        unsigned c = mc[i] % 64;
+        ma[i] = (x << c) | (x >> ((64 - c) % 64));
+    }
+    return ma;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_rotl_v(const uint64<4>& a, const uint64<4>& count)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rolv_epi64(a.native(), count.native());
+#else
+    uint64<4> c = bit_and(count, 63);
+    uint64<4> rc = sub(splat<uint64<4>>(64), c);
+    return _mm256_or_si256(_mm256_sllv_epi64(a.native(), c.native()),
+                           _mm256_srlv_epi64(a.native(), rc.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_rotl_v(const uint64<8>& a, const uint64<8>& count)
+{
+    return _mm512_rolv_epi64(a.native(), count.native());
+}
+#endif
+#endif
+
+template<class V> SIMDPP_INL
+V i_rotl_v(const V& a, const V& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(V, i_rotl_v, a, count)
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
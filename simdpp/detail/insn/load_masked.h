@@ -0,0 +1,393 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_MASKED_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Loads only the elements that are selected by the mask, the rest of the
+    elements are set to zero. The memory corresponding to the unselected
+    elements is never accessed, thus the emulation reads the selected
+    elements one by one.
+*/
+template<class V, class M> SIMDPP_INL
+void v_emul_load_masked(V& a, const char* p, const M& mask)
+{
+    using E = typename V::element_type;
+    using U = typename V::uint_vector_type;
+    const E* q = reinterpret_cast<const E*>(p);
+
+    mem_block<U> m(bit_cast<U>(mask.unmask()));
+    mem_block<V> r;
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = m[i] ? q[i] : E(0);
+    }
+    a = r;
+}
+
+static SIMDPP_INL
+void i_load_masked(uint8<16>& a, const char* p, const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi8(mask.native(), p);
+#else
+    v_emul_load_masked(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint8<32>& a, const char* p, const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi8(mask.native(), p);
+#else
+    v_emul_load_masked(a, p, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_load_masked(uint8<64>& a, const char* p, const mask_int8<64>& mask)
+{
+    a = _mm512_maskz_loadu_epi8(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint16<8>& a, const char* p, const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi16(mask.native(), p);
+#else
+    v_emul_load_masked(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint16<16>& a, const char* p, const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi16(mask.native(), p);
+#else
+    v_emul_load_masked(a, p, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_load_masked(uint16<32>& a, const char* p, const mask_int16<32>& mask)
+{
+    a = _mm512_maskz_loadu_epi16(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint32<4>& a, const char* p, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi32(mask.native(), p);
+#elif SIMDPP_USE_AVX2
+    a = _mm_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#elif SIMDPP_USE_AVX
+    a = _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(p),
+                                         mask.native()));
+#else
+    v_emul_load_masked(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint32<8>& a, const char* p, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi32(mask.native(), p);
+#else
+    a = _mm256_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(uint32<16>& a, const char* p, const mask_int32<16>& mask)
+{
+    a = _mm512_maskz_loadu_epi32(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint64<2>& a, const char* p, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_epi64(mask.native(), p);
+#elif SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    a = _mm_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    a = _mm_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+#elif SIMDPP_USE_AVX
+    a = _mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double*>(p),
+                                         mask.native()));
+#else
+    v_emul_load_masked(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint64<4>& a, const char* p, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_epi64(mask.native(), p);
+#elif __INTEL_COMPILER
+    a = _mm256_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    a = _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(uint64<8>& a, const char* p, const mask_int64<8>& mask)
+{
+    a = _mm512_maskz_loadu_epi64(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(float32<4>& a, const char* p, const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_ps(mask.native(), reinterpret_cast<const float*>(p));
+#elif SIMDPP_USE_AVX
+    a = _mm_maskload_ps(reinterpret_cast<const float*>(p),
+                        _mm_castps_si128(mask.native()));
+#else
+    v_emul_load_masked(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_masked(float32<8>& a, const char* p, const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_ps(mask.native(), reinterpret_cast<const float*>(p));
+#else
+    a = _mm256_maskload_ps(reinterpret_cast<const float*>(p),
+                           _mm256_castps_si256(mask.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(float32<16>& a, const char* p, const mask_float32<16>& mask)
+{
+    a = _mm512_maskz_loadu_ps(mask.native(), reinterpret_cast<const float*>(p));
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(float64<2>& a, const char* p, const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm_maskz_loadu_pd(mask.native(), reinterpret_cast<const double*>(p));
+#elif SIMDPP_USE_AVX
+    a = _mm_maskload_pd(reinterpret_cast<const double*>(p),
+                        _mm_castpd_si128(mask.native()));
+#else
+    v_emul_load_masked(a, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_masked(float64<4>& a, const char* p, const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    a = _mm256_maskz_loadu_pd(mask.native(), reinterpret_cast<const double*>(p));
+#else
+    a = _mm256_maskload_pd(reinterpret_cast<const double*>(p),
+                           _mm256_castpd_si256(mask.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(float64<8>& a, const char* p, const mask_float64<8>& mask)
+{
+    a = _mm512_maskz_loadu_pd(mask.native(), reinterpret_cast<const double*>(p));
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class M> SIMDPP_INL
+void i_load_masked(V& a, const char* p, const M& mask)
+{
+    const unsigned veclen = V::base_vector_type::length_bytes;
+
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_load_masked(a.vec(i), p, mask.vec(i));
+        p += veclen;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Whether the masked load of the native vector V is a single instruction
+template<class V>
+struct has_native_load_masked {
+    static const bool is_32_64 = V::size_tag == SIMDPP_TAG_SIZE32 ||
+                                 V::size_tag == SIMDPP_TAG_SIZE64;
+    static const bool value =
+        is_32_64 ? (V::length_bytes == 64 ? SIMDPP_USE_AVX512F : SIMDPP_USE_AVX) :
+                   (V::length_bytes == 64 ? SIMDPP_USE_AVX512BW :
+                        SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL);
+};
+
+template<class M> SIMDPP_INL
+void i_load_mask_cast(const M& mask, M& r)
+{
+    r = mask;
+}
+
+template<class M, class MV> SIMDPP_INL
+void i_load_mask_cast(const M& mask, MV& r)
+{
+    r = bit_cast<MV>(mask);
+}
+
+/*  Returns the mask that selects the elements in range [first, first + n) of
+    a native vector. The mask is loaded from a table that contains 64 zero
+    bytes, 64 0xff bytes and 64 zero bytes.
+*/
+template<class V> SIMDPP_INL
+typename V::mask_vector_type i_load_range_mask(unsigned first, unsigned n)
+{
+    static const uint8_t table[192] = {
+        0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+    };
+    using U = typename V::uint_vector_type;
+    const unsigned size = sizeof(typename U::element_type);
+
+    // byte i is selected if 64 <= offset + i < 64 + n * size
+    U u = load_u(table + 64 - first * size);
+    if (n * size < V::length_bytes) {
+        U hi = load_u(table + 64 - (first + n) * size);
+        u = bit_andnot(u, hi);
+    }
+    typename U::mask_vector_type m;
+    m = cmp_neq(u, 0);
+    typename V::mask_vector_type r;
+    i_load_mask_cast(m, r);
+    return r;
+}
+
+template<class V> SIMDPP_INL
+void v_load_range(V& a, const char* p, unsigned first, unsigned n,
+                  std::true_type /*native*/)
+{
+    i_load_masked(a, p, i_load_range_mask<V>(first, n));
+}
+
+template<class V> SIMDPP_INL
+void v_load_range(V& a, const char* p, unsigned first, unsigned n,
+                  std::false_type /*native*/)
+{
+    using E = typename V::element_type;
+    const E* q = reinterpret_cast<const E*>(p);
+
+    mem_block<V> r((V) make_zero());
+    for (unsigned i = first; i < first + n; ++i) {
+        r[i] = q[i];
+    }
+    a = r;
+}
+
+// Loads the elements in range [first, first + n) of a native vector
+template<class V> SIMDPP_INL
+void i_load_range(V& a, const char* p, unsigned first, unsigned n)
+{
+    using native = std::integral_constant<bool, has_native_load_masked<V>::value>;
+    v_load_range(a, p, first, n, native());
+}
+
+template<class V> SIMDPP_INL
+void i_load_first(V& a, const char* p, unsigned n)
+{
+    using B = typename V::base_vector_type;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        unsigned bn = n < B::length ? n : B::length;
+        i_load_range(a.vec(i), p, 0, bn);
+        p += B::length_bytes;
+        n -= bn;
+    }
+}
+
+template<class V> SIMDPP_INL
+void i_load_last(V& a, const char* p, unsigned n)
+{
+    using B = typename V::base_vector_type;
+    p += V::length_bytes;
+    for (unsigned i = V::vec_length; i > 0; --i) {
+        unsigned bn = n < B::length ? n : B::length;
+        p -= B::length_bytes;
+        i_load_range(a.vec(i-1), p, B::length - bn, bn);
+        n -= bn;
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
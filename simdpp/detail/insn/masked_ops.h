@@ -0,0 +1,321 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_MASKED_OPS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_MASKED_OPS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_fmadd.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  On AVX-512 the masked operations map to single instructions that use a
+    k-register as the write mask. Everywhere else the result of the unmasked
+    operation is combined with the source using blend() (merge masking) or
+    bit_and() (zero masking).
+
+    The macros below define the native overloads. V is the vector type, M is
+    the corresponding mask type, P is the intrinsic prefix (e.g. _mm512) and
+    I is the intrinsic suffix (e.g. add_epi32).
+*/
+#define SIMDPP_DETAIL_MASKED_OP2(OP, V, M, P, I)                            \
+    static SIMDPP_INL                                                       \
+    V i_mask_##OP(const M& m, const V& src, const V& a, const V& b)         \
+    {                                                                       \
+        return P##_mask_##I(src.native(), m.native(), a.native(), b.native()); \
+    }                                                                       \
+    static SIMDPP_INL                                                       \
+    V i_maskz_##OP(const M& m, const V& a, const V& b)                      \
+    {                                                                       \
+        return P##_maskz_##I(m.native(), a.native(), b.native());           \
+    }
+
+#define SIMDPP_DETAIL_MASKED_SHIFT(OP, V, M, P, I)                          \
+    static SIMDPP_INL                                                       \
+    V i_mask_##OP(const M& m, const V& src, const V& a, unsigned count)     \
+    {                                                                       \
+        return P##_mask_##I(src.native(), m.native(), a.native(),           \
+                            _mm_cvtsi32_si128(count));                      \
+    }                                                                       \
+    static SIMDPP_INL                                                       \
+    V i_maskz_##OP(const M& m, const V& a, unsigned count)                  \
+    {                                                                       \
+        return P##_maskz_##I(m.native(), a.native(),                        \
+                             _mm_cvtsi32_si128(count));                     \
+    }
+
+// The merging form of the masked FMA instructions can only merge into one of
+// the operands, thus an additional masked move is needed for arbitrary src.
+#define SIMDPP_DETAIL_MASKED_FMADD(V, M, P, S)                              \
+    static SIMDPP_INL                                                       \
+    V i_mask_fmadd(const M& m, const V& src,                                \
+                   const V& a, const V& b, const V& c)                      \
+    {                                                                       \
+        return P##_mask_mov_##S(src.native(), m.native(),                   \
+                    P##_maskz_fmadd_##S(m.native(), a.native(),             \
+                                        b.native(), c.native()));           \
+    }                                                                       \
+    static SIMDPP_INL                                                       \
+    V i_maskz_fmadd(const M& m, const V& a, const V& b, const V& c)         \
+    {                                                                       \
+        return P##_maskz_fmadd_##S(m.native(), a.native(),                  \
+                                   b.native(), c.native());                 \
+    }
+
+// Defines the 32 and 64-bit element overloads for the given vector width
+#define SIMDPP_DETAIL_MASKED_OPS_F(P, N32, N64)                                     \
+    SIMDPP_DETAIL_MASKED_OP2(add, uint32<N32>, mask_int32<N32>, P, add_epi32)       \
+    SIMDPP_DETAIL_MASKED_OP2(add, uint64<N64>, mask_int64<N64>, P, add_epi64)       \
+    SIMDPP_DETAIL_MASKED_OP2(add, float32<N32>, mask_float32<N32>, P, add_ps)       \
+    SIMDPP_DETAIL_MASKED_OP2(add, float64<N64>, mask_float64<N64>, P, add_pd)       \
+    SIMDPP_DETAIL_MASKED_OP2(sub, uint32<N32>, mask_int32<N32>, P, sub_epi32)       \
+    SIMDPP_DETAIL_MASKED_OP2(sub, uint64<N64>, mask_int64<N64>, P, sub_epi64)       \
+    SIMDPP_DETAIL_MASKED_OP2(sub, float32<N32>, mask_float32<N32>, P, sub_ps)       \
+    SIMDPP_DETAIL_MASKED_OP2(sub, float64<N64>, mask_float64<N64>, P, sub_pd)       \
+    SIMDPP_DETAIL_MASKED_OP2(mul, float32<N32>, mask_float32<N32>, P, mul_ps)       \
+    SIMDPP_DETAIL_MASKED_OP2(mul, float64<N64>, mask_float64<N64>, P, mul_pd)       \
+    SIMDPP_DETAIL_MASKED_OP2(mul_lo, uint32<N32>, mask_int32<N32>, P, mullo_epi32)  \
+    SIMDPP_DETAIL_MASKED_OP2(min, int32<N32>, mask_int32<N32>, P, min_epi32)        \
+    SIMDPP_DETAIL_MASKED_OP2(min, uint32<N32>, mask_int32<N32>, P, min_epu32)       \
+    SIMDPP_DETAIL_MASKED_OP2(min, int64<N64>, mask_int64<N64>, P, min_epi64)        \
+    SIMDPP_DETAIL_MASKED_OP2(min, uint64<N64>, mask_int64<N64>, P, min_epu64)       \
+    SIMDPP_DETAIL_MASKED_OP2(min, float32<N32>, mask_float32<N32>, P, min_ps)       \
+    SIMDPP_DETAIL_MASKED_OP2(min, float64<N64>, mask_float64<N64>, P, min_pd)       \
+    SIMDPP_DETAIL_MASKED_OP2(max, int32<N32>, mask_int32<N32>, P, max_epi32)        \
+    SIMDPP_DETAIL_MASKED_OP2(max, uint32<N32>, mask_int32<N32>, P, max_epu32)       \
+    SIMDPP_DETAIL_MASKED_OP2(max, int64<N64>, mask_int64<N64>, P, max_epi64)        \
+    SIMDPP_DETAIL_MASKED_OP2(max, uint64<N64>, mask_int64<N64>, P, max_epu64)       \
+    SIMDPP_DETAIL_MASKED_OP2(max, float32<N32>, mask_float32<N32>, P, max_ps)       \
+    SIMDPP_DETAIL_MASKED_OP2(max, float64<N64>, mask_float64<N64>, P, max_pd)       \
+    SIMDPP_DETAIL_MASKED_FMADD(float32<N32>, mask_float32<N32>, P, ps)              \
+    SIMDPP_DETAIL_MASKED_FMADD(float64<N64>, mask_float64<N64>, P, pd)              \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_l, uint32<N32>, mask_int32<N32>, P, sll_epi32) \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_l, uint64<N64>, mask_int64<N64>, P, sll_epi64) \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_r, int32<N32>, mask_int32<N32>, P, sra_epi32)  \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_r, uint32<N32>, mask_int32<N32>, P, srl_epi32) \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_r, int64<N64>, mask_int64<N64>, P, sra_epi64)  \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_r, uint64<N64>, mask_int64<N64>, P, srl_epi64)
+
+// Defines the 8 and 16-bit element overloads for the given vector width
+#define SIMDPP_DETAIL_MASKED_OPS_BW(P, N8, N16)                                     \
+    SIMDPP_DETAIL_MASKED_OP2(add, uint8<N8>, mask_int8<N8>, P, add_epi8)            \
+    SIMDPP_DETAIL_MASKED_OP2(add, uint16<N16>, mask_int16<N16>, P, add_epi16)       \
+    SIMDPP_DETAIL_MASKED_OP2(sub, uint8<N8>, mask_int8<N8>, P, sub_epi8)            \
+    SIMDPP_DETAIL_MASKED_OP2(sub, uint16<N16>, mask_int16<N16>, P, sub_epi16)       \
+    SIMDPP_DETAIL_MASKED_OP2(mul_lo, uint16<N16>, mask_int16<N16>, P, mullo_epi16)  \
+    SIMDPP_DETAIL_MASKED_OP2(min, int8<N8>, mask_int8<N8>, P, min_epi8)             \
+    SIMDPP_DETAIL_MASKED_OP2(min, uint8<N8>, mask_int8<N8>, P, min_epu8)            \
+    SIMDPP_DETAIL_MASKED_OP2(min, int16<N16>, mask_int16<N16>, P, min_epi16)        \
+    SIMDPP_DETAIL_MASKED_OP2(min, uint16<N16>, mask_int16<N16>, P, min_epu16)       \
+    SIMDPP_DETAIL_MASKED_OP2(max, int8<N8>, mask_int8<N8>, P, max_epi8)             \
+    SIMDPP_DETAIL_MASKED_OP2(max, uint8<N8>, mask_int8<N8>, P, max_epu8)            \
+    SIMDPP_DETAIL_MASKED_OP2(max, int16<N16>, mask_int16<N16>, P, max_epi16)        \
+    SIMDPP_DETAIL_MASKED_OP2(max, uint16<N16>, mask_int16<N16>, P, max_epu16)       \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_l, uint16<N16>, mask_int16<N16>, P, sll_epi16) \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_r, int16<N16>, mask_int16<N16>, P, sra_epi16)  \
+    SIMDPP_DETAIL_MASKED_SHIFT(shift_r, uint16<N16>, mask_int16<N16>, P, srl_epi16)
+
+#if SIMDPP_USE_AVX512F
+SIMDPP_DETAIL_MASKED_OPS_F(_mm512, 16, 8)
+#endif
+#if SIMDPP_USE_AVX512VL
+SIMDPP_DETAIL_MASKED_OPS_F(_mm, 4, 2)
+SIMDPP_DETAIL_MASKED_OPS_F(_mm256, 8, 4)
+#endif
+#if SIMDPP_USE_AVX512BW
+SIMDPP_DETAIL_MASKED_OPS_BW(_mm512, 64, 32)
+#endif
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+SIMDPP_DETAIL_MASKED_OPS_BW(_mm, 16, 8)
+SIMDPP_DETAIL_MASKED_OPS_BW(_mm256, 32, 16)
+#endif
+
+#undef SIMDPP_DETAIL_MASKED_OPS_BW
+#undef SIMDPP_DETAIL_MASKED_OPS_F
+#undef SIMDPP_DETAIL_MASKED_FMADD
+#undef SIMDPP_DETAIL_MASKED_SHIFT
+#undef SIMDPP_DETAIL_MASKED_OP2
+
+// -----------------------------------------------------------------------------
+// Generic implementations for the vectors without native masking support
+
+#define SIMDPP_DETAIL_MASKED_OP2_EMUL(OP, EXPR)                             \
+    template<class V, class M> SIMDPP_INL                                   \
+    V i_mask_##OP(const M& m, const V& src, const V& a, const V& b)         \
+    {                                                                       \
+        V r = EXPR;                                                         \
+        r = blend(r, src, m);                                               \
+        return r;                                                           \
+    }                                                                       \
+    template<class V, class M> SIMDPP_INL                                   \
+    V i_maskz_##OP(const M& m, const V& a, const V& b)                      \
+    {                                                                       \
+        V r = EXPR;                                                         \
+        r = bit_and(r, m);                                                  \
+        return r;                                                           \
+    }
+
+SIMDPP_DETAIL_MASKED_OP2_EMUL(add, add(a, b))
+SIMDPP_DETAIL_MASKED_OP2_EMUL(sub, sub(a, b))
+SIMDPP_DETAIL_MASKED_OP2_EMUL(mul, mul(a, b))
+SIMDPP_DETAIL_MASKED_OP2_EMUL(mul_lo, mul_lo(a, b))
+SIMDPP_DETAIL_MASKED_OP2_EMUL(min, min(a, b))
+SIMDPP_DETAIL_MASKED_OP2_EMUL(max, max(a, b))
+
+#undef SIMDPP_DETAIL_MASKED_OP2_EMUL
+
+template<class V, class M> SIMDPP_INL
+V i_mask_fmadd(const M& m, const V& src, const V& a, const V& b, const V& c)
+{
+    V r = fmadd(a, b, c);
+    r = blend(r, src, m);
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+V i_maskz_fmadd(const M& m, const V& a, const V& b, const V& c)
+{
+    V r = fmadd(a, b, c);
+    r = bit_and(r, m);
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+V i_mask_shift_l(const M& m, const V& src, const V& a, unsigned count)
+{
+    V r = shift_l(a, count);
+    r = blend(r, src, m);
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+V i_maskz_shift_l(const M& m, const V& a, unsigned count)
+{
+    V r = shift_l(a, count);
+    r = bit_and(r, m);
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+V i_mask_shift_r(const M& m, const V& src, const V& a, unsigned count)
+{
+    V r = shift_r(a, count);
+    r = blend(r, src, m);
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+V i_maskz_shift_r(const M& m, const V& a, unsigned count)
+{
+    V r = shift_r(a, count);
+    r = bit_and(r, m);
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+// Entry points. Vectors that are wider than the native vector are processed
+// one native vector at a time so that the native overloads are used.
+
+#define SIMDPP_DETAIL_MASKED_OP2_ENTRY(OP)                                  \
+    template<class V, class M> SIMDPP_INL                                   \
+    V v_mask_##OP(const M& m, const V& src, const V& a, const V& b)         \
+    {                                                                       \
+        V r;                                                                \
+        for (unsigned i = 0; i < V::vec_length; ++i) {                      \
+            r.vec(i) = i_mask_##OP(m.vec(i), src.vec(i), a.vec(i), b.vec(i)); \
+        }                                                                   \
+        return r;                                                           \
+    }                                                                       \
+    template<class V, class M> SIMDPP_INL                                   \
+    V v_maskz_##OP(const M& m, const V& a, const V& b)                      \
+    {                                                                       \
+        V r;                                                                \
+        for (unsigned i = 0; i < V::vec_length; ++i) {                      \
+            r.vec(i) = i_maskz_##OP(m.vec(i), a.vec(i), b.vec(i));          \
+        }                                                                   \
+        return r;                                                           \
+    }
+
+#define SIMDPP_DETAIL_MASKED_SHIFT_ENTRY(OP)                                \
+    template<class V, class M> SIMDPP_INL                                   \
+    V v_mask_##OP(const M& m, const V& src, const V& a, unsigned count)     \
+    {                                                                       \
+        V r;                                                                \
+        for (unsigned i = 0; i < V::vec_length; ++i) {                      \
+            r.vec(i) = i_mask_##OP(m.vec(i), src.vec(i), a.vec(i), count);  \
+        }                                                                   \
+        return r;                                                           \
+    }                                                                       \
+    template<class V, class M> SIMDPP_INL                                   \
+    V v_maskz_##OP(const M& m, const V& a, unsigned count)                  \
+    {                                                                       \
+        V r;                                                                \
+        for (unsigned i = 0; i < V::vec_length; ++i) {                      \
+            r.vec(i) = i_maskz_##OP(m.vec(i), a.vec(i), count);             \
+        }                                                                   \
+        return r;                                                           \
+    }
+
+SIMDPP_DETAIL_MASKED_OP2_ENTRY(add)
+SIMDPP_DETAIL_MASKED_OP2_ENTRY(sub)
+SIMDPP_DETAIL_MASKED_OP2_ENTRY(mul)
+SIMDPP_DETAIL_MASKED_OP2_ENTRY(mul_lo)
+SIMDPP_DETAIL_MASKED_OP2_ENTRY(min)
+SIMDPP_DETAIL_MASKED_OP2_ENTRY(max)
+SIMDPP_DETAIL_MASKED_SHIFT_ENTRY(shift_l)
+SIMDPP_DETAIL_MASKED_SHIFT_ENTRY(shift_r)
+
+#undef SIMDPP_DETAIL_MASKED_SHIFT_ENTRY
+#undef SIMDPP_DETAIL_MASKED_OP2_ENTRY
+
+template<class V, class M> SIMDPP_INL
+V v_mask_fmadd(const M& m, const V& src, const V& a, const V& b, const V& c)
+{
+    V r;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        r.vec(i) = i_mask_fmadd(m.vec(i), src.vec(i), a.vec(i), b.vec(i), c.vec(i));
+    }
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+V v_maskz_fmadd(const M& m, const V& a, const V& b, const V& c)
+{
+    V r;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        r.vec(i) = i_maskz_fmadd(m.vec(i), a.vec(i), b.vec(i), c.vec(i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
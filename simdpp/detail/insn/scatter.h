@@ -0,0 +1,449 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Elements are written in order from the lowest to the highest, thus if
+// several indices are equal, the highest element wins. This matches the
+// AVX-512 scatter semantics.
+template<class V> SIMDPP_INL
+void i_scatter_emul(char* base, const uint32_t* idx, const V& a)
+{
+    using T = typename V::element_type;
+    T* pt = reinterpret_cast<T*>(base);
+    mem_block<V> v(a);
+    for (unsigned i = 0; i < V::length; ++i) {
+        pt[static_cast<int32_t>(idx[i])] = v[i];
+    }
+}
+
+template<class U, class V, class M> SIMDPP_INL
+void i_scatter_masked_emul(char* base, const uint32_t* idx, const V& a,
+                           const M& mask)
+{
+    using T = typename V::element_type;
+    T* pt = reinterpret_cast<T*>(base);
+    mem_block<V> v(a);
+    mem_block<U> m(bit_cast<U>(mask.unmask()));
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (m[i])
+            pt[static_cast<int32_t>(idx[i])] = v[i];
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<4>& idx, const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_i32scatter_epi32(base, idx.native(), a.native(), 4);
+#else
+    mem_block<uint32<4>> ix(idx);
+    i_scatter_emul(base, ix.data(), a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<8>& idx, const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i32scatter_epi32(base, idx.native(), a.native(), 4);
+#else
+    mem_block<uint32<8>> ix(idx);
+    i_scatter_emul(base, ix.data(), a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<16>& idx, const uint32<16>& a)
+{
+    _mm512_i32scatter_epi32(base, idx.native(), a.native(), 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<4>& idx, const float32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_i32scatter_ps(base, idx.native(), a.native(), 4);
+#else
+    mem_block<uint32<4>> ix(idx);
+    i_scatter_emul(base, ix.data(), a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<8>& idx, const float32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i32scatter_ps(base, idx.native(), a.native(), 4);
+#else
+    mem_block<uint32<8>> ix(idx);
+    i_scatter_emul(base, ix.data(), a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<16>& idx, const float32<16>& a)
+{
+    _mm512_i32scatter_ps(base, idx.native(), a.native(), 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint32_t* idx, const uint64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+    _mm_i32scatter_epi64(base, ix, a.native(), 8);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter(char* base, const uint32_t* idx, const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+    _mm256_i32scatter_epi64(base, ix, a.native(), 8);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint32_t* idx, const uint64<8>& a)
+{
+    __m256i ix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx));
+    _mm512_i32scatter_epi64(base, ix, a.native(), 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint32_t* idx, const float64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+    _mm_i32scatter_pd(base, ix, a.native(), 8);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_scatter(char* base, const uint32_t* idx, const float64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+    _mm256_i32scatter_pd(base, ix, a.native(), 8);
+#else
+    i_scatter_emul(base, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint32_t* idx, const float64<8>& a)
+{
+    __m256i ix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx));
+    _mm512_i32scatter_pd(base, ix, a.native(), 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<4>& idx, const uint32<4>& a,
+                      const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    mem_block<uint32<4>> ix(idx);
+    i_scatter_masked_emul<uint32<4>>(base, ix.data(), a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<8>& idx, const uint32<8>& a,
+                      const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    mem_block<uint32<8>> ix(idx);
+    i_scatter_masked_emul<uint32<8>>(base, ix.data(), a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<16>& idx, const uint32<16>& a,
+                      const mask_int32<16>& mask)
+{
+    _mm512_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<4>& idx, const float32<4>& a,
+                      const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_i32scatter_ps(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    mem_block<uint32<4>> ix(idx);
+    i_scatter_masked_emul<uint32<4>>(base, ix.data(), a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<8>& idx, const float32<8>& a,
+                      const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i32scatter_ps(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    mem_block<uint32<8>> ix(idx);
+    i_scatter_masked_emul<uint32<8>>(base, ix.data(), a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<16>& idx, const float32<16>& a,
+                      const mask_float32<16>& mask)
+{
+    _mm512_mask_i32scatter_ps(base, mask.native(), idx.native(), a.native(), 4);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32_t* idx, const uint64<2>& a,
+                      const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+    _mm_mask_i32scatter_epi64(base, mask.native(), ix, a.native(), 8);
+#else
+    i_scatter_masked_emul<uint64<2>>(base, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32_t* idx, const uint64<4>& a,
+                      const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+    _mm256_mask_i32scatter_epi64(base, mask.native(), ix, a.native(), 8);
+#else
+    i_scatter_masked_emul<uint64<4>>(base, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32_t* idx, const uint64<8>& a,
+                      const mask_int64<8>& mask)
+{
+    __m256i ix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx));
+    _mm512_mask_i32scatter_epi64(base, mask.native(), ix, a.native(), 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32_t* idx, const float64<2>& a,
+                      const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(idx));
+    _mm_mask_i32scatter_pd(base, mask.native(), ix, a.native(), 8);
+#else
+    i_scatter_masked_emul<uint64<2>>(base, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32_t* idx, const float64<4>& a,
+                      const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    __m128i ix = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx));
+    _mm256_mask_i32scatter_pd(base, mask.native(), ix, a.native(), 8);
+#else
+    i_scatter_masked_emul<uint64<4>>(base, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32_t* idx, const float64<8>& a,
+                      const mask_float64<8>& mask)
+{
+    __m256i ix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx));
+    _mm512_mask_i32scatter_pd(base, mask.native(), ix, a.native(), 8);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(char* base, const uint32<N>& idx, const uint32<N>& a)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter(base, idx.vec(i), a.vec(i));
+    }
+}
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(char* base, const uint32<N>& idx, const float32<N>& a)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    // float32 vectors are twice as wide as integer vectors
+    using Base = typename float32<N>::base_vector_type;
+    mem_block<uint32<N>> ix(idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter_emul(base, ix.data() + i * Base::length, a.vec(i));
+    }
+#else
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter(base, idx.vec(i), a.vec(i));
+    }
+#endif
+}
+
+template<class V, unsigned N> SIMDPP_INL
+void i_scatter64(char* base, const uint32<N>& idx, const V& a)
+{
+    using Base = typename V::base_vector_type;
+    mem_block<uint32<N>> ix(idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter(base, ix.data() + i * Base::length, a.vec(i));
+    }
+}
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(char* base, const uint32<N>& idx, const uint64<N>& a)
+{
+    i_scatter64(base, idx, a);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(char* base, const uint32<N>& idx, const float64<N>& a)
+{
+    i_scatter64(base, idx, a);
+}
+
+template<unsigned N, class M> SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<N>& idx, const uint32<N>& a,
+                      const M& mask)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter_masked(base, idx.vec(i), a.vec(i), mask.vec(i));
+    }
+}
+
+template<unsigned N, class M> SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<N>& idx, const float32<N>& a,
+                      const M& mask)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    // float32 vectors are twice as wide as integer vectors
+    using Base = typename float32<N>::base_vector_type;
+    mem_block<uint32<N>> ix(idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter_masked_emul<uint32<Base::length>>(base,
+                                                    ix.data() + i * Base::length,
+                                                    a.vec(i), mask.vec(i));
+    }
+#else
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter_masked(base, idx.vec(i), a.vec(i), mask.vec(i));
+    }
+#endif
+}
+
+template<class V, unsigned N, class M> SIMDPP_INL
+void i_scatter64_masked(char* base, const uint32<N>& idx, const V& a,
+                        const M& mask)
+{
+    using Base = typename V::base_vector_type;
+    mem_block<uint32<N>> ix(idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter_masked(base, ix.data() + i * Base::length, a.vec(i),
+                         mask.vec(i));
+    }
+}
+
+template<unsigned N, class M> SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<N>& idx, const uint64<N>& a,
+                      const M& mask)
+{
+    i_scatter64_masked(base, idx, a, mask);
+}
+
+template<unsigned N, class M> SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<N>& idx, const float64<N>& a,
+                      const M& mask)
+{
+    i_scatter64_masked(base, idx, a, mask);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
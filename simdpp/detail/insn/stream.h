@@ -205,6 +205,16 @@ void i_stream(char* p, const float64<8>& a)
 
 // -----------------------------------------------------------------------------
 
+static SIMDPP_INL
+void i_stream_fence()
+{
+#if SIMDPP_USE_SSE2
+    _mm_sfence();
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
 template<class V> SIMDPP_INL
 void i_stream(char* p, const V& ca)
 {
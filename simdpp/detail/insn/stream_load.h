@@ -0,0 +1,181 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_STREAM_LOAD_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_STREAM_LOAD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/align.h>
+#include <simdpp/detail/insn/load.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// MOVNTDQA is available since SSE4.1. Older compilers declare the argument as
+// a non-const pointer, thus the const qualifier is dropped.
+
+static SIMDPP_INL
+void i_stream_load(uint8x16& a, const char* p)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_SSE4_1
+    a = _mm_stream_load_si128(reinterpret_cast<__m128i*>(const_cast<char*>(p)));
+#else
+    i_load(a, p);
+#endif
+}
+
+static SIMDPP_INL
+void i_stream_load(uint16x8& a, const char* p) { uint8x16 r; i_stream_load(r, p); a = r; }
+static SIMDPP_INL
+void i_stream_load(uint32x4& a, const char* p) { uint8x16 r; i_stream_load(r, p); a = r; }
+
+static SIMDPP_INL
+void i_stream_load(uint64x2& a, const char* p)
+{
+#if SIMDPP_USE_SSE4_1
+    uint8x16 r; i_stream_load(r, p); a = r;
+#else
+    i_load(a, p);
+#endif
+}
+
+static SIMDPP_INL
+void i_stream_load(float32x4& a, const char* p)
+{
+#if SIMDPP_USE_SSE4_1
+    uint8x16 r; i_stream_load(r, p);
+    a = _mm_castsi128_ps(r.native());
+#else
+    i_load(a, p);
+#endif
+}
+
+static SIMDPP_INL
+void i_stream_load(float64x2& a, const char* p)
+{
+#if SIMDPP_USE_SSE4_1
+    uint8x16 r; i_stream_load(r, p);
+    a = _mm_castsi128_pd(r.native());
+#else
+    i_load(a, p);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_stream_load(uint8x32& a, const char* p)
+{
+    p = detail::assume_aligned(p, 32);
+    a = _mm256_stream_load_si256(reinterpret_cast<__m256i*>(const_cast<char*>(p)));
+}
+static SIMDPP_INL
+void i_stream_load(uint16x16& a, const char* p) { uint8x32 r; i_stream_load(r, p); a = r; }
+static SIMDPP_INL
+void i_stream_load(uint32x8& a, const char* p) { uint8x32 r; i_stream_load(r, p); a = r; }
+static SIMDPP_INL
+void i_stream_load(uint64x4& a, const char* p) { uint8x32 r; i_stream_load(r, p); a = r; }
+#endif
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_stream_load(float32x8& a, const char* p)
+{
+#if SIMDPP_USE_AVX2
+    uint8x32 r; i_stream_load(r, p);
+    a = _mm256_castsi256_ps(r.native());
+#else
+    i_load(a, p);
+#endif
+}
+
+static SIMDPP_INL
+void i_stream_load(float64x4& a, const char* p)
+{
+#if SIMDPP_USE_AVX2
+    uint8x32 r; i_stream_load(r, p);
+    a = _mm256_castsi256_pd(r.native());
+#else
+    i_load(a, p);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+__m512i i_stream_load_512(const char* p)
+{
+    p = detail::assume_aligned(p, 64);
+    return _mm512_stream_load_si512(reinterpret_cast<void*>(const_cast<char*>(p)));
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_stream_load(uint8<64>& a, const char* p)
+{
+    a = i_stream_load_512(p);
+}
+SIMDPP_INL void i_stream_load(uint16<32>& a, const char* p)
+{
+    a = i_stream_load_512(p);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_stream_load(uint32<16>& a, const char* p)
+{
+    a = i_stream_load_512(p);
+}
+static SIMDPP_INL
+void i_stream_load(uint64<8>& a, const char* p)
+{
+    a = i_stream_load_512(p);
+}
+static SIMDPP_INL
+void i_stream_load(float32<16>& a, const char* p)
+{
+    a = _mm512_castsi512_ps(i_stream_load_512(p));
+}
+static SIMDPP_INL
+void i_stream_load(float64<8>& a, const char* p)
+{
+    a = _mm512_castsi512_pd(i_stream_load_512(p));
+}
+#endif
+
+template<class V> SIMDPP_INL
+void i_stream_load(V& a, const char* p)
+{
+    const unsigned veclen = V::base_vector_type::length_bytes;
+
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_stream_load(a.vec(i), p);
+        p += veclen;
+    }
+}
+
+template<class V> SIMDPP_INL
+V i_stream_load_any(const char* p)
+{
+    typename detail::remove_sign<V>::type r;
+    i_stream_load(r, p);
+    return V(r);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -25,6 +25,9 @@
 #define SIMDPP_INSN_ID_AVX512BW _avx512bw
 #define SIMDPP_INSN_ID_AVX512DQ _avx512dq
 #define SIMDPP_INSN_ID_AVX512VL _avx512vl
+#define SIMDPP_INSN_ID_F16C _f16c
+#define SIMDPP_INSN_ID_AVX512VNNI _avx512vnni
+#define SIMDPP_INSN_ID_AVX512CD _avx512cd
 #define SIMDPP_INSN_ID_NEON _neon
 #define SIMDPP_INSN_ID_NEON_FLT_SP _neonfltsp
 #define SIMDPP_INSN_ID_ALTIVEC _altivec
@@ -55,6 +58,9 @@
 #define SIMDPP_INSN_MASK_VSX_206     0x00040000
 #define SIMDPP_INSN_MASK_VSX_207     0x00080000
 #define SIMDPP_INSN_MASK_MSA         0x00100000
+#define SIMDPP_INSN_MASK_F16C        0x00200000
+#define SIMDPP_INSN_MASK_AVX512VNNI  0x00400000
+#define SIMDPP_INSN_MASK_AVX512CD    0x00800000
 
 #define SIMDPP_PREFIX_SIMDPP_ARCH_X86_NULL        SIMDPP_INSN_MASK_NULL
 #define SIMDPP_PREFIX_SIMDPP_ARCH_X86_SSE2        SIMDPP_INSN_MASK_SSE2
@@ -71,6 +77,9 @@
 #define SIMDPP_PREFIX_SIMDPP_ARCH_X86_AVX512BW    SIMDPP_INSN_MASK_AVX512BW
 #define SIMDPP_PREFIX_SIMDPP_ARCH_X86_AVX512DQ    SIMDPP_INSN_MASK_AVX512DQ
 #define SIMDPP_PREFIX_SIMDPP_ARCH_X86_AVX512VL    SIMDPP_INSN_MASK_AVX512VL
+#define SIMDPP_PREFIX_SIMDPP_ARCH_X86_F16C        SIMDPP_INSN_MASK_F16C
+#define SIMDPP_PREFIX_SIMDPP_ARCH_X86_AVX512VNNI  SIMDPP_INSN_MASK_AVX512VNNI
+#define SIMDPP_PREFIX_SIMDPP_ARCH_X86_AVX512CD    SIMDPP_INSN_MASK_AVX512CD
 #define SIMDPP_PREFIX_SIMDPP_ARCH_ARM_NEON        SIMDPP_INSN_MASK_NEON
 #define SIMDPP_PREFIX_SIMDPP_ARCH_ARM_NEON_FLT_SP SIMDPP_INSN_MASK_NEON_FLT_SP
 #define SIMDPP_PREFIX_SIMDPP_ARCH_POWER_ALTIVEC   SIMDPP_INSN_MASK_ALTIVEC
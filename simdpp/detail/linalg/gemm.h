@@ -0,0 +1,282 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_LINALG_GEMM_H
+#define LIBSIMDPP_SIMDPP_DETAIL_LINALG_GEMM_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <simdpp/types.h>
+#include <simdpp/core/aligned_allocator.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_splat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/core/store.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace linalg {
+
+/*  The matrix multiplication follows the structure described by Goto and van
+    de Geijn. The columns of B are split into panels of nc columns and the
+    shared dimension into blocks of kc. Each kc x nc block of B is packed so
+    that the micro-kernel reads it sequentially, then the rows of A are
+    processed in blocks of mc rows that are packed in the same way. The
+    micro-kernel computes an mr x nr block of C, which is held in registers
+    as mr rows of two vectors, from a packed panel of A and of B.
+
+    mr is chosen so that the accumulators, two vectors of B and the broadcast
+    element of A fit into the register file: 32 registers on AVX-512 and 16
+    elsewhere.
+*/
+template<class T> struct gemm_traits;
+
+template<> struct gemm_traits<float> {
+    using vec = float32v;
+};
+template<> struct gemm_traits<double> {
+    using vec = float64v;
+};
+
+#if SIMDPP_USE_AVX512F
+static const unsigned gemm_mr = 14;
+#else
+static const unsigned gemm_mr = 6;
+#endif
+static const std::size_t gemm_kc = 256;
+static const std::size_t gemm_mc = gemm_mr * 16;
+static const std::size_t gemm_nc = 2048;
+
+template<class T>
+using gemm_buffer = std::vector<T, aligned_allocator<T, 64>>;
+
+/*  Packs the kc x nc block of B at b into panels of nr columns. Within a
+    panel, the nr elements of each row are stored consecutively. The columns
+    past nc are filled with zeros.
+*/
+template<class T> SIMDPP_INL
+void gemm_pack_b(const T* b, std::size_t ldb, std::size_t kc, std::size_t nc,
+                 T* dst)
+{
+    const std::size_t nr = 2 * gemm_traits<T>::vec::length;
+    for (std::size_t j = 0; j < nc; j += nr) {
+        std::size_t w = nc - j < nr ? nc - j : nr;
+        for (std::size_t p = 0; p < kc; ++p) {
+            std::memcpy(dst, b + p * ldb + j, w * sizeof(T));
+            for (std::size_t q = w; q < nr; ++q) {
+                dst[q] = 0;
+            }
+            dst += nr;
+        }
+    }
+}
+
+/*  Packs the mc x kc block of A at a into panels of mr rows. Within a panel,
+    the mr elements of each column are stored consecutively. The rows past
+    mc are filled with zeros.
+*/
+template<class T> SIMDPP_INL
+void gemm_pack_a(const T* a, std::size_t lda, std::size_t mc, std::size_t kc,
+                 T* dst)
+{
+    for (std::size_t i = 0; i < mc; i += gemm_mr) {
+        std::size_t h = mc - i < gemm_mr ? mc - i : gemm_mr;
+        for (std::size_t r = 0; r < gemm_mr; ++r) {
+            if (r < h) {
+                const T* src = a + (i + r) * lda;
+                for (std::size_t p = 0; p < kc; ++p) {
+                    dst[p * gemm_mr + r] = src[p];
+                }
+            } else {
+                for (std::size_t p = 0; p < kc; ++p) {
+                    dst[p * gemm_mr + r] = 0;
+                }
+            }
+        }
+        dst += gemm_mr * kc;
+    }
+}
+
+/*  The rows of the micro-kernel are unrolled using templates, thus the
+    accumulators are accessed only at constant indices and are kept in
+    registers regardless of the unrolling heuristics of the compiler.
+*/
+template<class V, unsigned I>
+struct gemm_rows {
+    using T = typename V::element_type;
+    using prev = gemm_rows<V, I-1>;
+
+    static SIMDPP_INL void zero(V* c0, V* c1)
+    {
+        prev::zero(c0, c1);
+        c0[I-1] = make_zero();
+        c1[I-1] = make_zero();
+    }
+
+    static SIMDPP_INL void madd(V* c0, V* c1, const T* a,
+                                const V& b0, const V& b1)
+    {
+        prev::madd(c0, c1, a, b0, b1);
+        V ai = load_splat(a + I-1);
+        c0[I-1] = math::mul_add(ai, b0, c0[I-1]);
+        c1[I-1] = math::mul_add(ai, b1, c1[I-1]);
+    }
+
+    // Stores alpha * acc + beta * C. If beta is zero, C is not read
+    static SIMDPP_INL void store_c(const V* c0, const V* c1, T* c,
+                                 std::size_t ldc, const V& va, const V& vb,
+                                 bool use_beta)
+    {
+        prev::store_c(c0, c1, c, ldc, va, vb, use_beta);
+        const unsigned L = V::length;
+        T* ci = c + (I-1) * ldc;
+        V r0 = mul(c0[I-1], va);
+        V r1 = mul(c1[I-1], va);
+        if (use_beta) {
+            V x0 = load_u(ci);
+            V x1 = load_u(ci + L);
+            r0 = math::mul_add(x0, vb, r0);
+            r1 = math::mul_add(x1, vb, r1);
+        }
+        store_u(ci, r0);
+        store_u(ci + L, r1);
+    }
+
+    // Stores alpha * acc to a buffer of rows of two vectors
+    static SIMDPP_INL void store_buf(const V* c0, const V* c1, T* buf,
+                                     const V& va)
+    {
+        prev::store_buf(c0, c1, buf, va);
+        const unsigned L = V::length;
+        store(buf + (I-1) * 2 * L, V(mul(c0[I-1], va)));
+        store(buf + (I-1) * 2 * L + L, V(mul(c1[I-1], va)));
+    }
+};
+
+template<class V>
+struct gemm_rows<V, 0> {
+    using T = typename V::element_type;
+    static SIMDPP_INL void zero(V*, V*) {}
+    static SIMDPP_INL void madd(V*, V*, const T*, const V&, const V&) {}
+    static SIMDPP_INL void store_c(const V*, const V*, T*, std::size_t,
+                                 const V&, const V&, bool) {}
+    static SIMDPP_INL void store_buf(const V*, const V*, T*, const V&) {}
+};
+
+/*  Computes C = alpha * A * B + beta * C for an mr x nr block of C at c from
+    the packed panels at a and b. Only the first m rows and n columns are
+    stored. If beta is zero, C is not read.
+*/
+template<class T> SIMDPP_INL
+void gemm_kernel(std::size_t kc, const T* a, const T* b, T* c, std::size_t ldc,
+                 T alpha, T beta, std::size_t m, std::size_t n)
+{
+    using V = typename gemm_traits<T>::vec;
+    using rows = gemm_rows<V, gemm_mr>;
+    const unsigned L = V::length;
+
+    V acc0[gemm_mr], acc1[gemm_mr];
+    rows::zero(acc0, acc1);
+    for (std::size_t p = 0; p < kc; ++p) {
+        V b0 = load(b);
+        V b1 = load(b + L);
+        rows::madd(acc0, acc1, a, b0, b1);
+        a += gemm_mr;
+        b += 2 * L;
+    }
+
+    V va = splat(alpha);
+    if (m == gemm_mr && n == 2 * L) {
+        rows::store_c(acc0, acc1, c, ldc, va, splat(beta), beta != 0);
+        return;
+    }
+
+    // partial blocks at the edges of C are stored through a buffer
+    SIMDPP_ALIGN(64) T buf[gemm_mr * 2 * V::length];
+    rows::store_buf(acc0, acc1, buf, va);
+    for (std::size_t i = 0; i < m; ++i) {
+        T* ci = c + i * ldc;
+        for (std::size_t j = 0; j < n; ++j) {
+            T r = buf[i * 2 * L + j];
+            ci[j] = beta != 0 ? r + beta * ci[j] : r;
+        }
+    }
+}
+
+// Computes C = beta * C
+template<class T> SIMDPP_INL
+void gemm_scale(std::size_t m, std::size_t n, T beta, T* c, std::size_t ldc)
+{
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            c[i * ldc + j] = beta != 0 ? beta * c[i * ldc + j] : 0;
+        }
+    }
+}
+
+template<class T> SIMDPP_INL
+void gemm(std::size_t m, std::size_t n, std::size_t k, T alpha,
+          const T* a, std::size_t lda, const T* b, std::size_t ldb,
+          T beta, T* c, std::size_t ldc)
+{
+    if (m == 0 || n == 0)
+        return;
+    if (k == 0 || alpha == 0) {
+        gemm_scale(m, n, beta, c, ldc);
+        return;
+    }
+
+    const std::size_t nr = 2 * gemm_traits<T>::vec::length;
+    std::size_t kc_max = k < gemm_kc ? k : gemm_kc;
+    std::size_t mc_max = m < gemm_mc ? m : gemm_mc;
+    std::size_t nc_max = n < gemm_nc ? n : gemm_nc;
+    gemm_buffer<T> pa(kc_max * ((mc_max + gemm_mr - 1) / gemm_mr * gemm_mr));
+    gemm_buffer<T> pb(kc_max * ((nc_max + nr - 1) / nr * nr));
+
+    for (std::size_t jc = 0; jc < n; jc += gemm_nc) {
+        std::size_t nc = n - jc < gemm_nc ? n - jc : gemm_nc;
+        for (std::size_t pc = 0; pc < k; pc += gemm_kc) {
+            std::size_t kc = k - pc < gemm_kc ? k - pc : gemm_kc;
+            // beta is applied by the first block of the shared dimension
+            T beta_pc = pc == 0 ? beta : T(1);
+            gemm_pack_b(b + pc * ldb + jc, ldb, kc, nc, pb.data());
+
+            for (std::size_t ic = 0; ic < m; ic += gemm_mc) {
+                std::size_t mc = m - ic < gemm_mc ? m - ic : gemm_mc;
+                gemm_pack_a(a + ic * lda + pc, lda, mc, kc, pa.data());
+
+                for (std::size_t jr = 0; jr < nc; jr += nr) {
+                    std::size_t nw = nc - jr < nr ? nc - jr : nr;
+                    for (std::size_t ir = 0; ir < mc; ir += gemm_mr) {
+                        std::size_t mw = mc - ir < gemm_mr ? mc - ir : gemm_mr;
+                        gemm_kernel(kc, pa.data() + ir * kc, pb.data() + jr * kc,
+                                    c + (ic + ir) * ldc + jc + jr, ldc,
+                                    alpha, beta_pc, mw, nw);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace linalg
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
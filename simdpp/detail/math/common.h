@@ -0,0 +1,132 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_COMMON_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_COMMON_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_fmadd.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/make_float.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  The functions in this module are built exclusively from the generic vector
+    operations, thus they are available on all architectures. Fused
+    multiply-add is used whenever the architecture supports it natively,
+    which slightly improves the precision of the results.
+*/
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+#define SIMDPP_DETAIL_MATH_USE_FMADD 1
+#else
+#define SIMDPP_DETAIL_MATH_USE_FMADD 0
+#endif
+
+// Computes a*b+c
+template<unsigned N> SIMDPP_INL
+float32<N> mul_add(const float32<N>& a, const float32<N>& b, const float32<N>& c)
+{
+#if SIMDPP_DETAIL_MATH_USE_FMADD
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> mul_add(const float64<N>& a, const float64<N>& b, const float64<N>& c)
+{
+#if SIMDPP_DETAIL_MATH_USE_FMADD
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+// Evaluates c0 + c1*x + c2*x^2 + ... using Horner's scheme
+template<class V> SIMDPP_INL
+V horner(const V&, double c0)
+{
+    V r = make_float(c0);
+    return r;
+}
+
+template<class V, class... Cs> SIMDPP_INL
+V horner(const V& x, double c0, Cs... cs)
+{
+    V c = make_float(c0);
+    return mul_add(horner(x, cs...), x, c);
+}
+
+/*  Rounds to the nearest integer by adding and subtracting a constant that
+    shifts out the fractional bits. The integer part of @a a must fit into
+    22 bits for float32 and 51 bits for float64.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> round_shift(const float32<N>& a)
+{
+    return sub(add(a, 12582912.0f), 12582912.0f); // 0x1.8p23
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> round_shift(const float64<N>& a)
+{
+    return sub(add(a, 6755399441055744.0), 6755399441055744.0); // 0x1.8p52
+}
+
+/*  Computes 2^k for integer-valued @a k. The exponent field is constructed
+    directly, thus @a k must be within the range of normal numbers.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> pow2i(const float32<N>& k)
+{
+    // 0x1.8p23 + 127 puts k + 127 into the lowest bits of the mantissa
+    uint32<N> e = bit_cast<uint32<N>>(add(k, 12583039.0f));
+    e = shift_l<23>(e);
+    return bit_cast<float32<N>>(e);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> pow2i(const float64<N>& k)
+{
+    // 0x1.8p52 + 1023 puts k + 1023 into the lowest bits of the mantissa
+    uint64<N> e = bit_cast<uint64<N>>(add(k, 6755399441056767.0));
+    e = shift_l<52>(e);
+    return bit_cast<float64<N>>(e);
+}
+
+/*  Computes a * 2^k for integer-valued @a k. The scaling is split into two
+    steps so that @a k may span both the range of normal and subnormal
+    results: [-252, 254] for float32 and [-2044, 2046] for float64.
+*/
+template<class V> SIMDPP_INL
+V ldexp_k(const V& a, const V& k)
+{
+    V k1 = round_shift(V(mul(k, 0.5)));
+    V k2 = sub(k, k1);
+    return mul(mul(a, pow2i(k1)), pow2i(k2));
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,148 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_ERF_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_ERF_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_ge.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_sign.h>
+#include <simdpp/detail/math/exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  Two approximations are used:
+
+     * |x| <= x0: erf(x) = x * P(x^2)
+
+     * x0 < |x| < x1: erf(x) = 1 - exp(-x^2) * Q(u), where u = (1/x - tc) / hw
+       maps 1/x from [1/x1, 1/x0] to [-1, 1].
+
+    Above x1 erf(x) rounds to 1.
+*/
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> erf_poly_small(const float32<N>& z)
+{
+    if (Fast) {
+        return horner(z, 1.128378749e+00, -3.760991693e-01, 1.125656739e-01,
+                      -2.589916624e-02, 3.775192425e-03);
+    }
+    return horner(z, 1.128379107e+00, -3.761252761e-01, 1.128219441e-01,
+                  -2.678071894e-02, 5.014484283e-03, -6.102686748e-04);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> erf_poly_large(const float32<N>& u)
+{
+    if (Fast) {
+        return horner(u, 3.275929391e-01, 1.552351266e-01, -3.011157550e-02,
+                      3.791002790e-03, 3.885547339e-04, -5.789785646e-04,
+                      2.153011155e-04);
+    }
+    return horner(u, 3.275929391e-01, 1.552406251e-01, -3.011183999e-02,
+                  3.747413168e-03, 3.903684556e-04, -4.923828528e-04,
+                  2.120442514e-04, -4.925599569e-05, 1.718459771e-06);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> erf_poly_small(const float64<N>& z)
+{
+    if (Fast) {
+        return horner(z, 1.12837916709550967e+00, -3.76126389031397612e-01,
+                      1.12837916698576762e-01, -2.68661705373542392e-02,
+                      5.22397707433385448e-03, -8.54831020891472703e-04,
+                      1.20550025695788572e-04, -1.49212791358863717e-05,
+                      1.64222532012289185e-06, -1.61134543256281759e-07,
+                      1.37066075275429444e-08, -9.07011106103801818e-10,
+                      3.40020377590253361e-11);
+    }
+    return horner(z, 1.12837916709551256e+00, -3.76126389031836761e-01,
+                  1.12837916709526240e-01, -2.68661706448026713e-02,
+                  5.22397762317934784e-03, -8.54832692947069114e-04,
+                  1.20553304298997590e-04, -1.49256027415508471e-05,
+                  1.64614847224541453e-06, -1.63598415947247272e-07,
+                  1.47656668570557449e-08, -1.20830485170227230e-09,
+                  8.68587011439133394e-11, -4.91011798468050857e-12,
+                  1.58895460078188378e-13);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> erf_poly_large(const float64<N>& u)
+{
+    if (Fast) {
+        return horner(u, 2.18949490913020267e-01, 1.14059703313909994e-01,
+                      -1.16584501890020578e-02, -7.82718232313555040e-05,
+                      4.11607640608303523e-04, -1.13250149792187526e-04,
+                      1.34917566288453964e-05, 2.55580581065371108e-06,
+                      -1.97352807755956725e-06, 6.11680086630697427e-07,
+                      -9.73836786388817641e-08, -1.26024260091986532e-08,
+                      1.60773859931381394e-08, -5.98100994261117836e-09,
+                      9.24081518687694426e-10);
+    }
+    return horner(u, 2.18949490913020267e-01, 1.14059703313737243e-01,
+                  -1.16584501888105860e-02, -7.82718168699446756e-05,
+                  4.11607633480753617e-04, -1.13250216189964180e-04,
+                  1.34918330243187771e-05, 2.55610244998590978e-06,
+                  -1.97388686740142349e-06, 6.11035907094327574e-07,
+                  -9.65274227380756022e-08, -1.19479110899602743e-08,
+                  1.50050144273556030e-08, -6.15627328640960793e-09,
+                  1.57182805933881012e-09, -1.66061139433132071e-10,
+                  -1.17980988866276856e-10, 9.45761700797699093e-11,
+                  -2.43336870157393509e-11);
+}
+
+template<bool Fast, class V> SIMDPP_INL
+V i_erf_impl(const V& x, double x0, double x1, double tc, double hw)
+{
+    V a = abs(x);
+
+    V ra = mul(a, erf_poly_small<Fast>(V(mul(a, a))));
+
+    V ac = min(max(a, x0), x1);
+    V u = mul(V(sub(div(1.0, ac), tc)), 1.0 / hw);
+    V e = i_exp<Fast>(V(neg(V(mul(ac, ac)))));
+    V rb = sub(1.0, V(mul(e, erf_poly_large<Fast>(u))));
+
+    V res = blend(rb, ra, cmp_gt(a, x0));
+    res = blend(V(make_float(1.0)), res, cmp_ge(a, x1));
+    // NaN fails both comparisons and propagates through ra
+    return bit_or(res, sign(x));
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> i_erf(const float32<N>& x)
+{
+    return i_erf_impl<Fast>(x, 0.9, 3.92, 0.6831065759637188, 0.4280045351473923);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> i_erf(const float64<N>& x)
+{
+    return i_erf_impl<Fast>(x, 1.5, 5.93, 0.4176503653738055, 0.24901630129286115);
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
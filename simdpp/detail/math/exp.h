@@ -0,0 +1,130 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_EXP_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_EXP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  The argument is reduced as x = k*ln2 + r, |r| <= ln2/2 and exp(r) is
+    approximated as 1 + r + r^2 * P(r). The coefficients of P have been
+    computed by interpolating at Chebyshev nodes. The same approximation is
+    used by expm1.
+*/
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> exp_poly(const float32<N>& r)
+{
+    if (Fast) {
+        return horner(r, 4.999974966e-01, 1.666663140e-01, 4.183380306e-02,
+                      8.357199840e-03);
+    }
+    return horner(r, 5.000000000e-01, 1.666666716e-01, 4.166646674e-02,
+                  8.333310485e-03, 1.393364160e-03, 1.989098091e-04);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> exp_poly(const float64<N>& r)
+{
+    if (Fast) {
+        return horner(r, 5.00000000000000000e-01, 1.66666666666483027e-01,
+                      4.16666666666513641e-02, 8.33333335371715632e-03,
+                      1.38888889058713465e-03, 1.98412087569923207e-04,
+                      2.48015364090640872e-05, 2.76251020053881075e-06,
+                      2.76137955545198609e-07);
+    }
+    return horner(r, 5.00000000000000000e-01, 1.66666666666666713e-01,
+                  4.16666666666666713e-02, 8.33333333332614105e-03,
+                  1.38888888888837525e-03, 1.98412698748004929e-04,
+                  2.48015873255333634e-05, 2.75572554257464351e-06,
+                  2.75572736613486373e-07, 2.51052063739570109e-08,
+                  2.09146793765839349e-09);
+}
+
+// Computes k = round(x/ln2) and r = x - k*ln2
+template<unsigned N> SIMDPP_INL
+void exp_reduce(const float32<N>& x, float32<N>& k, float32<N>& r)
+{
+    k = round_shift(float32<N>(mul(x, 1.4426950216293335f)));
+    r = mul_add(k, float32<N>(make_float(-0.693115234375)), x);
+    r = mul_add(k, float32<N>(make_float(-3.194618329871446e-05)), r);
+}
+
+template<unsigned N> SIMDPP_INL
+void exp_reduce(const float64<N>& x, float64<N>& k, float64<N>& r)
+{
+    k = round_shift(float64<N>(mul(x, 1.4426950408889634)));
+    r = mul_add(k, float64<N>(make_float(-0.6931471806019545)), x);
+    r = mul_add(k, float64<N>(make_float(4.2009150726810846e-11)), r);
+}
+
+template<bool Fast, class V> SIMDPP_INL
+V i_exp_impl(const V& x, double lo, double hi)
+{
+    V xc = min(max(x, lo), hi);
+    V k, r;
+    exp_reduce(xc, k, r);
+
+    V r2 = mul(r, r);
+    V p = mul_add(r2, exp_poly<Fast>(r), r);
+    p = add(p, 1.0);
+    p = ldexp_k(p, k);
+    // min and max don't propagate NaNs on all architectures
+    return blend(x, p, isnan(x));
+}
+
+/*  Outside [lo, hi] the results overflow to infinity or underflow to zero,
+    thus clamping to the range does not change the results, but keeps the
+    exponent within the range supported by ldexp_k.
+*/
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> i_exp(const float32<N>& x)
+{
+    return i_exp_impl<Fast>(x, -104.0, 89.0);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> i_exp(const float64<N>& x)
+{
+    return i_exp_impl<Fast>(x, -746.0, 710.0);
+}
+
+/*  Computes exp(x)-1 without the loss of precision for small x. Only
+    arguments within [0, 40] are supported, which is sufficient for tanh.
+*/
+template<bool Fast, class V> SIMDPP_INL
+V i_expm1_small(const V& x)
+{
+    V k, r;
+    exp_reduce(x, k, r);
+
+    V r2 = mul(r, r);
+    V p = mul_add(r2, exp_poly<Fast>(r), r);
+    // 2^k * (p + 1) - 1
+    V s = pow2i(k);
+    return mul_add(s, p, V(sub(s, 1.0)));
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
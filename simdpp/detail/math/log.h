@@ -0,0 +1,152 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_LOG_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_LOG_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  The argument is decomposed as x = 2^e * m, sqrt(2)/2 < m <= sqrt(2) and
+    log(m) = log(1+f) is computed as 2*atanh(s), s = f/(2+f) using the
+    approach of fdlibm:
+
+        log(1+f) = f - (hfsq - s*(hfsq+R)),  hfsq = f^2/2,  R = z*T(z),  z = s^2
+*/
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> log_poly(const float32<N>& z)
+{
+    if (Fast) {
+        return horner(z, 6.666349769e-01, 4.085826874e-01);
+    }
+    return horner(z, 6.666666865e-01, 4.000012279e-01, 2.855082154e-01,
+                  2.333046794e-01);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> log_poly(const float64<N>& z)
+{
+    if (Fast) {
+        return horner(z, 6.66666666666620666e-01, 4.00000000112120335e-01,
+                      2.85714241376043843e-01, 2.22228623223879318e-01,
+                      1.81401926769655358e-01, 1.66218281116454480e-01);
+    }
+    return horner(z, 6.66666666666666630e-01, 4.00000000000008793e-01,
+                  2.85714285708036142e-01, 2.22222223917139167e-01,
+                  1.81817956401329056e-01, 1.53862397028146580e-01,
+                  1.32687731386568863e-01, 1.30866261478401025e-01);
+}
+
+// Splits a positive finite x into exponent e and mantissa m within [1, 2)
+template<unsigned N> SIMDPP_INL
+void log_split(const float32<N>& x, float32<N>& e, float32<N>& m)
+{
+    // subnormal numbers are scaled by 2^23 first
+    mask_float32<N> is_sub = cmp_lt(x, 1.17549435e-38f);
+    float32<N> xs = blend(float32<N>(mul(x, 8388608.0f)), x, is_sub);
+    float32<N> eadj = bit_and(float32<N>(make_float(-23.0)), is_sub);
+
+    uint32<N> bits = bit_cast<uint32<N>>(xs);
+    uint32<N> c_exp = make_uint(0x4b000000);
+    uint32<N> c_mant = make_uint(0x007fffff);
+    uint32<N> c_one = make_uint(0x3f800000);
+
+    // 0x1.0p23 + 127 is subtracted from 0x1.0p23 + biased exponent
+    e = bit_cast<float32<N>>(bit_or(shift_r<23>(bits), c_exp));
+    e = add(sub(e, 8388735.0f), eadj);
+    m = bit_cast<float32<N>>(bit_or(bit_and(bits, c_mant), c_one));
+}
+
+template<unsigned N> SIMDPP_INL
+void log_split(const float64<N>& x, float64<N>& e, float64<N>& m)
+{
+    // subnormal numbers are scaled by 2^52 first
+    mask_float64<N> is_sub = cmp_lt(x, 2.2250738585072014e-308);
+    float64<N> xs = blend(float64<N>(mul(x, 4503599627370496.0)), x, is_sub);
+    float64<N> eadj = bit_and(float64<N>(make_float(-52.0)), is_sub);
+
+    uint64<N> bits = bit_cast<uint64<N>>(xs);
+    uint64<N> c_exp = make_uint(0x4330000000000000);
+    uint64<N> c_mant = make_uint(0x000fffffffffffff);
+    uint64<N> c_one = make_uint(0x3ff0000000000000);
+
+    // 0x1.0p52 + 1023 is subtracted from 0x1.0p52 + biased exponent
+    e = bit_cast<float64<N>>(bit_or(shift_r<52>(bits), c_exp));
+    e = add(sub(e, 4503599627371519.0), eadj);
+    m = bit_cast<float64<N>>(bit_or(bit_and(bits, c_mant), c_one));
+}
+
+template<bool Fast, class V> SIMDPP_INL
+V i_log_impl(const V& x, double sqrt2, double ln2_hi, double ln2_lo)
+{
+    using T = typename V::element_type;
+    using M = typename V::mask_vector_type;
+
+    V e, m;
+    log_split(x, e, m);
+
+    M is_big = cmp_gt(m, sqrt2);
+    m = blend(V(mul(m, 0.5)), m, is_big);
+    e = add(e, V(bit_and(V(make_float(1.0)), is_big)));
+
+    V f = sub(m, 1.0);
+    V s = div(f, V(add(f, 2.0)));
+    V z = mul(s, s);
+    V r = mul(z, log_poly<Fast>(z));
+    V hfsq = mul(V(mul(f, f)), 0.5);
+
+    // e*ln2_hi - ((hfsq - (s*(hfsq+R) + e*ln2_lo)) - f)
+    V t = mul_add(s, V(add(hfsq, r)), V(mul(e, ln2_lo)));
+    t = sub(sub(hfsq, t), f);
+    V res = sub(V(mul(e, ln2_hi)), t);
+
+    V inf = make_float(std::numeric_limits<T>::infinity());
+    V nan = make_float(std::numeric_limits<T>::quiet_NaN());
+    V ninf = make_float(-std::numeric_limits<T>::infinity());
+    res = blend(nan, res, cmp_lt(x, 0.0));
+    res = blend(ninf, res, cmp_eq(x, 0.0));
+    res = blend(x, res, bit_or(cmp_eq(x, inf), isnan(x)));
+    return res;
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> i_log(const float32<N>& x)
+{
+    return i_log_impl<Fast>(x, 1.41421354f, 6.9313812256e-01, 9.0580006145e-06);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> i_log(const float64<N>& x)
+{
+    return i_log_impl<Fast>(x, 1.4142135623730951, 6.93147180369123816490e-01,
+                            1.90821492927058770002e-10);
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,165 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_SIN_COS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_SIN_COS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_sign.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  The argument is reduced as |x| = q*pi/2 + r, |r| <= pi/4 using Cody-Waite
+    reduction with pi/2 split into three parts. Depending on the quadrant q,
+    either sin(r) = r + r^3 * P(r^2) or cos(r) = 1 - r^2/2 + r^4 * Q(r^2) is
+    evaluated. Only the lowest two bits of q are needed, they are extracted
+    from the mantissa of the rounded value directly.
+
+    The reduction loses precision once q*pi/2 can no longer be represented
+    exactly by the split constants: this happens around |x| ~ 6000 for float32
+    and |x| ~ 1.6e6 for float64.
+*/
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> sin_poly(const float32<N>& z)
+{
+    if (Fast) {
+        return horner(z, -1.666666418e-01, 8.332747966e-03, -1.958789071e-04);
+    }
+    return horner(z, -1.666666716e-01, 8.333331905e-03, -1.984008704e-04,
+                  2.724992555e-06);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> sin_poly(const float64<N>& z)
+{
+    if (Fast) {
+        return horner(z, -1.66666666666638846e-01, 8.33333333107922312e-03,
+                      -1.98412669169859658e-04, 2.75559909295653188e-06,
+                      -2.48056362418347625e-08);
+    }
+    return horner(z, -1.66666666666666657e-01, 8.33333333333333148e-03,
+                  -1.98412698412650653e-04, 2.75573192193391672e-06,
+                  -2.50521062324475780e-08, 1.60585316189861469e-10,
+                  -7.58669711770691831e-13);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> cos_poly(const float32<N>& z)
+{
+    if (Fast) {
+        return horner(z, 4.166666418e-02, -1.388830249e-03, 2.454794230e-05);
+    }
+    return horner(z, 4.166666791e-02, -1.388888806e-03, 2.480059993e-05,
+                  -2.730095900e-07);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> cos_poly(const float64<N>& z)
+{
+    if (Fast) {
+        return horner(z, 4.16666666666646798e-02, -1.38888888872773422e-03,
+                      2.48015852109905154e-05, -2.75563696955730066e-07,
+                      2.07006004834331171e-09);
+    }
+    return horner(z, 4.16666666666666644e-02, -1.38888888888888873e-03,
+                  2.48015873015846453e-05, -2.75573192214028242e-07,
+                  2.08767557910804218e-09, -1.14704608876099586e-11,
+                  4.74587190204329150e-14);
+}
+
+/*  Computes the reduced argument r and the quadrant q of |x|. The quadrant is
+    left in the lowest bits of the integer vector.
+*/
+template<unsigned N> SIMDPP_INL
+void sin_cos_reduce(const float32<N>& a, float32<N>& r, uint32<N>& q)
+{
+    float32<N> t = add(mul(a, 0.6366197466850281f), 12582912.0f); // 0x1.8p23
+    q = bit_cast<uint32<N>>(t);
+    float32<N> k = sub(t, 12582912.0f);
+    r = mul_add(k, float32<N>(make_float(-1.57080078125)), a);
+    r = mul_add(k, float32<N>(make_float(4.453584551811218e-06)), r);
+    r = mul_add(k, float32<N>(make_float(8.705515752716053e-10)), r);
+}
+
+template<unsigned N> SIMDPP_INL
+void sin_cos_reduce(const float64<N>& a, float64<N>& r, uint64<N>& q)
+{
+    float64<N> t = add(mul(a, 0.6366197723675814), 6755399441055744.0); // 0x1.8p52
+    q = bit_cast<uint64<N>>(t);
+    float64<N> k = sub(t, 6755399441055744.0);
+    r = mul_add(k, float64<N>(make_float(-1.5707963267341256)), a);
+    r = mul_add(k, float64<N>(make_float(-6.077100506303966e-11)), r);
+    r = mul_add(k, float64<N>(make_float(-2.0222662487959506e-21)), r);
+}
+
+/*  Evaluates sin(q*pi/2 + r). The sign of the result is additionally flipped
+    if the sign bit is set in @a sign.
+*/
+template<bool Fast, class V, class U> SIMDPP_INL
+V sin_cos_eval(const V& r, const U& q, const U& sign)
+{
+    using M = typename V::mask_vector_type;
+    const unsigned shift = sizeof(typename V::element_type) * 8 - 2;
+
+    V z = mul(r, r);
+    V ps = mul_add(V(mul(r, z)), sin_poly<Fast>(z), r);
+    V pc = mul_add(V(mul(z, z)), cos_poly<Fast>(z),
+                   V(sub(1.0, V(mul(z, 0.5)))));
+
+    M use_cos = bit_cast<M>(cmp_eq(U(bit_and(q, 1)), 1));
+    V res = blend(pc, ps, use_cos);
+
+    // quadrants 2 and 3 are negative
+    U neg = shift_l<shift>(U(bit_and(q, 2)));
+    neg = bit_xor(neg, sign);
+    return bit_cast<V>(bit_xor(bit_cast<U>(res), neg));
+}
+
+template<bool Fast, class V> SIMDPP_INL
+V i_sin(const V& x)
+{
+    using U = typename V::uint_vector_type;
+    V r; U q;
+    sin_cos_reduce(V(abs(x)), r, q);
+    // sin(-x) = -sin(x)
+    U s = bit_cast<U>(sign(x));
+    return sin_cos_eval<Fast>(r, q, s);
+}
+
+template<bool Fast, class V> SIMDPP_INL
+V i_cos(const V& x)
+{
+    using U = typename V::uint_vector_type;
+    V r; U q;
+    sin_cos_reduce(V(abs(x)), r, q);
+    // cos(x) = sin(x + pi/2)
+    q = add(q, 1);
+    U s = make_zero();
+    return sin_cos_eval<Fast>(r, q, s);
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
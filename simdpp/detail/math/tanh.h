@@ -0,0 +1,61 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_TANH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_TANH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_sign.h>
+#include <simdpp/detail/math/exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  tanh(|x|) = e / (e + 2), e = expm1(2|x|). The argument is capped at the
+    point where tanh rounds to 1, which also keeps expm1 within its supported
+    range.
+*/
+template<bool Fast, class V> SIMDPP_INL
+V i_tanh_impl(const V& x, double cap)
+{
+    V a = min(V(abs(x)), cap);
+    V e = i_expm1_small<Fast>(V(add(a, a)));
+    V t = div(e, V(add(e, 2.0)));
+    t = bit_or(t, sign(x));
+    return blend(x, t, isnan(x));
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float32<N> i_tanh(const float32<N>& x)
+{
+    return i_tanh_impl<Fast>(x, 9.1);
+}
+
+template<bool Fast, unsigned N> SIMDPP_INL
+float64<N> i_tanh(const float64<N>& x)
+{
+    return i_tanh_impl<Fast>(x, 19.1);
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -79,6 +79,9 @@
 #ifdef SIMDPP_ARCH_PP_USE_AVX2
 #undef SIMDPP_ARCH_PP_USE_AVX2
 #endif
+#ifdef SIMDPP_ARCH_PP_USE_F16C
+#undef SIMDPP_ARCH_PP_USE_F16C
+#endif
 #ifdef SIMDPP_ARCH_PP_USE_AVX512F
 #undef SIMDPP_ARCH_PP_USE_AVX512F
 #endif
@@ -91,6 +94,12 @@
 #ifdef SIMDPP_ARCH_PP_USE_AVX512VL
 #undef SIMDPP_ARCH_PP_USE_AVX512VL
 #endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VNNI
+#undef SIMDPP_ARCH_PP_USE_AVX512VNNI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512CD
+#undef SIMDPP_ARCH_PP_USE_AVX512CD
+#endif
 #ifdef SIMDPP_ARCH_PP_USE_FMA3
 #undef SIMDPP_ARCH_PP_USE_FMA3
 #endif
@@ -143,6 +152,9 @@
 #ifdef SIMDPP_ARCH_PP_NS_USE_AVX2
 #undef SIMDPP_ARCH_PP_NS_USE_AVX2
 #endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_F16C
+#undef SIMDPP_ARCH_PP_NS_USE_F16C
+#endif
 #ifdef SIMDPP_ARCH_PP_NS_USE_AVX512F
 #undef SIMDPP_ARCH_PP_NS_USE_AVX512F
 #endif
@@ -155,6 +167,12 @@
 #ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VL
 #undef SIMDPP_ARCH_PP_NS_USE_AVX512VL
 #endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#endif
 #ifdef SIMDPP_ARCH_PP_NS_USE_FMA3
 #undef SIMDPP_ARCH_PP_NS_USE_FMA3
 #endif
@@ -225,6 +243,9 @@
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX2) == SIMDPP_INSN_MASK_AVX2
         #define SIMDPP_ARCH_PP_USE_AVX2 1
     #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_F16C) == SIMDPP_INSN_MASK_F16C
+        #define SIMDPP_ARCH_PP_USE_F16C 1
+    #endif
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_FMA3) == SIMDPP_INSN_MASK_FMA3
         #define SIMDPP_ARCH_PP_USE_FMA3 1
     #endif
@@ -246,6 +267,12 @@
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VL) == SIMDPP_INSN_MASK_AVX512VL
         #define SIMDPP_ARCH_PP_USE_AVX512VL 1
     #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VNNI) == SIMDPP_INSN_MASK_AVX512VNNI
+        #define SIMDPP_ARCH_PP_USE_AVX512VNNI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512CD) == SIMDPP_INSN_MASK_AVX512CD
+        #define SIMDPP_ARCH_PP_USE_AVX512CD 1
+    #endif
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_NEON) == SIMDPP_INSN_MASK_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
     #endif
@@ -297,6 +324,10 @@
         #define SIMDPP_ARCH_PP_USE_AVX2 1
         #undef SIMDPP_ARCH_X86_AVX2
     #endif
+    #ifdef SIMDPP_ARCH_X86_F16C
+        #define SIMDPP_ARCH_PP_USE_F16C 1
+        #undef SIMDPP_ARCH_X86_F16C
+    #endif
     #ifdef SIMDPP_ARCH_X86_FMA3
         #define SIMDPP_ARCH_PP_USE_FMA3 1
         #undef SIMDPP_ARCH_X86_FMA3
@@ -325,6 +356,14 @@
         #define SIMDPP_ARCH_PP_USE_AVX512VL 1
         #undef SIMDPP_ARCH_X86_AVX512VL
     #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VNNI
+        #define SIMDPP_ARCH_PP_USE_AVX512VNNI 1
+        #undef SIMDPP_ARCH_X86_AVX512VNNI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512CD
+        #define SIMDPP_ARCH_PP_USE_AVX512CD 1
+        #undef SIMDPP_ARCH_X86_AVX512CD
+    #endif
     #ifdef SIMDPP_ARCH_ARM_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
         #undef SIMDPP_ARCH_ARM_NEON
@@ -353,6 +392,18 @@
 
 // Define support of instruction sets that are implicitly available when another
 // instruction set is available
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_AVX512VL
     #ifndef SIMDPP_ARCH_PP_USE_AVX512F
         #define SIMDPP_ARCH_PP_USE_AVX512F 1
@@ -383,6 +434,12 @@
     #endif
 #endif
 
+#if SIMDPP_ARCH_PP_USE_F16C
+    #ifndef SIMDPP_ARCH_PP_USE_AVX
+        #define SIMDPP_ARCH_PP_USE_AVX 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_AVX
     #ifndef SIMDPP_ARCH_PP_USE_SSE4_1
         #define SIMDPP_ARCH_PP_USE_SSE4_1 1
@@ -486,7 +543,10 @@
 #if SIMDPP_ARCH_PP_USE_AVX2 && !SIMDPP_ARCH_PP_USE_AVX512F
 #define SIMDPP_ARCH_PP_NS_USE_AVX2 1
 #endif
-#if SIMDPP_ARCH_PP_USE_AVX512F && !SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512DQ && !SIMDPP_ARCH_PP_USE_AVX512VL
+#if SIMDPP_ARCH_PP_USE_F16C
+#define SIMDPP_ARCH_PP_NS_USE_F16C 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512F && !SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512DQ && !SIMDPP_ARCH_PP_USE_AVX512VL && !SIMDPP_ARCH_PP_USE_AVX512VNNI && !SIMDPP_ARCH_PP_USE_AVX512CD
 #define SIMDPP_ARCH_PP_NS_USE_AVX512F 1
 #endif
 #if SIMDPP_ARCH_PP_USE_AVX512BW
@@ -498,6 +558,12 @@
 #if SIMDPP_ARCH_PP_USE_AVX512VL
 #define SIMDPP_ARCH_PP_NS_USE_AVX512VL 1
 #endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VNNI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+#define SIMDPP_ARCH_PP_NS_USE_AVX512CD 1
+#endif
 #if SIMDPP_ARCH_PP_USE_FMA3
 #define SIMDPP_ARCH_PP_NS_USE_FMA3 1
 #endif
@@ -0,0 +1,201 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_STRING_COMMON_H
+#define LIBSIMDPP_SIMDPP_DETAIL_STRING_COMMON_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/test_bits.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace string {
+
+/*  The byte strings are processed in blocks of 64 bytes. Each block is
+    compared as a whole and the results are collected into a 64-bit integer
+    whose bit i corresponds to the byte i of the block.
+
+    Where the length of the string is not known in advance, the blocks are
+    loaded from addresses aligned to the block size. Such a block never
+    crosses a page boundary, thus the bytes outside the string that are read
+    are always accessible. The bits that correspond to these bytes are
+    cleared before the result is examined.
+*/
+static const std::size_t block_size = 64;
+
+using block_vec = uint8<64>;
+using block_mask = mask_int8<64>;
+
+// Returns the bits of each byte of the mask as a 64-bit integer
+SIMDPP_INL uint64_t block_bits(const block_mask& m)
+{
+#if SIMDPP_USE_AVX512BW
+    return m.native();
+#else
+    using B = typename block_vec::base_vector_type;
+    block_vec u = m.unmask();
+    uint64_t r = 0;
+    for (unsigned i = 0; i < u.vec_length; ++i) {
+        r |= uint64_t(extract_bits_any(u.vec(i))) << (i * B::length);
+    }
+    return r;
+#endif
+}
+
+// Returns true if any byte of the mask is set
+SIMDPP_INL bool block_any(const block_mask& m)
+{
+#if SIMDPP_USE_AVX512BW
+    return m.native() != 0;
+#else
+    return test_bits_any(m.unmask());
+#endif
+}
+
+// Returns the low nibble of each byte
+SIMDPP_INL block_vec low_nibbles(const block_vec& v)
+{
+    return bit_and(v, 0x0f);
+}
+
+// Returns the high nibble of each byte. There are no 8-bit shifts, thus the
+// bits shifted in from the adjacent byte are cleared afterwards
+SIMDPP_INL block_vec high_nibbles(const block_vec& v)
+{
+    return (block_vec) bit_and(shift_r<4>(uint16<block_size/2>(v)), 0x0f0f);
+}
+
+// Returns a mask with the lowest n bits set. n must be at most 64
+SIMDPP_INL uint64_t low_bits(std::size_t n)
+{
+    return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+}
+
+// Returns the index of the lowest set bit. x must not be zero
+SIMDPP_INL unsigned bit_scan_forward(uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    unsigned r = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        r++;
+    }
+    return r;
+#endif
+}
+
+// Returns the index of the highest set bit. x must not be zero
+SIMDPP_INL unsigned bit_scan_reverse(uint64_t x)
+{
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(x);
+#else
+    unsigned r = 0;
+    while (x >>= 1)
+        r++;
+    return r;
+#endif
+}
+
+// Returns the start of the block that contains p
+SIMDPP_INL const uint8_t* block_start(const uint8_t* p)
+{
+    std::uintptr_t a = reinterpret_cast<std::uintptr_t>(p);
+    return p - a % block_size;
+}
+
+/*  Returns a pointer to the first byte within [p, p+n) for which the
+    corresponding element of the mask returned by @a pred is set, or
+    @c nullptr if there's no such byte. @a pred is invoked with aligned
+    blocks.
+*/
+template<class P> SIMDPP_INL
+const uint8_t* find_first(const uint8_t* p, std::size_t n, P pred)
+{
+    if (n == 0)
+        return nullptr;
+
+    const uint8_t* b = block_start(p);
+    const uint8_t* end = p + n;
+
+    block_vec v = load(b);
+    uint64_t m = block_bits(pred(v)) >> (p - b);
+    if (n <= block_size - (p - b))
+        m &= low_bits(n);
+    if (m != 0)
+        return p + bit_scan_forward(m);
+    b += block_size;
+
+    for (; b + block_size <= end; b += block_size) {
+        v = load(b);
+        block_mask e = pred(v);
+        if (block_any(e))
+            return b + bit_scan_forward(block_bits(e));
+    }
+    if (b < end) {
+        v = load(b);
+        m = block_bits(pred(v)) & low_bits(end - b);
+        if (m != 0)
+            return b + bit_scan_forward(m);
+    }
+    return nullptr;
+}
+
+// Same as find_first(), except that the last such byte is returned
+template<class P> SIMDPP_INL
+const uint8_t* find_last(const uint8_t* p, std::size_t n, P pred)
+{
+    if (n == 0)
+        return nullptr;
+
+    const uint8_t* b = block_start(p + n - 1);
+
+    block_vec v = load(b);
+    uint64_t m = block_bits(pred(v)) & low_bits(p + n - b);
+    if (b <= p) {
+        m &= ~low_bits(p - b);
+        return m != 0 ? b + bit_scan_reverse(m) : nullptr;
+    }
+    if (m != 0)
+        return b + bit_scan_reverse(m);
+
+    while (std::size_t(b - p) >= block_size) {
+        b -= block_size;
+        v = load(b);
+        block_mask e = pred(v);
+        if (block_any(e))
+            return b + bit_scan_reverse(block_bits(e));
+    }
+    if (b > p) {
+        b -= block_size;
+        v = load(b);
+        m = block_bits(pred(v)) & ~low_bits(p - b);
+        if (m != 0)
+            return b + bit_scan_reverse(m);
+    }
+    return nullptr;
+}
+
+} // namespace string
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
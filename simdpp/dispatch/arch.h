@@ -54,6 +54,12 @@ enum class Arch : std::uint32_t {
     X86_AVX512DQ = 1 << 13,
     /// Indicates x86 AVX-512VL suppotr
     X86_AVX512VL = 1 << 14,
+    /// Indicates x86 F16C (half-precision conversion) support
+    X86_F16C = 1 << 15,
+    /// Indicates x86 AVX-512 VNNI (vector neural network instructions) support
+    X86_AVX512VNNI = 1 << 16,
+    /// Indicates x86 AVX-512 CD (conflict detection) support
+    X86_AVX512CD = 1 << 17,
 
     /// Indicates ARM NEON support (SP and DP floating-point math is executed
     /// on VFP)
@@ -72,6 +72,11 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_1_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_1_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -107,6 +112,16 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_1_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -138,7 +153,7 @@
     #define SIMDPP_DISPATCH_1_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_1_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE3,                                         \
@@ -147,10 +162,13 @@
         SIMDPP_DISPATCH_1_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_1_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_1_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_1_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_1_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_1_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_1_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_1_NS_ID_XOP,                                          \
@@ -230,6 +248,11 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_2_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_2_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -265,6 +288,16 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_2_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -296,7 +329,7 @@
     #define SIMDPP_DISPATCH_2_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_2_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE3,                                         \
@@ -305,10 +338,13 @@
         SIMDPP_DISPATCH_2_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_2_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_2_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_2_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_2_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_2_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_2_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_2_NS_ID_XOP,                                          \
@@ -388,6 +424,11 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_3_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_3_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -423,6 +464,16 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_3_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -454,7 +505,7 @@
     #define SIMDPP_DISPATCH_3_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_3_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE3,                                         \
@@ -463,10 +514,13 @@
         SIMDPP_DISPATCH_3_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_3_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_3_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_3_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_3_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_3_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_3_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_3_NS_ID_XOP,                                          \
@@ -546,6 +600,11 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_4_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_4_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -581,6 +640,16 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_4_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -612,7 +681,7 @@
     #define SIMDPP_DISPATCH_4_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_4_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE3,                                         \
@@ -621,10 +690,13 @@
         SIMDPP_DISPATCH_4_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_4_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_4_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_4_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_4_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_4_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_4_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_4_NS_ID_XOP,                                          \
@@ -704,6 +776,11 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_5_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_5_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -739,6 +816,16 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_5_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -770,7 +857,7 @@
     #define SIMDPP_DISPATCH_5_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_5_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE3,                                         \
@@ -779,10 +866,13 @@
         SIMDPP_DISPATCH_5_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_5_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_5_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_5_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_5_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_5_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_5_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_5_NS_ID_XOP,                                          \
@@ -862,6 +952,11 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_6_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_6_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -897,6 +992,16 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_6_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -928,7 +1033,7 @@
     #define SIMDPP_DISPATCH_6_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_6_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE3,                                         \
@@ -937,10 +1042,13 @@
         SIMDPP_DISPATCH_6_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_6_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_6_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_6_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_6_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_6_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_6_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_6_NS_ID_XOP,                                          \
@@ -1020,6 +1128,11 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_7_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_7_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1055,6 +1168,16 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_7_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1086,7 +1209,7 @@
     #define SIMDPP_DISPATCH_7_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_7_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE3,                                         \
@@ -1095,10 +1218,13 @@
         SIMDPP_DISPATCH_7_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_7_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_7_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_7_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_7_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_7_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_7_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_7_NS_ID_XOP,                                          \
@@ -1178,6 +1304,11 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_8_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_8_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1213,6 +1344,16 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_8_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1244,7 +1385,7 @@
     #define SIMDPP_DISPATCH_8_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_8_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE3,                                         \
@@ -1253,10 +1394,13 @@
         SIMDPP_DISPATCH_8_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_8_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_8_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_8_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_8_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_8_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_8_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_8_NS_ID_XOP,                                          \
@@ -1336,6 +1480,11 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_9_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_9_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1371,6 +1520,16 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_9_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1402,7 +1561,7 @@
     #define SIMDPP_DISPATCH_9_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE25(arch,               \
         SIMDPP_DISPATCH_9_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE3,                                         \
@@ -1411,10 +1570,13 @@
         SIMDPP_DISPATCH_9_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_9_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_9_NS_ID_AVX2,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_9_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_9_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_9_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_9_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_9_NS_ID_XOP,                                          \
@@ -1494,6 +1656,11 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_10_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_10_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1529,6 +1696,16 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_10_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1560,7 +1737,7 @@
     #define SIMDPP_DISPATCH_10_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE25(arch,              \
         SIMDPP_DISPATCH_10_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE3,                                        \
@@ -1569,10 +1746,13 @@
         SIMDPP_DISPATCH_10_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_10_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_10_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_10_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_10_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_10_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_10_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_10_NS_ID_XOP,                                         \
@@ -1652,6 +1832,11 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_11_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_11_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1687,6 +1872,16 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_11_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1718,7 +1913,7 @@
     #define SIMDPP_DISPATCH_11_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE25(arch,              \
         SIMDPP_DISPATCH_11_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE3,                                        \
@@ -1727,10 +1922,13 @@
         SIMDPP_DISPATCH_11_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_11_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_11_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_11_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_11_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_11_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_11_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_11_NS_ID_XOP,                                         \
@@ -1810,6 +2008,11 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_12_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_12_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -1845,6 +2048,16 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_12_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1876,7 +2089,7 @@
     #define SIMDPP_DISPATCH_12_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE25(arch,              \
         SIMDPP_DISPATCH_12_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE3,                                        \
@@ -1885,10 +2098,13 @@
         SIMDPP_DISPATCH_12_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_12_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_12_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_12_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_12_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_12_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_12_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_12_NS_ID_XOP,                                         \
@@ -1968,6 +2184,11 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_13_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_13_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -2003,6 +2224,16 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_13_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2034,7 +2265,7 @@
     #define SIMDPP_DISPATCH_13_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE25(arch,              \
         SIMDPP_DISPATCH_13_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE3,                                        \
@@ -2043,10 +2274,13 @@
         SIMDPP_DISPATCH_13_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_13_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_13_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_13_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_13_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_13_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_13_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_13_NS_ID_XOP,                                         \
@@ -2126,6 +2360,11 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_14_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_14_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -2161,6 +2400,16 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_14_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2192,7 +2441,7 @@
     #define SIMDPP_DISPATCH_14_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE25(arch,              \
         SIMDPP_DISPATCH_14_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE3,                                        \
@@ -2201,10 +2450,13 @@
         SIMDPP_DISPATCH_14_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_14_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_14_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_14_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_14_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_14_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_14_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_14_NS_ID_XOP,                                         \
@@ -2284,6 +2536,11 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_AVX2
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_15_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_F16C
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_FMA3
     #define SIMDPP_DISPATCH_15_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
     #else
@@ -2319,6 +2576,16 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_15_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2350,7 +2617,7 @@
     #define SIMDPP_DISPATCH_15_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE25(arch,              \
         SIMDPP_DISPATCH_15_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE3,                                        \
@@ -2359,10 +2626,13 @@
         SIMDPP_DISPATCH_15_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_15_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_15_NS_ID_AVX2,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_15_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_15_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_15_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_15_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_15_NS_ID_XOP,                                         \
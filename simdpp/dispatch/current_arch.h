@@ -0,0 +1,145 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_CURRENT_ARCH_H
+#define LIBSIMDPP_DISPATCH_CURRENT_ARCH_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <simdpp/dispatch/arch.h>
+#include <simdpp/dispatch/get_arch_gcc_builtin_cpu_supports.h>
+#include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#include <simdpp/dispatch/get_arch_string_list.h>
+
+/** @def SIMDPP_CURRENT_ARCH_DETECTOR
+    An expression of type @c Arch that is used by @c current_arch() to detect
+    the instruction sets supported by the CPU. Any of the
+    @c get_arch_* functions, or a user-supplied function may be used.
+
+    If not defined by the user, the first available backend out of
+    @c get_arch_raw_cpuid(), @c get_arch_gcc_builtin_cpu_supports() and
+    @c get_arch_linux_cpuinfo() is used. If none is available,
+    @c Arch::NONE_NULL is assumed.
+
+    The macro must be defined identically in all translation units that
+    include this file.
+*/
+#ifndef SIMDPP_CURRENT_ARCH_DETECTOR
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+#define SIMDPP_CURRENT_ARCH_DETECTOR ::simdpp::get_arch_raw_cpuid()
+#elif SIMDPP_HAS_GET_ARCH_GCC_BUILTIN_CPU_SUPPORTS
+#define SIMDPP_CURRENT_ARCH_DETECTOR ::simdpp::get_arch_gcc_builtin_cpu_supports()
+#elif SIMDPP_HAS_GET_ARCH_LINUX_CPUINFO
+#define SIMDPP_CURRENT_ARCH_DETECTOR ::simdpp::get_arch_linux_cpuinfo()
+#else
+#define SIMDPP_CURRENT_ARCH_DETECTOR ::simdpp::Arch::NONE_NULL
+#endif
+#endif
+
+namespace simdpp {
+namespace detail {
+
+/*  Parses the value of the SIMDPP_ARCH_MASK environment variable. The value
+    is either a number (decimal, or hexadecimal with 0x prefix) that is
+    interpreted as an Arch bitmask, or a list of architecture names separated
+    by commas, as accepted by get_arch_string_list(). An empty or null string
+    leaves @a detected unchanged.
+
+    The mask can only remove instruction sets from @a detected, as selecting
+    an unsupported instruction set would crash the program.
+*/
+inline Arch parse_arch_mask(const char* str, Arch detected)
+{
+    if (str == nullptr || *str == '\0')
+        return detected;
+
+    Arch mask;
+    if (*str >= '0' && *str <= '9') {
+        char* end;
+        unsigned long value = std::strtoul(str, &end, 0);
+        if (*end != '\0')
+            return detected;
+        mask = static_cast<Arch>(static_cast<std::uint32_t>(value));
+    } else {
+        std::vector<std::string> names;
+        const char* begin = str;
+        while (true) {
+            const char* end = std::strchr(begin, ',');
+            if (end == nullptr) {
+                names.emplace_back(begin);
+                break;
+            }
+            names.emplace_back(begin, end);
+            begin = end + 1;
+        }
+        std::vector<const char*> ptrs;
+        for (auto& name : names) {
+            ptrs.push_back(name.c_str());
+        }
+        mask = get_arch_string_list(ptrs.data(), static_cast<int>(ptrs.size()),
+                                    "");
+    }
+    return detected & mask;
+}
+
+inline Arch detect_current_arch()
+{
+    Arch arch = SIMDPP_CURRENT_ARCH_DETECTOR;
+    return parse_arch_mask(std::getenv("SIMDPP_ARCH_MASK"), arch);
+}
+
+} // namespace detail
+
+/** Returns the instruction sets supported by the current CPU. The detection is
+    performed once per process (or per shared library) using the backend
+    selected by @c SIMDPP_CURRENT_ARCH_DETECTOR and the result is cached.
+
+    The result may be restricted by setting the @c SIMDPP_ARCH_MASK environment
+    variable, e.g. @c SIMDPP_ARCH_MASK=sse2,sse3 or @c SIMDPP_ARCH_MASK=0x6.
+    Instruction sets not listed in the mask are removed from the result. This
+    is useful for testing and for running a program with the same code paths
+    on different hardware.
+
+    The function is thread-safe and does not depend on static initialization,
+    thus it is suitable for use as @c SIMDPP_USER_ARCH_INFO of dispatchers that
+    are resolved on the first call:
+
+    @code
+    #define SIMDPP_USER_ARCH_INFO ::simdpp::current_arch()
+    @endcode
+
+    The function must not be used with @c SIMDPP_DISPATCH_USE_IFUNC. The
+    resolvers of indirect functions run while the program is being loaded,
+    whereas the function calls @c getenv() and, depending on the detection
+    backend, may read files. Use @c get_arch_gcc_builtin_cpu_supports() or
+    @c get_arch_raw_cpuid() directly in that case.
+*/
+inline Arch current_arch()
+{
+    // The highest bit is never used by Arch and marks that the value has been
+    // computed. Concurrent first calls compute the same value.
+    const std::uint32_t computed_bit = 1u << 31;
+    static std::atomic<std::uint32_t> cached(0);
+
+    std::uint32_t value = cached.load(std::memory_order_relaxed);
+    if ((value & computed_bit) == 0) {
+        value = static_cast<std::uint32_t>(
+                ::simdpp::detail::detect_current_arch());
+        value |= computed_bit;
+        cached.store(value, std::memory_order_relaxed);
+    }
+    return static_cast<Arch>(value & ~computed_bit);
+}
+
+} // namespace simdpp
+
+#endif
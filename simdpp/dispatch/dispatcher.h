@@ -13,6 +13,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <simdpp/dispatch/arch.h>
 
@@ -31,20 +32,28 @@ namespace simdpp {
     @c SIMDPP_MAKE_DISPATCHER_* expansion.
 
     The function identified by the @c SIMDPP_USER_ARCH_INFO is called at the
-    first time the specific dispatcher is invoked. The user must ensure that
-    proper synchronization is used if the dispatcher is called concurrently.
+    first time the specific dispatcher is invoked or when @c dispatch_init()
+    is called. It may be called concurrently from several threads, thus it
+    must be thread-safe. If @c SIMDPP_DISPATCH_USE_IFUNC is defined, the
+    function may be called by the dynamic loader before static initialization
+    has been performed.
 
     The user must ensure that the returned information is sensible: e.g. SSE2
     must be supported if SSE3 support is indicated.
 
     The @c simdpp/dispatch/get_arch_*.h files provide several ready
-    implementations of CPU features detection.
+    implementations of CPU features detection. @c simdpp::current_arch() from
+    @c simdpp/dispatch/current_arch.h caches the result of one of them for the
+    whole process. It is not suitable for dispatchers resolved via ifunc.
 */
 
 namespace detail {
 
 using VoidFunPtr = void (*)();
 
+template<class F>
+using FunPtrOf = F*;
+
 struct FnVersion {
     /*  Identifies the instruction support that is needed for this version to
         run.
@@ -67,32 +76,121 @@ struct FnVersion {
     const char* arch_name;
 };
 
-inline FnVersion select_version_any(FnVersion* versions, unsigned size,
+inline FnVersion select_version_any(const FnVersion* versions, unsigned size,
                                     Arch arch)
 {
-    // No need to try to be very efficient here.
-    std::sort(versions, versions + size,
-              [](const FnVersion& lhs, const FnVersion& rhs) {
-                  return lhs.needed_arch > rhs.needed_arch;
-              });
-
-    unsigned i;
-    for (i = 0; i < size; ++i) {
+    // The version requiring the most capable architecture wins. A linear
+    // scan is sufficient, sorting the array is not needed.
+    const FnVersion* best = nullptr;
+    for (unsigned i = 0; i < size; ++i) {
         if (versions[i].fun_ptr == nullptr)
             continue;
-        if (test_arch_subset(arch, versions[i].needed_arch)) {
-            break;
-        }
+        if (!test_arch_subset(arch, versions[i].needed_arch))
+            continue;
+        if (best == nullptr || versions[i].needed_arch > best->needed_arch)
+            best = versions + i;
     }
-    if (i == size) {
+    if (best == nullptr) {
         // The user didn't provide the NONE_NULL version and no SIMD
         // architecture is supported. We can't do anything except to abort
         std::abort();
     }
-    return versions[i];
+    return *best;
 }
 
+/*  Each dispatcher registers itself during static initialization so that
+    all of them can be resolved eagerly by dispatch_init(). The registrations
+    form an intrusive singly linked list that is only ever prepended to.
+*/
+struct DispatcherRegistration {
+    using ResolveFn = VoidFunPtr (*)();
+
+    DispatcherRegistration(ResolveFn resolve_fn) : resolve(resolve_fn)
+    {
+        std::atomic<DispatcherRegistration*>& head = head_ref();
+        next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(next, this,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {}
+    }
+
+    static std::atomic<DispatcherRegistration*>& head_ref()
+    {
+        // constant-initialized, thus safe to use during static initialization
+        static std::atomic<DispatcherRegistration*> head(nullptr);
+        return head;
+    }
+
+    ResolveFn resolve;
+    DispatcherRegistration* next;
+};
+
+/*  Holds the selected version of a single dispatched function. @a Resolver
+    must define a static member function select() that returns the selected
+    function pointer.
+
+    The selected pointer is stored atomically, thus concurrent first calls
+    are race-free: each of them computes the same result and stores it.
+    After the first call the overhead is a single load and a null check.
+*/
+template<class Resolver>
+struct DispatcherState {
+    static std::atomic<VoidFunPtr> selected;
+    static DispatcherRegistration registration;
+
+    static VoidFunPtr resolve()
+    {
+        VoidFunPtr ptr = Resolver::select();
+        selected.store(ptr, std::memory_order_release);
+        return ptr;
+    }
+
+    static VoidFunPtr get()
+    {
+        // odr-use the registration so that it's instantiated
+        (void) &registration;
+        VoidFunPtr ptr = selected.load(std::memory_order_acquire);
+        if (ptr == nullptr) {
+            ptr = resolve();
+        }
+        return ptr;
+    }
+};
+
+template<class Resolver>
+std::atomic<VoidFunPtr> DispatcherState<Resolver>::selected(nullptr);
+
+template<class Resolver>
+DispatcherRegistration DispatcherState<Resolver>::registration(
+        &DispatcherState<Resolver>::resolve);
+
 } // namespace detail
+
+/** Selects the function versions of all dispatchers defined by
+    @c SIMDPP_MAKE_DISPATCHER in the current module, so that the first call
+    to a dispatched function does not pay the cost of the selection.
+
+    The function is optional: dispatchers still select the version lazily on
+    first call if it's not used. Calling the function again repeats the
+    selection, which is useful if the value returned by
+    @c SIMDPP_USER_ARCH_INFO changes. The function is thread-safe, but the
+    calls to dispatched functions that happen concurrently may use either the
+    old or the new selection.
+
+    Dispatchers resolved via GNU indirect functions (see
+    @c SIMDPP_DISPATCH_USE_IFUNC) are resolved by the dynamic loader and are
+    not affected.
+*/
+inline void dispatch_init()
+{
+    using detail::DispatcherRegistration;
+    DispatcherRegistration* reg =
+            DispatcherRegistration::head_ref().load(std::memory_order_acquire);
+    for (; reg != nullptr; reg = reg->next) {
+        reg->resolve();
+    }
+}
+
 } // namespace simdpp
 
 #endif
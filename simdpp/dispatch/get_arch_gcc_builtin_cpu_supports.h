@@ -17,9 +17,17 @@ namespace simdpp {
 
 /** Retrieves supported architecture using GCC __builtin_cpu_supports function.
     Works only on x86.
+
+    The function may be used as @c SIMDPP_USER_ARCH_INFO of dispatchers
+    resolved via ifunc, since it does not depend on the static initialization
+    of the program.
 */
 inline Arch get_arch_gcc_builtin_cpu_supports()
 {
+    // the resolvers of ifunc functions may run before the constructor that
+    // initializes the CPU model data
+    __builtin_cpu_init();
+
     Arch arch_info = Arch::NONE_NULL;
 #if (__GNUC__ > 4)
     if (__builtin_cpu_supports("avx512f")) { // since 5.0
@@ -63,6 +71,18 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
     }
     if (__builtin_cpu_supports("popcnt"))
         arch_info |= Arch::X86_POPCNT_INSN;
+#if (__GNUC__ >= 6)
+    if (__builtin_cpu_supports("avx512cd")) // since 6.0
+        arch_info |= Arch::X86_AVX512CD;
+#endif
+#if (__GNUC__ >= 8)
+    if (__builtin_cpu_supports("avx512vnni")) // since 8.0
+        arch_info |= Arch::X86_AVX512VNNI;
+#endif
+#if (__GNUC__ >= 11)
+    if (__builtin_cpu_supports("f16c")) // since 11.0
+        arch_info |= Arch::X86_F16C;
+#endif
 
     return arch_info;
 }
@@ -49,6 +49,7 @@ inline Arch get_arch_linux_cpuinfo()
     Arch a_popcnt = Arch::X86_POPCNT_INSN;
     Arch a_avx = a_sse4_1 | Arch::X86_AVX;
     Arch a_avx2 = a_avx | Arch::X86_AVX2;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
     Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
     Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
     Arch a_xop = a_sse3 | Arch::X86_XOP;
@@ -56,6 +57,8 @@ inline Arch get_arch_linux_cpuinfo()
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512cd = a_avx512f | Arch::X86_AVX512CD;
 
     ident = "flags\t";
     features["sse2"] = a_sse2;
@@ -64,6 +67,7 @@ inline Arch get_arch_linux_cpuinfo()
     features["sse4_1"] = a_sse4_1;
     features["avx"] = a_avx;
     features["avx2"] = a_avx2;
+    features["f16c"] = a_f16c;
     features["popcnt"] = a_popcnt;
     features["fma"] = a_fma3;
     features["fma4"] = a_fma4;
@@ -72,6 +76,8 @@ inline Arch get_arch_linux_cpuinfo()
     features["avx512bw"] = a_avx512bw;
     features["avx512dq"] = a_avx512dq;
     features["avx512vl"] = a_avx512vl;
+    features["avx512_vnni"] = a_avx512vnni;
+    features["avx512cd"] = a_avx512cd;
 #else
     return res;
 #endif
@@ -135,6 +135,8 @@ inline Arch get_arch_raw_cpuid()
 
         if (ecx & (1u << 28) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX;
+        if (ecx & (1u << 29) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_F16C;
     }
     if (max_ex_cpuid_level >= 0x80000001) {
         simdpp::detail::get_cpuid(0x80000001, 0, &eax, &ebx, &ecx, &edx);
@@ -156,6 +158,10 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_AVX512DQ;
         if (ebx & (1u << 31) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX512VL;
+        if (ebx & (1u << 28) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512CD;
+        if (ecx & (1u << 11) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VNNI;
     }
 
     return arch_info;
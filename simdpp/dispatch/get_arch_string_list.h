@@ -48,6 +48,7 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     Arch a_popcnt = Arch::X86_POPCNT_INSN;
     Arch a_avx = a_sse4_1 | Arch::X86_AVX;
     Arch a_avx2 = a_avx | Arch::X86_AVX2;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
     Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
     Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
     Arch a_xop = a_sse3 | Arch::X86_XOP;
@@ -55,6 +56,8 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512cd = a_avx512f | Arch::X86_AVX512CD;
 
     features.emplace_back("sse2", a_sse2);
     features.emplace_back("sse3", a_sse3);
@@ -63,6 +66,7 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     features.emplace_back("popcnt", a_popcnt);
     features.emplace_back("avx", a_avx);
     features.emplace_back("avx2", a_avx2);
+    features.emplace_back("f16c", a_f16c);
     features.emplace_back("fma3", a_fma3);
     features.emplace_back("fma4", a_fma4);
     features.emplace_back("xop", a_xop);
@@ -70,6 +74,8 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     features.emplace_back("avx512bw", a_avx512bw);
     features.emplace_back("avx512dq", a_avx512dq);
     features.emplace_back("avx512vl", a_avx512vl);
+    features.emplace_back("avx512vnni", a_avx512vnni);
+    features.emplace_back("avx512cd", a_avx512cd);
 #elif SIMDPP_PPC
     Arch a_altivec = Arch::POWER_ALTIVEC;
     Arch a_vsx_206 = a_altivec | Arch::POWER_VSX_206;
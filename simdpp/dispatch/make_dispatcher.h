@@ -258,6 +258,8 @@
 
 #define SIMDPP_DETAIL_RETURN_TOKEN() return
 
+// The resolver is a local class, thus each dispatcher (and each instantiation
+// of a dispatcher template) gets a distinct DispatcherState
 #define SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(TEMPLATE_PREFIX, TEMPLATE_ARGS, R, NAME, ARGS) \
                                                                                 \
 SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
@@ -268,19 +270,66 @@ SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)
 SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))                       \
 {                                                                               \
     using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
-    static FunPtr selected = nullptr;                                           \
-    if (selected == nullptr) {                                                  \
-        ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};   \
-        SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions,                             \
-            (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr)              \
-        ::simdpp::detail::FnVersion version =                                   \
-            ::simdpp::detail::select_version_any(versions,                      \
-                SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO);              \
-        selected = reinterpret_cast<FunPtr>(version.fun_ptr);                   \
-    }                                                                           \
+    struct SimdppDispatchResolver {                                             \
+        static ::simdpp::detail::VoidFunPtr select()                            \
+        {                                                                       \
+            ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {}; \
+            SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions,                         \
+                (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr)          \
+            return ::simdpp::detail::select_version_any(versions,               \
+                SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO).fun_ptr;      \
+        }                                                                       \
+    };                                                                          \
+    FunPtr selected = reinterpret_cast<FunPtr>(                                 \
+        ::simdpp::detail::DispatcherState<SimdppDispatchResolver>::get());      \
     SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R) selected(SIMDPP_DETAIL_FORWARD(ARGS));  \
 }
 
+#if defined(SIMDPP_DISPATCH_USE_IFUNC) && defined(__GNUC__) && \
+    defined(__ELF__) && !defined(__INTEL_COMPILER)
+#define SIMDPP_DETAIL_DISPATCH_IFUNC 1
+#else
+#define SIMDPP_DETAIL_DISPATCH_IFUNC 0
+#endif
+
+#if SIMDPP_DETAIL_DISPATCH_IFUNC
+#include <simdpp/detail/preprocessor/stringize.hpp>
+
+// The resolver has C language linkage so that its symbol name is known. The
+// line number keeps the names of resolvers of overloaded functions distinct.
+#define SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)                                      \
+    SIMDPP_PP_CAT(SIMDPP_PP_CAT(simdpp_ifunc_resolve_, NAME),                   \
+                  SIMDPP_PP_CAT(_, __LINE__))
+
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC_IMPL(R, NAME, ARGS)                 \
+                                                                                \
+SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
+    (SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_DETAIL_TYPES(ARGS))))              \
+                                                                                \
+extern "C" {                                                                    \
+static ::simdpp::detail::FunPtrOf<                                              \
+    SIMDPP_PP_REMOVE_PARENS(R)(SIMDPP_DETAIL_TYPES(ARGS))>                      \
+        SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)()                                    \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};       \
+    SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, (NAME), FunPtr)                 \
+    return reinterpret_cast<FunPtr>(                                            \
+        ::simdpp::detail::select_version_any(versions,                          \
+            SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO).fun_ptr);         \
+}                                                                               \
+}                                                                               \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_TYPES(ARGS))                      \
+    __attribute__((ifunc(SIMDPP_PP_STRINGIZE(SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)))));
+
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_NONTEMPLATE(R, NAME, ARGS)                \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC_IMPL(R, NAME, ARGS)
+#else
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_NONTEMPLATE(R, NAME, ARGS)                \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL((), (), R, NAME, ARGS)
+#endif
+
 #define SIMDPP_DETAIL_IGNORE_PARENS2(x)                                         \
     SIMDPP_DETAIL_IGNORE_PARENS(SIMDPP_DETAIL_IGNORE_PARENS(x))
 
@@ -299,9 +348,7 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
 #define SIMDPP_DETAIL_MAKE_DISPATCHER1(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 #define SIMDPP_DETAIL_MAKE_DISPATCHER2(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 #define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC)                                    \
-    SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(                                         \
-        (),                                                                     \
-        (),                                                                     \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_NONTEMPLATE(                                  \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
         SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))))
@@ -362,8 +409,21 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
     implements the dispatch mechanism.
 
     The dispatch functions check the enabled instruction set and select the
-    best function on first call. The initialization does not introduce race
-    conditions when done concurrently.
+    best function on first call, or when simdpp::dispatch_init() is called.
+    The selected function is stored atomically, thus the initialization does
+    not introduce race conditions when done concurrently. After the
+    initialization each call costs one load and one indirect call.
+
+    If the SIMDPP_DISPATCH_USE_IFUNC macro is defined and the target supports
+    GNU indirect functions (GCC or Clang on ELF platforms), non-template
+    dispatchers are instead defined as indirect functions that are resolved
+    by the dynamic loader when the program or library is loaded. The calls
+    then cost the same as regular calls to functions in shared libraries. The
+    expression passed via SIMDPP_USER_ARCH_INFO is evaluated before static
+    initialization, thus it must not depend on global state: e.g.
+    simdpp::get_arch_raw_cpuid() is suitable, whereas
+    simdpp::get_arch_linux_cpuinfo() is not. Dispatcher templates always use
+    the default mechanism.
 
     The generated dispatching code links to all versions of the dispatched
     function statically, so techniques to prevent linkers from stripping
@@ -68,6 +68,9 @@ static inline Arch this_compile_arch()
 #if SIMDPP_ARCH_PP_USE_AVX2
     res |= Arch::X86_AVX2;
 #endif
+#if SIMDPP_ARCH_PP_USE_F16C
+    res |= Arch::X86_F16C;
+#endif
 #if SIMDPP_ARCH_PP_USE_FMA3
     res |= Arch::X86_FMA3;
 #endif
@@ -89,6 +92,12 @@ static inline Arch this_compile_arch()
 #if SIMDPP_ARCH_PP_USE_AVX512VL
     res |= Arch::X86_AVX512VL;
 #endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+    res |= Arch::X86_AVX512VNNI;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+    res |= Arch::X86_AVX512CD;
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
     res |= Arch::ARM_NEON;
 #endif
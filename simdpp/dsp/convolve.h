@@ -0,0 +1,67 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DSP_CONVOLVE_H
+#define LIBSIMDPP_SIMDPP_DSP_CONVOLVE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/detail/dsp/convolve.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Convolves the image of @a rows x @a cols elements at @a src with the
+    separable kernel that is the outer product of the vertical kernel @a ky
+    and the horizontal kernel @a kx. Only the outputs for which the kernel
+    lies entirely within the image are computed, thus the destination has
+    <tt>rows - ky_size + 1</tt> rows and <tt>cols - kx_size + 1</tt>
+    columns. Nothing is written if the image is smaller than the kernel.
+
+    @code
+    dst[r][c] = sum(ky[v] * kx[u] * src[r + ky_size - 1 - v][c + kx_size - 1 - u])
+    @endcode
+
+    The strides are the distances between the starts of consecutive rows in
+    elements. @a dst must not overlap @a src.
+
+    The rows are first filtered horizontally as in fir(), then the columns of
+    the intermediate rows are filtered vertically. Only the last @a ky_size
+    intermediate rows are kept in a temporary buffer.
+*/
+SIMDPP_INL void convolve_separable(const float* src, std::size_t rows,
+                                   std::size_t cols, std::size_t src_stride,
+                                   const float* kx, std::size_t kx_size,
+                                   const float* ky, std::size_t ky_size,
+                                   float* dst, std::size_t dst_stride)
+{
+    detail::dsp::convolve_separable(src, rows, cols, src_stride, kx, kx_size,
+                                    ky, ky_size, dst, dst_stride);
+}
+
+/** Same as the floating-point convolve_separable(), except that the
+    elements are 16-bit integers and the kernels are Q15 fixed-point numbers.
+    The result of each pass is rounded and saturated to 16 bits as in fir().
+*/
+SIMDPP_INL void convolve_separable(const int16_t* src, std::size_t rows,
+                                   std::size_t cols, std::size_t src_stride,
+                                   const int16_t* kx, std::size_t kx_size,
+                                   const int16_t* ky, std::size_t ky_size,
+                                   int16_t* dst, std::size_t dst_stride)
+{
+    detail::dsp::convolve_separable(src, rows, cols, src_stride, kx, kx_size,
+                                    ky, ky_size, dst, dst_stride);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
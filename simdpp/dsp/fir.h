@@ -0,0 +1,92 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DSP_FIR_H
+#define LIBSIMDPP_SIMDPP_DSP_FIR_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/detail/dsp/fir.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Applies the FIR filter with @a taps coefficients at @a h to the @a n
+    samples at @a x. The first <tt>taps - 1</tt> samples are the history of
+    the filter, thus <tt>n - taps + 1</tt> outputs are computed:
+
+    @code
+    y[i] = h[0] * x[i + taps - 1] + h[1] * x[i + taps - 2] + ... + h[taps - 1] * x[i]
+    @endcode
+
+    Returns the number of outputs written to @a y, which is zero if @a n is
+    less than @a taps. @a y must not overlap @a x.
+
+    Each coefficient is broadcast and multiplied by a window of the input
+    loaded at the offset of the tap, using fused multiply-add where
+    available. The order of the additions may differ from the formula above.
+*/
+SIMDPP_INL std::size_t fir(const float* x, std::size_t n,
+                           const float* h, std::size_t taps, float* y)
+{
+    return detail::dsp::fir(x, n, h, taps, y);
+}
+
+/** Same as the floating-point fir(), except that the samples are 16-bit
+    integers and the coefficients are Q15 fixed-point numbers. The products
+    are accumulated in 32 bits, then the result is shifted right by 15 bits
+    with rounding to nearest and saturated to 16 bits. The accumulation
+    wraps around on overflow, which is not possible if the sum of the
+    absolute values of the coefficients does not exceed 1.0.
+*/
+SIMDPP_INL std::size_t fir(const int16_t* x, std::size_t n,
+                           const int16_t* h, std::size_t taps, int16_t* y)
+{
+    return detail::dsp::fir(x, n, h, taps, y);
+}
+
+/** Applies the FIR filter with @a taps coefficients at @a h to the @a n
+    samples at @a x and decimates the result by @a factor. Only every
+    @a factor-th output of fir() is computed:
+
+    @code
+    y[i] = h[0] * x[i * factor + taps - 1] + ... + h[taps - 1] * x[i * factor]
+    @endcode
+
+    Returns the number of outputs written to @a y, which is
+    <tt>(n - taps) / factor + 1</tt>, or zero if @a n is less than @a taps or
+    @a factor is zero.
+
+    The filter is computed in polyphase form: the input is split into
+    @a factor phases, each of which is filtered by the corresponding subset
+    of the coefficients. Thus the amount of work is proportional to the
+    number of outputs.
+*/
+SIMDPP_INL std::size_t fir_decimate(const float* x, std::size_t n,
+                                    const float* h, std::size_t taps,
+                                    std::size_t factor, float* y)
+{
+    return detail::dsp::fir_decimate(x, n, h, taps, factor, y);
+}
+
+/// Same as the floating-point fir_decimate(), except that the filter is
+/// computed in Q15 fixed-point arithmetic as in fir()
+SIMDPP_INL std::size_t fir_decimate(const int16_t* x, std::size_t n,
+                                    const int16_t* h, std::size_t taps,
+                                    std::size_t factor, int16_t* y)
+{
+    return detail::dsp::fir_decimate(x, n, h, taps, factor, y);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
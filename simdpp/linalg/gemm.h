@@ -0,0 +1,54 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_LINALG_GEMM_H
+#define LIBSIMDPP_SIMDPP_LINALG_GEMM_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <simdpp/detail/linalg/gemm.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes <tt>C = alpha * A * B + beta * C</tt>, where A is a @a m x @a k
+    matrix, B is a @a k x @a n matrix and C is a @a m x @a n matrix. All
+    matrices are stored in row-major order; @a lda, @a ldb and @a ldc are the
+    distances between the starts of consecutive rows in elements. If @a beta
+    is zero, C is not read, thus it may contain NaN values. C must not
+    overlap A or B.
+
+    The blocks of A and B are packed into temporary buffers and multiplied
+    by a register-blocked micro-kernel that computes 6 rows of two vectors
+    of C, or 14 rows on AVX-512. Fused multiply-add is used where available.
+    The computation runs on the calling thread; independent blocks of rows of
+    C may be computed in parallel by the caller.
+*/
+SIMDPP_INL void sgemm(std::size_t m, std::size_t n, std::size_t k, float alpha,
+                      const float* a, std::size_t lda,
+                      const float* b, std::size_t ldb,
+                      float beta, float* c, std::size_t ldc)
+{
+    detail::linalg::gemm(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+/// Same as sgemm(), except that the matrices hold double-precision values
+SIMDPP_INL void dgemm(std::size_t m, std::size_t n, std::size_t k, double alpha,
+                      const double* a, std::size_t lda,
+                      const double* b, std::size_t ldb,
+                      double beta, double* c, std::size_t ldc)
+{
+    detail::linalg::gemm(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
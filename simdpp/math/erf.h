@@ -0,0 +1,95 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_ERF_H
+#define LIBSIMDPP_SIMDPP_MATH_ERF_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/erf.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the error function of the elements.
+
+    @code
+    r0 = erf(a0)
+    ...
+    rN = erf(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> erf(const float32<N,E>& a)
+{
+    return detail::math::i_erf<false>(a.eval());
+}
+
+/** Computes the error function of the elements.
+
+    @code
+    r0 = erf(a0)
+    ...
+    rN = erf(aN)
+    @endcode
+
+    The maximum error is 3.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> erf(const float64<N,E>& a)
+{
+    return detail::math::i_erf<false>(a.eval());
+}
+
+/** Computes an approximate error function of the elements.
+
+    @code
+    r0 = erf(a0)
+    ...
+    rN = erf(aN)
+    @endcode
+
+    The maximum error is 7.5 ULP.
+
+    This is a faster, lower precision version of @c erf(). The polynomial
+    approximations have 5 and 7 instead of 6 and 9 terms and the faster
+    version of exp() is used.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> erf_e(const float32<N,E>& a)
+{
+    return detail::math::i_erf<true>(a.eval());
+}
+
+/** Computes an approximate error function of the elements.
+
+    @code
+    r0 = erf(a0)
+    ...
+    rN = erf(aN)
+    @endcode
+
+    The maximum error is 40 ULP.
+
+    This is a faster, lower precision version of @c erf(). The polynomial
+    approximations have 13 and 15 instead of 15 and 19 terms and the faster
+    version of exp() is used.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> erf_e(const float64<N,E>& a)
+{
+    return detail::math::i_erf<true>(a.eval());
+}
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,105 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_EXP_H
+#define LIBSIMDPP_SIMDPP_MATH_EXP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the base-e exponential of the elements.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum error is 1 ULP.
+
+    Results that are above the range of the type are rounded to infinity,
+    results below the range of subnormal numbers are rounded to zero.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> exp(const float32<N,E>& a)
+{
+    return detail::math::i_exp<false>(a.eval());
+}
+
+/** Computes the base-e exponential of the elements.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum error is 1 ULP.
+
+    Results that are above the range of the type are rounded to infinity,
+    results below the range of subnormal numbers are rounded to zero.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> exp(const float64<N,E>& a)
+{
+    return detail::math::i_exp<false>(a.eval());
+}
+
+/** Computes an approximate base-e exponential of the elements.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum error is 6 ULP.
+
+    Results that are above the range of the type are rounded to infinity,
+    results below the range of subnormal numbers are rounded to zero.
+
+    This is a faster, lower precision version of @c exp(). The polynomial
+    approximation has 4 instead of 6 terms.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> exp_e(const float32<N,E>& a)
+{
+    return detail::math::i_exp<true>(a.eval());
+}
+
+/** Computes an approximate base-e exponential of the elements.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum error is 9 ULP.
+
+    Results that are above the range of the type are rounded to infinity,
+    results below the range of subnormal numbers are rounded to zero.
+
+    This is a faster, lower precision version of @c exp(). The polynomial
+    approximation has 9 instead of 11 terms.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> exp_e(const float64<N,E>& a)
+{
+    return detail::math::i_exp<true>(a.eval());
+}
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,101 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_LOG_H
+#define LIBSIMDPP_SIMDPP_MATH_LOG_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/log.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the natural logarithm of the elements.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 1 ULP.
+
+    Negative arguments produce NaN, zero produces negative infinity.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> log(const float32<N,E>& a)
+{
+    return detail::math::i_log<false>(a.eval());
+}
+
+/** Computes the natural logarithm of the elements.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 1 ULP.
+
+    Negative arguments produce NaN, zero produces negative infinity.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> log(const float64<N,E>& a)
+{
+    return detail::math::i_log<false>(a.eval());
+}
+
+/** Computes an approximate natural logarithm of the elements.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 6.5 ULP.
+
+    Negative arguments produce NaN, zero produces negative infinity.
+
+    This is a faster, lower precision version of @c log(). The polynomial
+    approximation has 2 instead of 4 terms.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> log_e(const float32<N,E>& a)
+{
+    return detail::math::i_log<true>(a.eval());
+}
+
+/** Computes an approximate natural logarithm of the elements.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 5.5 ULP.
+
+    Negative arguments produce NaN, zero produces negative infinity.
+
+    This is a faster, lower precision version of @c log(). The polynomial
+    approximation has 6 instead of 8 terms.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> log_e(const float64<N,E>& a)
+{
+    return detail::math::i_log<true>(a.eval());
+}
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
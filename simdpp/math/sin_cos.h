@@ -0,0 +1,203 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_SIN_COS_H
+#define LIBSIMDPP_SIMDPP_MATH_SIN_COS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/sin_cos.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the sine of the elements.
+
+    @code
+    r0 = sin(a0)
+    ...
+    rN = sin(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+
+    The bound holds for arguments with magnitude up to 6000. The precision
+    of the argument reduction degrades for larger arguments. Infinite
+    arguments produce NaN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> sin(const float32<N,E>& a)
+{
+    return detail::math::i_sin<false>(a.eval());
+}
+
+/** Computes the sine of the elements.
+
+    @code
+    r0 = sin(a0)
+    ...
+    rN = sin(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+
+    The bound holds for arguments with magnitude up to 1.6e6. The precision
+    of the argument reduction degrades for larger arguments. Infinite
+    arguments produce NaN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> sin(const float64<N,E>& a)
+{
+    return detail::math::i_sin<false>(a.eval());
+}
+
+/** Computes an approximate sine of the elements.
+
+    @code
+    r0 = sin(a0)
+    ...
+    rN = sin(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+
+    The bound holds for arguments with magnitude up to 6000. The precision
+    of the argument reduction degrades for larger arguments. Infinite
+    arguments produce NaN.
+
+    This is a faster, lower precision version of @c sin(). The polynomial
+    approximation has 3 instead of 4 terms. The error of the shorter
+    polynomial is still below the rounding error of the result, so the maximum
+    error is the same as that of @c sin(): it does not exceed 1.6 ULP within
+    [-pi, pi] and grows up to the bound above because of the argument
+    reduction.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> sin_e(const float32<N,E>& a)
+{
+    return detail::math::i_sin<true>(a.eval());
+}
+
+/** Computes an approximate sine of the elements.
+
+    @code
+    r0 = sin(a0)
+    ...
+    rN = sin(aN)
+    @endcode
+
+    The maximum error is 125 ULP.
+
+    The bound holds for arguments with magnitude up to 1.6e6. The precision
+    of the argument reduction degrades for larger arguments. Infinite
+    arguments produce NaN.
+
+    This is a faster, lower precision version of @c sin(). The polynomial
+    approximation has 5 instead of 7 terms.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> sin_e(const float64<N,E>& a)
+{
+    return detail::math::i_sin<true>(a.eval());
+}
+
+/** Computes the cosine of the elements.
+
+    @code
+    r0 = cos(a0)
+    ...
+    rN = cos(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+
+    The bound holds for arguments with magnitude up to 6000. The precision
+    of the argument reduction degrades for larger arguments. Infinite
+    arguments produce NaN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> cos(const float32<N,E>& a)
+{
+    return detail::math::i_cos<false>(a.eval());
+}
+
+/** Computes the cosine of the elements.
+
+    @code
+    r0 = cos(a0)
+    ...
+    rN = cos(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+
+    The bound holds for arguments with magnitude up to 1.6e6. The precision
+    of the argument reduction degrades for larger arguments. Infinite
+    arguments produce NaN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> cos(const float64<N,E>& a)
+{
+    return detail::math::i_cos<false>(a.eval());
+}
+
+/** Computes an approximate cosine of the elements.
+
+    @code
+    r0 = cos(a0)
+    ...
+    rN = cos(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+
+    The bound holds for arguments with magnitude up to 6000. The precision
+    of the argument reduction degrades for larger arguments. Infinite
+    arguments produce NaN.
+
+    This is a faster, lower precision version of @c cos(). The polynomial
+    approximation has 3 instead of 4 terms. The error of the shorter
+    polynomial is still below the rounding error of the result, so the maximum
+    error is the same as that of @c cos(): it does not exceed 1.6 ULP within
+    [-pi, pi] and grows up to the bound above because of the argument
+    reduction.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> cos_e(const float32<N,E>& a)
+{
+    return detail::math::i_cos<true>(a.eval());
+}
+
+/** Computes an approximate cosine of the elements.
+
+    @code
+    r0 = cos(a0)
+    ...
+    rN = cos(aN)
+    @endcode
+
+    The maximum error is 125 ULP.
+
+    The bound holds for arguments with magnitude up to 1.6e6. The precision
+    of the argument reduction degrades for larger arguments. Infinite
+    arguments produce NaN.
+
+    This is a faster, lower precision version of @c cos(). The polynomial
+    approximation has 5 instead of 7 terms.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> cos_e(const float64<N,E>& a)
+{
+    return detail::math::i_cos<true>(a.eval());
+}
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,93 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_TANH_H
+#define LIBSIMDPP_SIMDPP_MATH_TANH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/tanh.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the hyperbolic tangent of the elements.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> tanh(const float32<N,E>& a)
+{
+    return detail::math::i_tanh<false>(a.eval());
+}
+
+/** Computes the hyperbolic tangent of the elements.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> tanh(const float64<N,E>& a)
+{
+    return detail::math::i_tanh<false>(a.eval());
+}
+
+/** Computes an approximate hyperbolic tangent of the elements.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum error is 15 ULP.
+
+    This is a faster, lower precision version of @c tanh(). The polynomial
+    approximation of exp() has 4 instead of 6 terms.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> tanh_e(const float32<N,E>& a)
+{
+    return detail::math::i_tanh<true>(a.eval());
+}
+
+/** Computes an approximate hyperbolic tangent of the elements.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum error is 22 ULP.
+
+    This is a faster, lower precision version of @c tanh(). The polynomial
+    approximation of exp() has 9 instead of 11 terms.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> tanh_e(const float64<N,E>& a)
+{
+    return detail::math::i_tanh<true>(a.eval());
+}
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -22,7 +22,27 @@
 namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
 
-// no 8 bit multiplications in SSE
+/** Multiplies 8-bit values and returns the lower part of the multiplication
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512BW, ALTIVEC, 7}
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
+        operator*(const any_int8<N,V1>& a,
+               const any_int8<N,V2>& b)
+{
+    return { { a.wrapped(), b.wrapped() } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(operator*, expr_mul_lo, any_int8, int8)
+
 /** Multiplies 16-bit values and returns the lower part of the multiplication
 
     @code
@@ -71,6 +91,28 @@ typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
 
 SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(operator*, expr_mul_lo, any_int32, int32)
 
+/** Multiplies 64-bit values and returns the lower half of the result.
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{AVX512DQ with AVX512VL, 1}
+    @icost{SSE2-AVX512F, NEON, 8}
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
+        operator*(const any_int64<N,V1>& a,
+               const any_int64<N,V2>& b)
+{
+    return { { a.wrapped(), b.wrapped() } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(operator*, expr_mul_lo, any_int64, int64)
+
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
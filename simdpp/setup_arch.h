@@ -56,6 +56,11 @@
 #else
 #define SIMDPP_USE_AVX2 0
 #endif
+#if SIMDPP_ARCH_PP_USE_F16C
+#define SIMDPP_USE_F16C 1
+#else
+#define SIMDPP_USE_F16C 0
+#endif
 #if SIMDPP_ARCH_PP_USE_FMA3
 #define SIMDPP_USE_FMA3 1
 #else
@@ -91,6 +96,16 @@
 #else
 #define SIMDPP_USE_AVX512VL 0
 #endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_USE_AVX512VNNI 1
+#else
+#define SIMDPP_USE_AVX512VNNI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+#define SIMDPP_USE_AVX512CD 1
+#else
+#define SIMDPP_USE_AVX512CD 0
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
 #define SIMDPP_USE_NEON 1
 #else
@@ -164,6 +179,11 @@
 #else
 #define SIMDPP_NS_ID_AVX2
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_F16C
+#define SIMDPP_NS_ID_F16C SIMDPP_INSN_ID_F16C
+#else
+#define SIMDPP_NS_ID_F16C
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_FMA3
 #define SIMDPP_NS_ID_FMA3 SIMDPP_INSN_ID_FMA3
 #else
@@ -199,6 +219,16 @@
 #else
 #define SIMDPP_NS_ID_AVX512VL
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#define SIMDPP_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+#else
+#define SIMDPP_NS_ID_AVX512VNNI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#define SIMDPP_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+#else
+#define SIMDPP_NS_ID_AVX512CD
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_NEON
 #define SIMDPP_NS_ID_NEON SIMDPP_INSN_ID_NEON
 #else
@@ -230,7 +260,7 @@
 #define SIMDPP_NS_ID_MSA
 #endif
 
-#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE22(arch,                           \
+#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE25(arch,                           \
     SIMDPP_NS_ID_NULL,                                                          \
     SIMDPP_NS_ID_SSE2,                                                          \
     SIMDPP_NS_ID_SSE3,                                                          \
@@ -239,10 +269,13 @@
     SIMDPP_NS_ID_POPCNT_INSN,                                                   \
     SIMDPP_NS_ID_AVX,                                                           \
     SIMDPP_NS_ID_AVX2,                                                          \
+    SIMDPP_NS_ID_F16C,                                                          \
     SIMDPP_NS_ID_AVX512F,                                                       \
     SIMDPP_NS_ID_AVX512BW,                                                      \
     SIMDPP_NS_ID_AVX512DQ,                                                      \
     SIMDPP_NS_ID_AVX512VL,                                                      \
+    SIMDPP_NS_ID_AVX512VNNI,                                                    \
+    SIMDPP_NS_ID_AVX512CD,                                                      \
     SIMDPP_NS_ID_FMA3,                                                          \
     SIMDPP_NS_ID_FMA4,                                                          \
     SIMDPP_NS_ID_XOP,                                                           \
@@ -32,6 +32,8 @@
 #include <simdpp/core/cmp_le.h>
 #include <simdpp/core/cmp_lt.h>
 #include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/compress.h>
+#include <simdpp/core/expand.h>
 #include <simdpp/core/extract.h>
 #include <simdpp/core/extract_bits.h>
 #include <simdpp/core/f_abs.h>
@@ -60,12 +62,18 @@
 #include <simdpp/core/f_sub.h>
 #include <simdpp/core/f_trunc.h>
 #include <simdpp/core/for_each.h>
+#include <simdpp/core/gather.h>
 #include <simdpp/core/i_abs.h>
+#include <simdpp/core/i_abs_diff.h>
 #include <simdpp/core/i_add.h>
 #include <simdpp/core/i_add_sat.h>
 #include <simdpp/core/i_avg.h>
 #include <simdpp/core/i_avg_trunc.h>
+#include <simdpp/core/i_bit_reverse.h>
+#include <simdpp/core/i_div.h>
 #include <simdpp/core/i_div_p.h>
+#include <simdpp/core/i_dot_acc.h>
+#include <simdpp/core/i_lzcnt.h>
 #include <simdpp/core/i_max.h>
 #include <simdpp/core/i_min.h>
 #include <simdpp/core/i_mul.h>
@@ -79,12 +87,14 @@
 #include <simdpp/core/i_reduce_mul.h>
 #include <simdpp/core/i_reduce_or.h>
 #include <simdpp/core/i_reduce_popcnt.h>
+#include <simdpp/core/i_rotate.h>
 #include <simdpp/core/i_shift_l.h>
 #include <simdpp/core/i_shift_r.h>
 #include <simdpp/core/i_sub.h>
 #include <simdpp/core/i_sub_sat.h>
 #include <simdpp/core/insert.h>
 #include <simdpp/core/load.h>
+#include <simdpp/core/load_masked.h>
 #include <simdpp/core/load_packed2.h>
 #include <simdpp/core/load_packed3.h>
 #include <simdpp/core/load_packed4.h>
@@ -94,12 +104,15 @@
 #include <simdpp/core/make_int.h>
 #include <simdpp/core/make_uint.h>
 #include <simdpp/core/make_shuffle_bytes_mask.h>
+#include <simdpp/core/masked_ops.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/move_r.h>
 #include <simdpp/core/permute2.h>
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/permute_bytes16.h>
 #include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/prefix_sum.h>
+#include <simdpp/core/scatter.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/core/shuffle1.h>
 #include <simdpp/core/shuffle2.h>
@@ -117,9 +130,11 @@
 #include <simdpp/core/store_packed4.h>
 #include <simdpp/core/store_u.h>
 #include <simdpp/core/stream.h>
+#include <simdpp/core/stream_load.h>
 #include <simdpp/core/test_bits.h>
 #include <simdpp/core/to_float32.h>
 #include <simdpp/core/to_float64.h>
+#include <simdpp/core/to_float16.h>
 #include <simdpp/core/to_int16.h>
 #include <simdpp/core/to_int32.h>
 #include <simdpp/core/to_int64.h>
@@ -196,6 +211,36 @@
 #include <simdpp/operators/i_shift_r.h>
 #include <simdpp/operators/i_sub.h>
 
+#include <simdpp/math/erf.h>
+#include <simdpp/math/exp.h>
+#include <simdpp/math/log.h>
+#include <simdpp/math/sin_cos.h>
+#include <simdpp/math/tanh.h>
+
+#include <simdpp/algorithm/bulk_copy.h>
+#include <simdpp/algorithm/bulk_fill.h>
+#include <simdpp/algorithm/copy.h>
+#include <simdpp/algorithm/count_if.h>
+#include <simdpp/algorithm/fill.h>
+#include <simdpp/algorithm/find_if.h>
+#include <simdpp/algorithm/prefix_sum.h>
+#include <simdpp/algorithm/reduce.h>
+#include <simdpp/algorithm/sort.h>
+#include <simdpp/algorithm/transform.h>
+#include <simdpp/algorithm/transpose.h>
+
+#include <simdpp/string/classify.h>
+#include <simdpp/string/find_first_of.h>
+#include <simdpp/string/memchr.h>
+#include <simdpp/string/memcmp.h>
+#include <simdpp/string/strlen.h>
+#include <simdpp/string/utf8.h>
+
+#include <simdpp/codec/base64.h>
+#include <simdpp/codec/hex.h>
+
+#include <simdpp/linalg/gemm.h>
+
 /** @def SIMDPP_NO_DISPATCHER
     Disables internal dispatching functionality. If the internal dispathcher
     mechanism is not needed, the user can define the @c SIMDPP_NO_DISPATCHER.
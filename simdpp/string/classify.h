@@ -0,0 +1,283 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_STRING_CLASSIFY_H
+#define LIBSIMDPP_SIMDPP_STRING_CLASSIFY_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <simdpp/types.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/string/common.h>
+#include <simdpp/string/find_first_of.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the prefix XOR of the bits of @a x: the bit i of the result is
+    the XOR of the bits 0 to i of @a x. If @a x contains the positions of
+    quote characters, the result contains the bytes between the opening and
+    the closing quotes, including the opening quote.
+
+    There's no carry-less multiplication in the library, thus the bits are
+    combined in six shift and XOR steps.
+*/
+SIMDPP_INL uint64_t prefix_xor(uint64_t x)
+{
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+/** Returns the characters that are escaped by the escape characters at the
+    positions set in @a escape. A character is escaped if it is preceded by an
+    odd number of consecutive escape characters.
+
+    @a carry links consecutive blocks: it must be zero before the first block
+    and is set to one if the first character of the next block is escaped.
+*/
+SIMDPP_INL uint64_t escaped_bits(uint64_t escape, uint64_t& carry)
+{
+    const uint64_t even = 0x5555555555555555;
+
+    // an escaped escape character does not start a sequence
+    escape &= ~carry;
+    uint64_t follows_escape = escape << 1 | carry;
+
+    /*  Adding the starts of the sequences at odd positions to the sequences
+        clears them and sets the bit past their end. The parity of the
+        sequences that start at even positions is then given by the even
+        bits, the parity of the others by the inverted even bits.
+    */
+    uint64_t odd_starts = escape & ~even & ~follows_escape;
+    uint64_t even_seqs = odd_starts + escape;
+    carry = even_seqs < escape ? 1 : 0;
+    return (even ^ (even_seqs << 1)) & follows_escape;
+}
+
+/** Matches blocks of 64 bytes against a set of bytes.
+
+    The bytes are classified using the same nibble lookups as
+    find_first_of(). On SSE2 and SSE3 each byte is compared against every
+    element of the set.
+*/
+class byte_classifier {
+public:
+    /// Creates a classifier for the first @a size bytes of @a set
+    byte_classifier(const char* set, std::size_t size)
+    {
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+        bool seen[256] = {};
+        size_ = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            uint8_t x = set[i];
+            if (!seen[x]) {
+                seen[x] = true;
+                bytes_[size_++] = x;
+            }
+        }
+#else
+        set_ = detail::string::make_byte_set(set, size);
+#endif
+    }
+
+    /** Returns a bitmask whose bit i is set if the element i of @a v belongs
+        to the set.
+    */
+    SIMDPP_INL uint64_t match(const uint8<64>& v) const
+    {
+        using namespace detail::string;
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+        if (size_ == 0)
+            return 0;
+        block_mask m = cmp_eq(v, splat<block_vec>(bytes_[0]));
+        for (unsigned i = 1; i < size_; ++i) {
+            m = bit_or(m, cmp_eq(v, splat<block_vec>(bytes_[i])));
+        }
+        return block_bits(m);
+#else
+        if (set_.has_high)
+            return block_bits(byte_set_matcher<true>{ set_ }(v));
+        return block_bits(byte_set_matcher<false>{ set_ }(v));
+#endif
+    }
+
+    /// Same as above, except that the 64 bytes at @a block are matched
+    SIMDPP_INL uint64_t match(const char* block) const
+    {
+        uint8<64> v = load_u(block);
+        return match(v);
+    }
+
+private:
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    uint8_t bytes_[256];
+    unsigned size_;
+#else
+    detail::string::byte_set set_;
+#endif
+};
+
+/** The classification of a block of 64 bytes of JSON text. The bit i of each
+    field corresponds to the byte i of the block.
+*/
+struct json_block {
+    /// Quotes that are not escaped
+    uint64_t quote;
+    /// Bytes within strings including the opening but not the closing quote
+    uint64_t in_string;
+    /// Bytes that are escaped by a backslash
+    uint64_t escaped;
+    /// The characters <tt>{}[]:,</tt> outside strings
+    uint64_t structural;
+    /// Spaces, tabs, carriage returns and line feeds outside strings
+    uint64_t whitespace;
+};
+
+/** Classifies consecutive blocks of 64 bytes of JSON text. The state of
+    strings and escapes is carried from one block to the next, thus the
+    blocks must be passed in order. The last block should be padded with
+    spaces.
+
+    Escapes are tracked outside strings too, even though they are not valid
+    JSON there.
+*/
+class json_classifier {
+public:
+    json_classifier() :
+        structural_(",:[]{}", 6),
+        whitespace_(" \t\n\r", 4),
+        escape_carry_(0),
+        in_string_(0)
+    {
+    }
+
+    /// Classifies the next 64 bytes at @a block
+    SIMDPP_INL json_block classify(const char* block)
+    {
+        using namespace detail::string;
+        block_vec v = load_u(block);
+        uint64_t backslash = block_bits(cmp_eq(v, splat<block_vec>('\\')));
+        uint64_t quote = block_bits(cmp_eq(v, splat<block_vec>('"')));
+
+        json_block r;
+        r.escaped = escaped_bits(backslash, escape_carry_);
+        r.quote = quote & ~r.escaped;
+        r.in_string = prefix_xor(r.quote) ^ in_string_;
+        r.structural = structural_.match(v) & ~r.in_string;
+        r.whitespace = whitespace_.match(v) & ~r.in_string;
+        // all bits are set if the string continues into the next block
+        in_string_ = uint64_t(0) - (r.in_string >> 63);
+        return r;
+    }
+
+    /// Returns @c true if the last classified block ends within a string
+    bool in_string() const { return in_string_ != 0; }
+
+    /// Returns @c true if the next byte is escaped
+    bool escaped() const { return escape_carry_ != 0; }
+
+private:
+    byte_classifier structural_;
+    byte_classifier whitespace_;
+    uint64_t escape_carry_;
+    uint64_t in_string_;
+};
+
+namespace detail {
+namespace string {
+
+struct csv_state {
+    uint64_t escape_carry;
+    uint64_t in_quotes;
+};
+
+// Returns the separators outside quotes within the 64 bytes at p
+SIMDPP_INL uint64_t csv_block(const uint8_t* p, char delim, char quote,
+                              char escape, csv_state& st)
+{
+    block_vec v = load_u(p);
+    uint64_t q = block_bits(cmp_eq(v, splat<block_vec>(uint8_t(quote))));
+    uint64_t sep = block_bits(bit_or(
+            cmp_eq(v, splat<block_vec>(uint8_t(delim))),
+            cmp_eq(v, splat<block_vec>(uint8_t('\n')))));
+    if (escape != 0) {
+        uint64_t e = block_bits(cmp_eq(v, splat<block_vec>(uint8_t(escape))));
+        uint64_t escaped = escaped_bits(e, st.escape_carry);
+        q &= ~escaped;
+        sep &= ~escaped;
+    }
+    uint64_t in_quotes = prefix_xor(q) ^ st.in_quotes;
+    st.in_quotes = uint64_t(0) - (in_quotes >> 63);
+    return sep & ~in_quotes;
+}
+
+SIMDPP_INL std::size_t* csv_store_offsets(std::size_t* out, std::size_t base,
+                                          uint64_t m)
+{
+    while (m != 0) {
+        *out++ = base + bit_scan_forward(m);
+        m &= m - 1;
+    }
+    return out;
+}
+
+} // namespace string
+} // namespace detail
+
+/** Finds the field and record separators within the first @a n bytes of
+    CSV text at @a s. The offsets of the @a delim characters and the line
+    feeds that are not enclosed in @a quote characters are stored to @a out
+    in increasing order and their number is returned. @a out must have
+    space for @a n elements.
+
+    Quotes within quoted fields are escaped by doubling them as in RFC 4180,
+    which needs no special handling. If @a escape is not zero, the characters
+    preceded by an odd number of consecutive @a escape characters are not
+    treated as quotes or separators. Carriage returns are not removed: a
+    record terminated by CRLF ends with a carriage return.
+
+    The text is classified in blocks of 64 bytes, the quoted state being
+    carried between the blocks using prefix_xor().
+*/
+SIMDPP_INL std::size_t csv_split(const char* s, std::size_t n, std::size_t* out,
+                                 char delim = ',', char quote = '"',
+                                 char escape = 0)
+{
+    using namespace detail::string;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+    std::size_t* o = out;
+    csv_state st = { 0, 0 };
+    std::size_t i = 0;
+    for (; i + block_size <= n; i += block_size) {
+        uint64_t m = csv_block(p + i, delim, quote, escape, st);
+        o = csv_store_offsets(o, i, m);
+    }
+    if (i < n) {
+        SIMDPP_ALIGN(64) uint8_t buf[block_size] = {};
+        std::memcpy(buf, p + i, n - i);
+        uint64_t m = csv_block(buf, delim, quote, escape, st);
+        o = csv_store_offsets(o, i, m & low_bits(n - i));
+    }
+    return o - out;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,147 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_STRING_FIND_FIRST_OF_H
+#define LIBSIMDPP_SIMDPP_STRING_FIND_FIRST_OF_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/string/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace string {
+
+/*  A set of bytes is represented by a pair of lookup tables for each half of
+    the range of the high nibble. The bit (h % 8) of the element l of the low
+    nibble table is set if the byte (h << 4 | l) belongs to the set, the high
+    nibble table maps h to the same bit. A byte belongs to the set if the
+    results of the two lookups share a bit. The second pair is used only if
+    the set contains bytes with the highest bit set.
+*/
+struct byte_set {
+    block_vec lo0, lo1, hi0, hi1;
+    bool has_high;
+};
+
+SIMDPP_INL byte_set make_byte_set(const char* set, std::size_t size)
+{
+    SIMDPP_ALIGN(64) uint8_t lo[2][block_size] = {};
+    byte_set r;
+    r.has_high = false;
+    for (std::size_t i = 0; i < size; ++i) {
+        uint8_t x = set[i];
+        unsigned h = x >> 4;
+        unsigned l = x & 0x0f;
+        if (h >= 8)
+            r.has_high = true;
+        for (unsigned k = 0; k < block_size; k += 16) {
+            lo[h / 8][k + l] |= 1 << (h % 8);
+        }
+    }
+    r.lo0 = load(lo[0]);
+    r.lo1 = load(lo[1]);
+    r.hi0 = make_uint(1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0);
+    r.hi1 = make_uint(0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, 128);
+    return r;
+}
+
+/*  A function object is used instead of a lambda so that the matcher is
+    always inlined into the scanning loop.
+*/
+template<bool High>
+struct byte_set_matcher {
+    const byte_set& set;
+
+    SIMDPP_INL block_mask operator()(const block_vec& v) const
+    {
+        block_vec l = low_nibbles(v);
+        block_vec h = high_nibbles(v);
+        block_vec t = bit_and(permute_bytes16(set.lo0, l),
+                              permute_bytes16(set.hi0, h));
+        if (High) {
+            t = bit_or(t, bit_and(permute_bytes16(set.lo1, l),
+                                  permute_bytes16(set.hi1, h)));
+        }
+        return cmp_neq(t, (block_vec) make_zero());
+    }
+};
+
+template<bool High> SIMDPP_INL
+const char* find_first_of_impl(const char* s, std::size_t n, const byte_set& set)
+{
+    byte_set_matcher<High> pred = { set };
+    const uint8_t* r = find_first(reinterpret_cast<const uint8_t*>(s), n, pred);
+    return reinterpret_cast<const char*>(r);
+}
+
+/*  SSE2 and SSE3 lack byte shuffles, thus the bytes are compared against each
+    element of the set instead.
+*/
+SIMDPP_INL const char* find_first_of_cmp(const char* s, std::size_t n,
+                                         const char* set, std::size_t set_size)
+{
+    const uint8_t* r = find_first(reinterpret_cast<const uint8_t*>(s), n,
+        [&](const block_vec& v)
+        {
+            block_mask m = cmp_eq(v, splat<block_vec>(uint8_t(set[0])));
+            for (std::size_t i = 1; i < set_size; ++i) {
+                m = bit_or(m, cmp_eq(v, splat<block_vec>(uint8_t(set[i]))));
+            }
+            return m;
+        });
+    return reinterpret_cast<const char*>(r);
+}
+
+} // namespace string
+} // namespace detail
+
+/** Returns a pointer to the first byte within the first @a n bytes of @a s
+    that is equal to any of the first @a set_size bytes of @a set, or
+    @c nullptr if there's no such byte.
+
+    The bytes are classified using two lookups into tables of 16 elements
+    indexed by the low and the high nibble of each byte. Sets that contain
+    bytes with the highest bit set need twice as many lookups. On SSE2 and
+    SSE3 each byte is compared against every element of the set, thus the
+    set should be small. The memory is accessed in the same way as in
+    memchr().
+*/
+SIMDPP_INL const char* find_first_of(const char* s, std::size_t n,
+                                     const char* set, std::size_t set_size)
+{
+    using namespace detail::string;
+    if (set_size == 0)
+        return nullptr;
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    return find_first_of_cmp(s, n, set, set_size);
+#else
+    byte_set bs = make_byte_set(set, set_size);
+    if (bs.has_high)
+        return find_first_of_impl<true>(s, n, bs);
+    return find_first_of_impl<false>(s, n, bs);
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
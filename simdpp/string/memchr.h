@@ -0,0 +1,58 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_STRING_MEMCHR_H
+#define LIBSIMDPP_SIMDPP_STRING_MEMCHR_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/string/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Returns a pointer to the first byte within the first @a n bytes of @a s
+    that is equal to <tt>(unsigned char) c</tt>, or @c nullptr if there's no
+    such byte.
+
+    The memory is read in aligned blocks of 64 bytes, thus up to 63 bytes
+    before the start and past the end of the range may be read. Such bytes
+    never reside on a different memory page than the range itself.
+*/
+SIMDPP_INL const void* memchr(const void* s, int c, std::size_t n)
+{
+    using namespace detail::string;
+    block_vec needle = splat<block_vec>(uint8_t(c));
+    return find_first(reinterpret_cast<const uint8_t*>(s), n,
+                      [&](const block_vec& v) { return cmp_eq(v, needle); });
+}
+
+/** Returns a pointer to the last byte within the first @a n bytes of @a s
+    that is equal to <tt>(unsigned char) c</tt>, or @c nullptr if there's no
+    such byte.
+
+    The memory is accessed in the same way as in memchr().
+*/
+SIMDPP_INL const void* memrchr(const void* s, int c, std::size_t n)
+{
+    using namespace detail::string;
+    block_vec needle = splat<block_vec>(uint8_t(c));
+    return find_last(reinterpret_cast<const uint8_t*>(s), n,
+                     [&](const block_vec& v) { return cmp_eq(v, needle); });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
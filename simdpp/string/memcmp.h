@@ -0,0 +1,97 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_STRING_MEMCMP_H
+#define LIBSIMDPP_SIMDPP_STRING_MEMCMP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/detail/string/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace string {
+
+/*  Returns the offset of the first byte that differs within the first @a n
+    bytes of @a a and @a b, or @a n if the ranges are equal. The blocks are
+    loaded using unaligned loads, the last block overlaps the preceding one
+    if @a n is not a multiple of the block size. Ranges shorter than a block
+    are compared byte by byte.
+*/
+SIMDPP_INL std::size_t mismatch(const uint8_t* a, const uint8_t* b, std::size_t n)
+{
+    if (n < block_size) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (a[i] != b[i])
+                return i;
+        }
+        return n;
+    }
+
+    std::size_t i = 0;
+    for (; i + block_size <= n; i += block_size) {
+        block_vec va = load_u(a + i);
+        block_vec vb = load_u(b + i);
+        block_mask e = cmp_neq(va, vb);
+        if (block_any(e))
+            return i + bit_scan_forward(block_bits(e));
+    }
+    if (i < n) {
+        i = n - block_size;
+        block_vec va = load_u(a + i);
+        block_vec vb = load_u(b + i);
+        block_mask e = cmp_neq(va, vb);
+        if (block_any(e))
+            return i + bit_scan_forward(block_bits(e));
+    }
+    return n;
+}
+
+} // namespace string
+} // namespace detail
+
+/** Compares the first @a n bytes of @a a and @a b as unsigned bytes.
+    Returns a negative value, zero or a positive value if @a a is
+    respectively less than, equal to or greater than @a b.
+
+    Only the memory within the two ranges is accessed.
+*/
+SIMDPP_INL int memcmp(const void* a, const void* b, std::size_t n)
+{
+    using namespace detail::string;
+    const uint8_t* pa = reinterpret_cast<const uint8_t*>(a);
+    const uint8_t* pb = reinterpret_cast<const uint8_t*>(b);
+    std::size_t i = mismatch(pa, pb, n);
+    if (i == n)
+        return 0;
+    return int(pa[i]) - int(pb[i]);
+}
+
+/** Returns true if the first @a n bytes of @a a and @a b are equal.
+
+    Only the memory within the two ranges is accessed.
+*/
+SIMDPP_INL bool memeq(const void* a, const void* b, std::size_t n)
+{
+    using namespace detail::string;
+    const uint8_t* pa = reinterpret_cast<const uint8_t*>(a);
+    const uint8_t* pb = reinterpret_cast<const uint8_t*>(b);
+    return mismatch(pa, pb, n) == n;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,57 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_STRING_STRLEN_H
+#define LIBSIMDPP_SIMDPP_STRING_STRLEN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <simdpp/types.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/string/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Returns the number of bytes in the null-terminated string @a s, not
+    including the terminating null byte.
+
+    The memory is read in aligned blocks of 64 bytes, thus up to 63 bytes
+    before the start and past the terminating null byte may be read. Such
+    bytes never reside on a different memory page than the string itself.
+*/
+SIMDPP_INL std::size_t strlen(const char* s)
+{
+    using namespace detail::string;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+    const uint8_t* b = block_start(p);
+    block_vec zero = make_zero();
+
+    block_vec v = load(b);
+    uint64_t m = block_bits(cmp_eq(v, zero)) >> (p - b);
+    if (m != 0)
+        return bit_scan_forward(m);
+
+    for (;;) {
+        b += block_size;
+        v = load(b);
+        block_mask e = cmp_eq(v, zero);
+        if (block_any(e))
+            return (b - p) + bit_scan_forward(block_bits(e));
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,401 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_STRING_UTF8_H
+#define LIBSIMDPP_SIMDPP_STRING_UTF8_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/i_sub_sat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/core/to_int16.h>
+#include <simdpp/core/to_int32.h>
+#include <simdpp/detail/string/common.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// The value returned by the UTF-8 transcoding functions on invalid input
+static const std::size_t utf8_error = ~std::size_t(0);
+
+namespace detail {
+namespace string {
+
+/*  The UTF-8 validation uses the lookup algorithm by Keiser and Lemire. Each
+    byte is classified by three lookups into tables of 16 elements indexed by
+    the high and the low nibble of the preceding byte and the high nibble of
+    the byte itself. Each bit of the results corresponds to a class of errors
+    and the byte pair is erroneous if all three lookups share a bit. The bit
+    7 marks a pair of continuation bytes, which is an error unless the pair is
+    a part of a 3 or 4 byte sequence. This is checked by looking at the bytes
+    two and three positions before.
+
+    The preceding bytes are loaded from the memory directly instead of
+    shifting them in from the previous block. The first and the last block
+    are copied to a buffer padded with zero bytes, thus a truncated sequence
+    at the end of the input is found in the same way as a sequence followed by
+    an ASCII byte.
+*/
+struct utf8_tables {
+    block_vec byte1_high, byte1_low, byte2_high;
+};
+
+SIMDPP_INL utf8_tables make_utf8_tables()
+{
+    const uint8_t too_short = 1 << 0;   // lead byte followed by a lead byte
+    const uint8_t too_long = 1 << 1;    // ASCII followed by a continuation
+    const uint8_t overlong_3 = 1 << 2;  // 1110_0000 100_____
+    const uint8_t too_large = 1 << 3;   // 1111_0100 1001____ and above
+    const uint8_t surrogate = 1 << 4;   // 1110_1101 101_____
+    const uint8_t overlong_2 = 1 << 5;  // 1100_000_ 10______
+    const uint8_t too_large_1000 = 1 << 6; // 1111_0101 1000____ and above
+    const uint8_t overlong_4 = 1 << 6;  // 1111_0000 1000____
+    const uint8_t two_conts = 1 << 7;   // two continuation bytes
+    const uint8_t carry = too_short | too_long | two_conts;
+
+    utf8_tables r;
+    r.byte1_high = make_uint(
+        // 0_______: ASCII
+        too_long, too_long, too_long, too_long,
+        too_long, too_long, too_long, too_long,
+        // 10______: continuation
+        two_conts, two_conts, two_conts, two_conts,
+        // 1100____, 1101____: two byte lead
+        too_short | overlong_2,
+        too_short,
+        // 1110____: three byte lead
+        too_short | overlong_3 | surrogate,
+        // 1111____: four byte lead
+        too_short | too_large | too_large_1000 | overlong_4);
+    r.byte1_low = make_uint(
+        // ____0000
+        carry | overlong_3 | overlong_2 | overlong_4,
+        // ____0001
+        carry | overlong_2,
+        // ____001_
+        carry,
+        carry,
+        // ____0100
+        carry | too_large,
+        // ____0101, ____011_, ____1___
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        // ____1101
+        carry | too_large | too_large_1000 | surrogate,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000);
+    r.byte2_high = make_uint(
+        // 0_______: ASCII
+        too_short, too_short, too_short, too_short,
+        too_short, too_short, too_short, too_short,
+        // 1000____
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+            overlong_4,
+        // 1001____
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        // 101_____
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        // 11______: lead byte
+        too_short, too_short, too_short, too_short);
+    return r;
+}
+
+/*  Returns nonzero bytes where the bytes at p are not valid UTF-8. The three
+    bytes before p must be accessible.
+*/
+SIMDPP_INL block_vec utf8_check_block(const uint8_t* p, const utf8_tables& t)
+{
+    block_vec input = load_u(p);
+    block_vec prev1 = load_u(p - 1);
+    block_vec prev2 = load_u(p - 2);
+    block_vec prev3 = load_u(p - 3);
+
+    block_vec b1h = permute_bytes16(t.byte1_high, high_nibbles(prev1));
+    block_vec b1l = permute_bytes16(t.byte1_low, low_nibbles(prev1));
+    block_vec b2h = permute_bytes16(t.byte2_high, high_nibbles(input));
+    block_vec special = bit_and(bit_and(b1h, b1l), b2h);
+
+    // bit 7 is set if the byte is the third or the fourth byte of a sequence
+    block_vec must23 = bit_or(sub_sat(prev2, 0xe0 - 0x80),
+                              sub_sat(prev3, 0xf0 - 0x80));
+    return bit_xor(special, bit_and(must23, 0x80));
+}
+
+/*  Same as utf8_check_block(), except that only the bytes within
+    [begin, end) are considered and the rest are assumed to be zero.
+*/
+SIMDPP_INL block_vec utf8_check_padded(const uint8_t* begin,
+                                       const uint8_t* end, const uint8_t* p,
+                                       const utf8_tables& t)
+{
+    SIMDPP_ALIGN(64) uint8_t buf[block_size * 2] = {};
+    const uint8_t* lo = std::max(begin, p - 3);
+    const uint8_t* hi = std::min(end, p + block_size);
+    if (lo < hi)
+        std::memcpy(buf + block_size - (p - lo), lo, hi - lo);
+    return utf8_check_block(buf + block_size, t);
+}
+
+SIMDPP_INL bool utf8_is_ascii(const block_vec& v)
+{
+    return !test_bits_any(bit_and(v, 0x80));
+}
+
+/*  Decodes a single code point of valid UTF-8 at p and returns the pointer to
+    the next code point.
+*/
+SIMDPP_INL const uint8_t* utf8_decode(const uint8_t* p, uint32_t& cp)
+{
+    uint32_t c = p[0];
+    if (c < 0x80) {
+        cp = c;
+        return p + 1;
+    }
+    if (c < 0xe0) {
+        cp = (c & 0x1f) << 6 | (p[1] & 0x3f);
+        return p + 2;
+    }
+    if (c < 0xf0) {
+        cp = (c & 0x0f) << 12 | (p[1] & 0x3f) << 6 | (p[2] & 0x3f);
+        return p + 3;
+    }
+    cp = (c & 0x07) << 18 | (p[1] & 0x3f) << 12 | (p[2] & 0x3f) << 6 |
+         (p[3] & 0x3f);
+    return p + 4;
+}
+
+// Writes a code point and returns the pointer past the written code units
+SIMDPP_INL uint32_t* utf8_put(uint32_t* d, uint32_t cp)
+{
+    *d++ = cp;
+    return d;
+}
+
+SIMDPP_INL uint16_t* utf8_put(uint16_t* d, uint32_t cp)
+{
+    if (cp < 0x10000) {
+        *d++ = uint16_t(cp);
+    } else {
+        cp -= 0x10000;
+        *d++ = uint16_t(0xd800 | cp >> 10);
+        *d++ = uint16_t(0xdc00 | (cp & 0x3ff));
+    }
+    return d;
+}
+
+// Writes a block of ASCII characters
+SIMDPP_INL uint32_t* utf8_widen(uint32_t* d, const block_vec& v)
+{
+    store_u(d, to_uint32(v));
+    return d + block_size;
+}
+
+SIMDPP_INL uint16_t* utf8_widen(uint16_t* d, const block_vec& v)
+{
+    store_u(d, to_uint16(v));
+    return d + block_size;
+}
+
+/*  Transcodes valid UTF-8. The blocks that contain only ASCII bytes are
+    widened using vector operations, the rest are decoded one code point at a
+    time.
+*/
+template<class W> SIMDPP_INL
+W* utf8_transcode(const uint8_t* p, const uint8_t* end, W* d)
+{
+    while (end - p >= std::ptrdiff_t(block_size)) {
+        block_vec v = load_u(p);
+        if (utf8_is_ascii(v)) {
+            d = utf8_widen(d, v);
+            p += block_size;
+            continue;
+        }
+        const uint8_t* block_end = p + block_size;
+        while (p < block_end) {
+            uint32_t cp;
+            p = utf8_decode(p, cp);
+            d = utf8_put(d, cp);
+        }
+    }
+    while (p < end) {
+        uint32_t cp;
+        p = utf8_decode(p, cp);
+        d = utf8_put(d, cp);
+    }
+    return d;
+}
+
+// Validates [begin, end) using the lookup tables. The range must not be empty
+SIMDPP_INL bool utf8_validate_lookup(const uint8_t* begin, const uint8_t* end)
+{
+    utf8_tables t = make_utf8_tables();
+
+    block_vec error = utf8_check_padded(begin, end, begin, t);
+    const uint8_t* p = begin + block_size;
+    for (; end - p >= std::ptrdiff_t(block_size); p += block_size) {
+        // the three preceding bytes must be checked too
+        block_vec v = load_u(p);
+        block_vec prev3 = load_u(p - 3);
+        if (!utf8_is_ascii(bit_or(v, prev3)))
+            error = bit_or(error, utf8_check_block(p, t));
+    }
+    error = bit_or(error, utf8_check_padded(begin, end, p, t));
+    return !test_bits_any(error);
+}
+
+/*  Validates a single code point at p and returns the pointer to the next
+    code point or nullptr if the code point is invalid.
+*/
+SIMDPP_INL const uint8_t* utf8_validate_one(const uint8_t* p,
+                                            const uint8_t* end)
+{
+    uint32_t c = p[0];
+    if (c < 0x80)
+        return p + 1;
+    std::ptrdiff_t len;
+    uint32_t min;
+    if (c >= 0xc2 && c < 0xe0) {
+        len = 2; min = 0x80; c &= 0x1f;
+    } else if (c >= 0xe0 && c < 0xf0) {
+        len = 3; min = 0x800; c &= 0x0f;
+    } else if (c >= 0xf0 && c < 0xf5) {
+        len = 4; min = 0x10000; c &= 0x07;
+    } else {
+        return nullptr;
+    }
+    if (end - p < len)
+        return nullptr;
+    for (std::ptrdiff_t i = 1; i < len; ++i) {
+        if ((p[i] & 0xc0) != 0x80)
+            return nullptr;
+        c = c << 6 | (p[i] & 0x3f);
+    }
+    if (c < min || c > 0x10ffff || (c >= 0xd800 && c < 0xe000))
+        return nullptr;
+    return p + len;
+}
+
+/*  SSE2 and SSE3 lack byte shuffles, thus only the blocks that contain only
+    ASCII bytes are handled using vector operations and the rest are validated
+    one code point at a time.
+*/
+SIMDPP_INL bool utf8_validate_scalar(const uint8_t* p, const uint8_t* end)
+{
+    while (end - p >= std::ptrdiff_t(block_size)) {
+        block_vec v = load_u(p);
+        if (utf8_is_ascii(v)) {
+            p += block_size;
+            continue;
+        }
+        const uint8_t* block_end = p + block_size;
+        while (p < block_end) {
+            p = utf8_validate_one(p, end);
+            if (p == nullptr)
+                return false;
+        }
+    }
+    while (p < end) {
+        p = utf8_validate_one(p, end);
+        if (p == nullptr)
+            return false;
+    }
+    return true;
+}
+
+} // namespace string
+} // namespace detail
+
+/** Returns @c true if the first @a n bytes of @a s are valid UTF-8 as
+    defined by RFC 3629. Overlong encodings, surrogates, code points above
+    U+10FFFF and sequences truncated at the end of the input are rejected.
+
+    The input is processed in blocks of 64 bytes using the lookup algorithm
+    by Keiser and Lemire. Blocks that contain only ASCII bytes are skipped
+    after a single test. On SSE2 and SSE3, which lack byte shuffles, the
+    other blocks are validated one code point at a time.
+*/
+SIMDPP_INL bool utf8_validate(const char* s, std::size_t n)
+{
+    using namespace detail::string;
+    if (n == 0)
+        return true;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(s);
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    return utf8_validate_scalar(p, p + n);
+#else
+    return utf8_validate_lookup(p, p + n);
+#endif
+}
+
+/** Converts the first @a n bytes of UTF-8 at @a src to UTF-32 and returns
+    the number of code points written to @a dst. If the input is not valid
+    UTF-8 as defined by utf8_validate(), @c utf8_error is returned and the
+    contents of @a dst are unspecified.
+
+    @a dst must have space for @a n elements.
+
+    The input is validated first. Then the blocks of 64 bytes that contain
+    only ASCII are widened using vector operations and the other blocks are
+    decoded one code point at a time.
+*/
+SIMDPP_INL std::size_t utf8_to_utf32(const char* src, std::size_t n,
+                                     char32_t* dst)
+{
+    using namespace detail::string;
+    if (!utf8_validate(src, n))
+        return utf8_error;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(src);
+    uint32_t* d = reinterpret_cast<uint32_t*>(dst);
+    return utf8_transcode(p, p + n, d) - d;
+}
+
+/** Converts the first @a n bytes of UTF-8 at @a src to UTF-16 and returns
+    the number of code units written to @a dst. Code points above U+FFFF are
+    written as surrogate pairs. If the input is not valid UTF-8 as defined by
+    utf8_validate(), @c utf8_error is returned and the contents of @a dst are
+    unspecified.
+
+    @a dst must have space for @a n elements.
+
+    The input is processed in the same way as in utf8_to_utf32().
+*/
+SIMDPP_INL std::size_t utf8_to_utf16(const char* src, std::size_t n,
+                                     char16_t* dst)
+{
+    using namespace detail::string;
+    if (!utf8_validate(src, n))
+        return utf8_error;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(src);
+    uint16_t* d = reinterpret_cast<uint16_t*>(dst);
+    return utf8_transcode(p, p + n, d) - d;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -45,6 +45,9 @@ inline Arch this_compile_arch()
 #if SIMDPP_USE_AVX2
     res |= Arch::X86_AVX2;
 #endif
+#if SIMDPP_USE_F16C
+    res |= Arch::X86_F16C;
+#endif
 #if SIMDPP_USE_FMA3
     res |= Arch::X86_FMA3;
 #endif
@@ -66,6 +69,12 @@ inline Arch this_compile_arch()
 #if SIMDPP_USE_AVX512VL
     res |= Arch::X86_AVX512VL;
 #endif
+#if SIMDPP_USE_AVX512VNNI
+    res |= Arch::X86_AVX512VNNI;
+#endif
+#if SIMDPP_USE_AVX512CD
+    res |= Arch::X86_AVX512CD;
+#endif
 #if SIMDPP_USE_NEON
     res |= Arch::ARM_NEON;
 #endif
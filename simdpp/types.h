@@ -40,6 +40,7 @@
 #include <simdpp/types/int64.h>
 #include <simdpp/types/float32.h>
 #include <simdpp/types/float64.h>
+#include <simdpp/types/float16.h>
 #include <simdpp/types/generic.h>
 #include <simdpp/types/empty_expr.h>
 
@@ -0,0 +1,118 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_TYPES_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/types/fwd.h>
+#include <simdpp/types/int16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Class representing a vector of IEEE 754 half-precision floating-point
+    values. The type is intended only for storage: no arithmetic is defined on
+    it. Use @c to_float32() to widen the values for computations and
+    @c to_float16() to narrow them back.
+
+    The values are held as raw 16-bit patterns in an @c uint16 vector of the
+    same length, thus @a N must be a valid length of @c uint16 vectors.
+
+    The vector can be initialized via @c load() or @c load_u() and stored via
+    @c store() or @c store_u().
+*/
+template<unsigned N>
+class float16 {
+public:
+    static const unsigned length = N;
+    static const unsigned length_bytes = N*2;
+    using element_type = uint16_t;
+    using bits_vector_type = uint16<N>;
+
+    SIMDPP_INL float16() = default;
+    SIMDPP_INL float16(const float16&) = default;
+    SIMDPP_INL float16& operator=(const float16&) = default;
+
+    /// Creates the vector from raw bit patterns
+    SIMDPP_INL explicit float16(const uint16<N>& bits) : d_(bits) {}
+
+    template<class E> SIMDPP_INL float16(const expr_vec_construct<E>& e)
+    {
+        d_ = e;
+    }
+    template<class E> SIMDPP_INL float16& operator=(const expr_vec_construct<E>& e)
+    {
+        d_ = e; return *this;
+    }
+
+    /// Returns the raw bit patterns of the values
+    SIMDPP_INL const uint16<N>& bits() const { return d_; }
+    SIMDPP_INL uint16<N>& bits()             { return d_; }
+
+private:
+    uint16<N> d_;
+};
+
+/** Class representing a vector of bfloat16 values, i.e. the upper halves of
+    IEEE 754 single-precision floating-point values. The type is intended only
+    for storage: no arithmetic is defined on it. Use @c to_float32() to widen
+    the values for computations and @c to_bfloat16() to narrow them back.
+
+    The values are held as raw 16-bit patterns in an @c uint16 vector of the
+    same length, thus @a N must be a valid length of @c uint16 vectors.
+
+    The vector can be initialized via @c load() or @c load_u() and stored via
+    @c store() or @c store_u().
+*/
+template<unsigned N>
+class bfloat16 {
+public:
+    static const unsigned length = N;
+    static const unsigned length_bytes = N*2;
+    using element_type = uint16_t;
+    using bits_vector_type = uint16<N>;
+
+    SIMDPP_INL bfloat16() = default;
+    SIMDPP_INL bfloat16(const bfloat16&) = default;
+    SIMDPP_INL bfloat16& operator=(const bfloat16&) = default;
+
+    /// Creates the vector from raw bit patterns
+    SIMDPP_INL explicit bfloat16(const uint16<N>& bits) : d_(bits) {}
+
+    template<class E> SIMDPP_INL bfloat16(const expr_vec_construct<E>& e)
+    {
+        d_ = e;
+    }
+    template<class E> SIMDPP_INL bfloat16& operator=(const expr_vec_construct<E>& e)
+    {
+        d_ = e; return *this;
+    }
+
+    /// Returns the raw bit patterns of the values
+    SIMDPP_INL const uint16<N>& bits() const { return d_; }
+    SIMDPP_INL uint16<N>& bits()             { return d_; }
+
+private:
+    uint16<N> d_;
+};
+
+using float16x8 = float16<8>;
+using float16x16 = float16<16>;
+using float16x32 = float16<32>;
+using bfloat16x8 = bfloat16<8>;
+using bfloat16x16 = bfloat16<16>;
+using bfloat16x32 = bfloat16<32>;
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
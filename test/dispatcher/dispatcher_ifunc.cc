@@ -0,0 +1,38 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// The resolver of an ifunc dispatcher runs before main(), thus the
+// architecture can't be supplied via the command line as in the generic
+// dispatcher test.
+#define SIMDPP_USER_ARCH_INFO ::simdpp::get_arch_gcc_builtin_cpu_supports()
+#include "dispatcher_ifunc.h"
+#include <simdpp/simd.h>
+#include <simdpp/dispatch/get_arch_gcc_builtin_cpu_supports.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+simdpp::Arch test_dispatcher_ifunc_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
+template<class T>
+simdpp::Arch test_dispatcher_ifunc_get_arch_template()
+{
+    return simdpp::this_compile_arch();
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((simdpp::Arch)(test_dispatcher_ifunc_get_arch)())
+
+SIMDPP_MAKE_DISPATCHER((template<class T>) (<T>)
+                       (simdpp::Arch) (test_dispatcher_ifunc_get_arch_template)())
+
+SIMDPP_INSTANTIATE_DISPATCHER(
+    (template simdpp::Arch test_dispatcher_ifunc_get_arch_template<int>())
+)
@@ -0,0 +1,15 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/dispatch/arch.h>
+
+// Non-template dispatcher, resolved by the dynamic loader via ifunc
+simdpp::Arch test_dispatcher_ifunc_get_arch();
+
+// Template dispatcher, always resolved on the first call
+template<class T>
+simdpp::Arch test_dispatcher_ifunc_get_arch_template();
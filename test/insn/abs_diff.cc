@@ -0,0 +1,124 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T>
+std::vector<T> abs_diff_test_values(unsigned count, uint64_t seed)
+{
+    TestRng rng(seed);
+    std::vector<T> r;
+    const T extremes[] = {
+        T(0), T(1), T(-1), std::numeric_limits<T>::min(),
+        std::numeric_limits<T>::max(), T(std::numeric_limits<T>::min() + 1),
+    };
+    for (T v : extremes)
+        r.push_back(v);
+    while (r.size() < count)
+        r.push_back(T(rng.next() >> 7));
+    return r;
+}
+
+template<class V>
+void test_abs_diff_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    using U = typename std::make_unsigned<T>::type;
+    const unsigned N = V::length;
+    const unsigned count = 64;
+
+    // all pairs of the extreme values are tested together with random values
+    std::vector<T> a = abs_diff_test_values<T>(N * count, 1);
+    std::vector<T> b = abs_diff_test_values<T>(N * count, 2);
+    for (unsigned i = 0; i < 36; ++i) {
+        a[i] = a[i / 6];
+        b[i] = b[i % 6];
+    }
+
+    SIMDPP_ALIGN(64) U rdata[N];
+    U expected[N];
+
+    for (unsigned i = 0; i < N * count; i += N) {
+        for (unsigned j = 0; j < N; ++j) {
+            T x = a[i+j], y = b[i+j];
+            expected[j] = x > y ? U(U(x) - U(y)) : U(U(y) - U(x));
+        }
+        V va = load_u(a.data() + i);
+        V vb = load_u(b.data() + i);
+        typename V::uint_vector_type r = abs_diff(va, vb);
+        store(rdata, r);
+        TEST_PUSH(tc, typename V::uint_vector_type, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+template<unsigned B>
+void test_sad_u8_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned count = 64;
+
+    std::vector<uint8_t> a = abs_diff_test_values<uint8_t>(B * count, 3);
+    std::vector<uint8_t> b = abs_diff_test_values<uint8_t>(B * count, 4);
+    for (unsigned i = 0; i < B; ++i) {
+        a[i] = 255; b[i] = 0;
+    }
+
+    SIMDPP_ALIGN(64) uint64_t rdata[B/8];
+    uint64_t expected[B/8];
+
+    for (unsigned i = 0; i < B * count; i += B) {
+        for (unsigned j = 0; j < B/8; ++j) {
+            uint64_t s = 0;
+            for (unsigned k = 0; k < 8; ++k) {
+                uint8_t x = a[i+j*8+k], y = b[i+j*8+k];
+                s += x > y ? x - y : y - x;
+            }
+            expected[j] = s;
+        }
+        uint8<B> va = load_u(a.data() + i);
+        uint8<B> vb = load_u(b.data() + i);
+        uint64<B/8> r = sad_u8(va, vb);
+        store(rdata, r);
+        TEST_PUSH(tc, uint64<B/8>, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, B/8);
+    }
+}
+
+template<unsigned B>
+void test_abs_diff_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_abs_diff_type<uint8<B>>(tc, tr);
+    test_abs_diff_type<int8<B>>(tc, tr);
+    test_abs_diff_type<uint16<B/2>>(tc, tr);
+    test_abs_diff_type<int16<B/2>>(tc, tr);
+    test_abs_diff_type<uint32<B/4>>(tc, tr);
+    test_abs_diff_type<int32<B/4>>(tc, tr);
+    test_abs_diff_type<uint64<B/8>>(tc, tr);
+    test_abs_diff_type<int64<B/8>>(tc, tr);
+    test_sad_u8_n<B>(tc, tr);
+}
+
+void test_abs_diff(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("abs_diff");
+    test_abs_diff_n<16>(tc, tr);
+    test_abs_diff_n<32>(tc, tr);
+    test_abs_diff_n<64>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
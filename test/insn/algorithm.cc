@@ -0,0 +1,238 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The arrays are tested at all offsets within a vector and with lengths that
+    cover the head, the unrolled main loop, the single vector loop and the
+    tail. The values are small integers, thus the floating-point results are
+    exact regardless of the order of operations.
+*/
+template<class T>
+void test_algorithm_type(TestReporter& tr)
+{
+    using namespace simdpp;
+    using V = simdpp::SIMDPP_ARCH_NAMESPACE::detail::algorithm::native_vec_t<T>;
+    const unsigned L = V::length;
+    const unsigned max_size = L * 10 + 3;
+
+    std::vector<T, aligned_allocator<T, 64>> src(max_size + 2*L);
+    std::vector<T, aligned_allocator<T, 64>> dst(max_size + 2*L);
+    for (unsigned i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<T>((i * 7 + 3) % 11);
+    }
+    const T marker = 13;
+
+    for (unsigned off = 0; off < L; ++off) {
+        for (unsigned n = 0; n <= max_size; ++n) {
+            const T* first = src.data() + off;
+            const T* last = first + n;
+            T* out = dst.data() + (off * 3) % L;
+
+            // transform
+            std::fill(dst.begin(), dst.end(), marker);
+            T* r = simdpp::transform(first, last, out,
+                                     [](const V& x) { return add(x, x); });
+            TEST_EQUAL(tr, out + n, r);
+            for (unsigned i = 0; i < n; ++i) {
+                TEST_EQUAL(tr, static_cast<T>(first[i] + first[i]), out[i]);
+            }
+            TEST_EQUAL(tr, marker, out[n]);
+
+            // binary transform
+            simdpp::transform(first, last, first + 1, out,
+                              [](const V& x, const V& y) { return sub(x, y); });
+            for (unsigned i = 0; i < n; ++i) {
+                TEST_EQUAL(tr, static_cast<T>(first[i] - first[i+1]), out[i]);
+            }
+
+            // copy
+            std::fill(dst.begin(), dst.end(), marker);
+            r = simdpp::copy(first, last, out);
+            TEST_EQUAL(tr, out + n, r);
+            TEST_EQUAL_MEMORY(tr, first, out, n);
+            TEST_EQUAL(tr, marker, out[n]);
+
+            // fill
+            simdpp::fill(out, out + n, 5);
+            for (unsigned i = 0; i < n; ++i) {
+                TEST_EQUAL(tr, T(5), out[i]);
+            }
+            TEST_EQUAL(tr, marker, out[n]);
+
+            // reduce
+            T sum = 0, max_value = 0;
+            for (unsigned i = 0; i < n; ++i) {
+                sum += first[i];
+                max_value = std::max(max_value, first[i]);
+            }
+            TEST_EQUAL(tr, sum, simdpp::reduce(first, last, 0,
+                       [](const V& x, const V& y) { return add(x, y); }));
+            TEST_EQUAL(tr, max_value, simdpp::reduce(first, last, 0,
+                       [](const V& x, const V& y) { return max(x, y); }));
+
+            // transform_reduce
+            T sum2 = 0, diff_max = 0;
+            for (unsigned i = 0; i < n; ++i) {
+                sum2 += first[i] + first[i];
+                diff_max = std::max(diff_max, T(first[i] - first[i+2]));
+            }
+            TEST_EQUAL(tr, sum2, simdpp::transform_reduce(first, last, T(0),
+                       [](const V& x, const V& y) { return add(x, y); },
+                       [](const V& x) { return add(x, x); }));
+            TEST_EQUAL(tr, diff_max, simdpp::transform_reduce(first, last,
+                       first + 2, T(0),
+                       [](const V& x, const V& y) { return max(x, y); },
+                       [](const V& x, const V& y) { return sub(x, y); }));
+
+            // count_if
+            std::size_t count = 0;
+            for (unsigned i = 0; i < n; ++i) {
+                count += first[i] > 4 ? 1 : 0;
+            }
+            TEST_EQUAL(tr, count, simdpp::count_if(first, last,
+                       [](const V& x) { return cmp_gt(x, 4); }));
+
+            // find_if
+            for (unsigned value = 8; value <= 11; value += 3) {
+                const T* expected = std::find(first, last, T(value));
+                const T* found = simdpp::find_if(first, last,
+                        [value](const V& x) { return cmp_eq(x, T(value)); });
+                TEST_EQUAL(tr, expected, found);
+            }
+        }
+    }
+}
+
+/*  The non-temporal kernels are tested directly, as the public functions use
+    them only for arrays larger than the last level cache.
+*/
+void test_algorithm_bulk(TestReporter& tr)
+{
+    using namespace simdpp;
+    namespace alg = simdpp::SIMDPP_ARCH_NAMESPACE::detail::algorithm;
+    const unsigned L = alg::bulk_vec::length_bytes;
+    const unsigned max_size = L * 10 + 3;
+
+    std::vector<uint8_t, aligned_allocator<uint8_t, 64>> src(max_size + 2*L);
+    std::vector<uint8_t, aligned_allocator<uint8_t, 64>> dst(max_size + 2*L);
+    std::vector<uint8_t> expected(dst.size());
+    for (unsigned i = 0; i < src.size(); ++i) {
+        src[i] = uint8_t(i * 7 + 3);
+    }
+
+    for (unsigned soff = 0; soff < L; soff += 3) {
+        for (unsigned doff = 0; doff < L; doff += 5) {
+            for (unsigned n = 0; n <= max_size; ++n) {
+                std::fill(dst.begin(), dst.end(), uint8_t(0x55));
+                expected.assign(dst.begin(), dst.end());
+                std::copy(src.begin() + soff, src.begin() + soff + n,
+                          expected.begin() + doff);
+
+                alg::bulk_copy_stream(dst.data() + doff, src.data() + soff, n);
+                TEST_EQUAL_MEMORY(tr, expected.data(), dst.data(), dst.size());
+
+                std::fill(dst.begin(), dst.end(), uint8_t(0x55));
+                simdpp::bulk_copy(dst.data() + doff, src.data() + soff, n);
+                TEST_EQUAL_MEMORY(tr, expected.data(), dst.data(), dst.size());
+
+                if (soff != 0)
+                    continue;
+
+                std::fill(dst.begin(), dst.end(), uint8_t(0x55));
+                expected.assign(dst.begin(), dst.end());
+                std::fill(expected.begin() + doff, expected.begin() + doff + n,
+                          uint8_t(0x3c));
+
+                alg::bulk_fill_stream(dst.data() + doff, 0x3c, n);
+                TEST_EQUAL_MEMORY(tr, expected.data(), dst.data(), dst.size());
+
+                std::fill(dst.begin(), dst.end(), uint8_t(0x55));
+                simdpp::bulk_fill(dst.data() + doff, 0x3c, n);
+                TEST_EQUAL_MEMORY(tr, expected.data(), dst.data(), dst.size());
+            }
+        }
+    }
+}
+
+/*  The matrices are transposed with sizes that cover whole blocks, whole
+    tiles of both widths and the ragged edges. The padding at the end of the
+    destination rows must not be modified. The non-temporal variant is tested
+    directly with aligned destination rows.
+*/
+template<class T>
+void test_algorithm_transpose(TestReporter& tr)
+{
+    using namespace simdpp;
+    namespace alg = simdpp::SIMDPP_ARCH_NAMESPACE::detail::algorithm;
+    using U = typename alg::transpose_vec<sizeof(T), 16>::type::element_type;
+    const std::size_t B = uint32v::length_bytes;
+    const std::size_t sizes[] = { 0, 1, 3, 16 / sizeof(T), 17, 70, 137, 300 };
+
+    for (std::size_t rows : sizes) {
+        for (std::size_t cols : sizes) {
+            std::size_t src_stride = cols + 3;
+            std::size_t dst_stride = (rows + 5 + B) / B * B;
+            std::vector<T> src(rows * src_stride + 1);
+            for (std::size_t i = 0; i < src.size(); ++i) {
+                src[i] = T(i % 251 + 1);
+            }
+            std::vector<T, aligned_allocator<T, 64>> dst(cols * dst_stride + 1);
+            std::vector<T> expected(dst.size(), T(0));
+            for (std::size_t r = 0; r < rows; ++r) {
+                for (std::size_t c = 0; c < cols; ++c) {
+                    expected[c * dst_stride + r] = src[r * src_stride + c];
+                }
+            }
+
+            std::fill(dst.begin(), dst.end(), T(0));
+            simdpp::transpose(src.data(), dst.data(), rows, cols,
+                              src_stride, dst_stride);
+            TEST_EQUAL_MEMORY(tr, expected.data(), dst.data(), dst.size());
+
+            std::fill(dst.begin(), dst.end(), T(0));
+            alg::transpose_blocked<U, true>(
+                    reinterpret_cast<const U*>(src.data()),
+                    reinterpret_cast<U*>(dst.data()),
+                    rows, cols, src_stride, dst_stride);
+            TEST_EQUAL_MEMORY(tr, expected.data(), dst.data(), dst.size());
+        }
+    }
+}
+
+void test_algorithm(TestResults&, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    test_algorithm_type<float>(tr);
+    test_algorithm_type<double>(tr);
+    test_algorithm_type<uint8_t>(tr);
+    test_algorithm_type<int16_t>(tr);
+    test_algorithm_type<int32_t>(tr);
+    test_algorithm_type<uint32_t>(tr);
+
+    // count_if must not overflow the 8-bit lane counters
+    std::vector<uint8_t> ones(100000, 1);
+    std::size_t count = simdpp::count_if(ones,
+            [](const uint8v& x) { return cmp_eq(x, 1); });
+    TEST_EQUAL(tr, ones.size(), count);
+
+    test_algorithm_bulk(tr);
+
+    test_algorithm_transpose<uint8_t>(tr);
+    test_algorithm_transpose<int16_t>(tr);
+    test_algorithm_transpose<float>(tr);
+    test_algorithm_transpose<uint64_t>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,226 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T>
+std::vector<T> bit_manip_test_values(unsigned count, uint64_t seed)
+{
+    TestRng rng(seed);
+    std::vector<T> r;
+    // single set bits at every position and their complements
+    for (unsigned i = 0; i < sizeof(T)*8; ++i) {
+        r.push_back(T(T(1) << i));
+        r.push_back(T(~(T(1) << i)));
+    }
+    r.push_back(T(0));
+    r.push_back(T(~T(0)));
+    while (r.size() < count) {
+        uint64_t x = rng.next();
+        // sparse values so that all counts of leading and trailing zeros
+        // are likely
+        T v = T(x >> 7);
+        v >>= (x >> 2) % (sizeof(T)*8);
+        v <<= (x >> 13) % (sizeof(T)*8);
+        r.push_back(v);
+    }
+    return r;
+}
+
+template<class T> unsigned ref_lzcnt(T x)
+{
+    unsigned n = sizeof(T)*8;
+    for (; x != 0; x >>= 1)
+        n--;
+    return n;
+}
+
+template<class T> unsigned ref_tzcnt(T x)
+{
+    unsigned n = 0;
+    for (; n < sizeof(T)*8 && ((x >> n) & 1) == 0; n++) {}
+    return n;
+}
+
+template<class T> T ref_bit_reverse(T x)
+{
+    T r = 0;
+    for (unsigned i = 0; i < sizeof(T)*8; ++i)
+        r |= T(((x >> i) & 1) << (sizeof(T)*8 - 1 - i));
+    return r;
+}
+
+template<class T> T ref_byte_swap(T x)
+{
+    T r = 0;
+    for (unsigned i = 0; i < sizeof(T); ++i)
+        r |= T(((x >> (i*8)) & 0xff) << ((sizeof(T) - 1 - i)*8));
+    return r;
+}
+
+template<class T> T ref_rotl(T x, unsigned c)
+{
+    const unsigned bits = sizeof(T)*8;
+    c %= bits;
+    if (c == 0)
+        return x;
+    return T((x << c) | (x >> (bits - c)));
+}
+
+struct BitManipLzcnt {
+    template<class V> static V run(const V& a) { return simdpp::lzcnt(a); }
+    template<class T> static T ref(T x) { return T(ref_lzcnt(x)); }
+};
+
+struct BitManipTzcnt {
+    template<class V> static V run(const V& a) { return simdpp::tzcnt(a); }
+    template<class T> static T ref(T x) { return T(ref_tzcnt(x)); }
+};
+
+struct BitManipBitReverse {
+    template<class V> static V run(const V& a) { return simdpp::bit_reverse(a); }
+    template<class T> static T ref(T x) { return ref_bit_reverse(x); }
+};
+
+struct BitManipByteSwap {
+    template<class V> static V run(const V& a) { return simdpp::byte_swap(a); }
+    template<class T> static T ref(T x) { return ref_byte_swap(x); }
+};
+
+template<unsigned C>
+struct BitManipRotl {
+    template<class V> static V run(const V& a) { return simdpp::rotl<C>(a); }
+    template<class T> static T ref(T x) { return ref_rotl(x, C); }
+};
+
+template<unsigned C>
+struct BitManipRotr {
+    template<class V> static V run(const V& a) { return simdpp::rotr<C>(a); }
+    template<class T> static T ref(T x) { return ref_rotl(x, sizeof(T)*8 - C); }
+};
+
+template<class V, class Op>
+void test_bit_manip_unary(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+    const unsigned count = 32;
+
+    std::vector<T> a = bit_manip_test_values<T>(N * count, 1);
+    a.resize(a.size() + N - a.size() % N, T(0));
+
+    SIMDPP_ALIGN(64) T rdata[N];
+    T expected[N];
+
+    for (unsigned i = 0; i < a.size(); i += N) {
+        for (unsigned j = 0; j < N; ++j)
+            expected[j] = Op::ref(a[i+j]);
+        V va = load_u(a.data() + i);
+        V r = Op::run(va);
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+template<class V, bool Right>
+void test_bit_manip_rotate_v(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+    const unsigned bits = sizeof(T)*8;
+    const unsigned count = 32;
+
+    std::vector<T> a = bit_manip_test_values<T>(N * count, 2);
+    a.resize(a.size() + N - a.size() % N, T(0));
+    std::vector<T> c(a.size());
+    // all counts up to twice the element width
+    for (unsigned i = 0; i < c.size(); ++i)
+        c[i] = T(i % (bits * 2));
+
+    SIMDPP_ALIGN(64) T rdata[N];
+    T expected[N];
+
+    for (unsigned i = 0; i < a.size(); i += N) {
+        for (unsigned j = 0; j < N; ++j) {
+            unsigned cj = c[i+j] % bits;
+            expected[j] = ref_rotl(a[i+j], Right ? bits - cj : cj);
+        }
+        V va = load_u(a.data() + i);
+        V vc = load_u(c.data() + i);
+        V r = Right ? V(rotr(va, vc)) : V(rotl(va, vc));
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+template<class V>
+void test_bit_manip_type(TestResultsSet& tc, TestReporter& tr)
+{
+    const unsigned bits = V::num_bits;
+    test_bit_manip_unary<V, BitManipLzcnt>(tc, tr);
+    test_bit_manip_unary<V, BitManipTzcnt>(tc, tr);
+    test_bit_manip_unary<V, BitManipBitReverse>(tc, tr);
+    test_bit_manip_unary<V, BitManipRotl<0>>(tc, tr);
+    test_bit_manip_unary<V, BitManipRotl<1>>(tc, tr);
+    test_bit_manip_unary<V, BitManipRotl<3>>(tc, tr);
+    test_bit_manip_unary<V, BitManipRotl<bits - 1>>(tc, tr);
+    test_bit_manip_unary<V, BitManipRotr<0>>(tc, tr);
+    test_bit_manip_unary<V, BitManipRotr<1>>(tc, tr);
+    test_bit_manip_unary<V, BitManipRotr<5>>(tc, tr);
+    test_bit_manip_unary<V, BitManipRotr<bits - 1>>(tc, tr);
+}
+
+template<unsigned B>
+void test_bit_manip_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_bit_manip_type<uint8<B>>(tc, tr);
+    test_bit_manip_type<uint16<B/2>>(tc, tr);
+    test_bit_manip_type<uint32<B/4>>(tc, tr);
+    test_bit_manip_type<uint64<B/8>>(tc, tr);
+
+    test_bit_manip_unary<uint16<B/2>, BitManipByteSwap>(tc, tr);
+    test_bit_manip_unary<uint32<B/4>, BitManipByteSwap>(tc, tr);
+    test_bit_manip_unary<uint64<B/8>, BitManipByteSwap>(tc, tr);
+
+#if SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR
+    test_bit_manip_rotate_v<uint8<B>, false>(tc, tr);
+    test_bit_manip_rotate_v<uint8<B>, true>(tc, tr);
+#endif
+#if SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR
+    test_bit_manip_rotate_v<uint16<B/2>, false>(tc, tr);
+    test_bit_manip_rotate_v<uint16<B/2>, true>(tc, tr);
+#endif
+#if SIMDPP_HAS_UINT32_ROTATE_BY_VECTOR
+    test_bit_manip_rotate_v<uint32<B/4>, false>(tc, tr);
+    test_bit_manip_rotate_v<uint32<B/4>, true>(tc, tr);
+#endif
+#if SIMDPP_HAS_UINT64_ROTATE_BY_VECTOR
+    test_bit_manip_rotate_v<uint64<B/8>, false>(tc, tr);
+    test_bit_manip_rotate_v<uint64<B/8>, true>(tc, tr);
+#endif
+}
+
+void test_bit_manip(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("bit_manip");
+    test_bit_manip_n<16>(tc, tr);
+    test_bit_manip_n<32>(tc, tr);
+    test_bit_manip_n<64>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,185 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Classifies the JSON text byte by byte. The string is padded to whole blocks
+static std::vector<simdpp::json_block> ref_json_classify(const std::string& s)
+{
+    std::vector<simdpp::json_block> r(s.size() / 64);
+    bool in_string = false;
+    bool escaped = false;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        simdpp::json_block& b = r[i / 64];
+        if (i % 64 == 0)
+            std::memset(&b, 0, sizeof(b));
+        uint64_t bit = uint64_t(1) << (i % 64);
+        char c = s[i];
+        if (escaped) {
+            b.escaped |= bit;
+            escaped = false;
+        } else if (c == '\\') {
+            escaped = true;
+        } else if (c == '"') {
+            b.quote |= bit;
+            in_string = !in_string;
+        }
+        if (in_string) {
+            b.in_string |= bit;
+        } else if (std::strchr(",:[]{}", c) != nullptr && c != 0) {
+            b.structural |= bit;
+        } else if (std::strchr(" \t\n\r", c) != nullptr && c != 0) {
+            b.whitespace |= bit;
+        }
+    }
+    return r;
+}
+
+static std::vector<std::size_t> ref_csv_split(const std::string& s, char delim,
+                                              char quote, char escape)
+{
+    std::vector<std::size_t> r;
+    bool in_quotes = false;
+    bool escaped = false;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        char c = s[i];
+        if (escaped) {
+            escaped = false;
+        } else if (escape != 0 && c == escape) {
+            escaped = true;
+        } else if (c == quote) {
+            in_quotes = !in_quotes;
+        } else if (!in_quotes && (c == delim || c == '\n')) {
+            r.push_back(i);
+        }
+    }
+    return r;
+}
+
+static void check_json(TestReporter& tr, std::string s)
+{
+    s.resize((s.size() + 63) / 64 * 64, ' ');
+    std::vector<simdpp::json_block> ref = ref_json_classify(s);
+    simdpp::json_classifier cl;
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        simdpp::json_block b = cl.classify(s.data() + i * 64);
+        TEST_EQUAL(tr, ref[i].quote, b.quote);
+        TEST_EQUAL(tr, ref[i].in_string, b.in_string);
+        TEST_EQUAL(tr, ref[i].escaped, b.escaped);
+        TEST_EQUAL(tr, ref[i].structural, b.structural);
+        TEST_EQUAL(tr, ref[i].whitespace, b.whitespace);
+    }
+}
+
+static void check_csv(TestReporter& tr, const std::string& s,
+                      char delim, char quote, char escape)
+{
+    std::vector<std::size_t> ref = ref_csv_split(s, delim, quote, escape);
+    std::vector<std::size_t> out(s.size() + 1, ~std::size_t(0));
+    std::size_t n = simdpp::csv_split(s.data(), s.size(), out.data(),
+                                      delim, quote, escape);
+    TEST_EQUAL(tr, ref.size(), n);
+    if (n == ref.size() && n > 0)
+        TEST_EQUAL_MEMORY(tr, ref.data(), out.data(), n);
+    TEST_EQUAL(tr, ~std::size_t(0), out[n]);
+}
+
+static std::string random_string(TestRng& rng, std::size_t size,
+                                 const char* chars)
+{
+    std::size_t count = std::strlen(chars);
+    std::string s(size, ' ');
+    for (auto& c : s)
+        c = chars[(rng.next() >> 32) % count];
+    return s;
+}
+
+void test_classify(TestResults&, TestReporter& tr)
+{
+    using namespace simdpp;
+    TestRng rng(5);
+
+    for (unsigned i = 0; i < 1000; ++i) {
+        uint64_t x = rng.next();
+        uint64_t ref = 0;
+        uint64_t acc = 0;
+        for (unsigned j = 0; j < 64; ++j) {
+            acc ^= (x >> j) & 1;
+            ref |= acc << j;
+        }
+        TEST_EQUAL(tr, ref, prefix_xor(x));
+    }
+
+    // byte sets with bytes from both halves of the range
+    {
+        const char set[] = "a,\x80\xff\x0f";
+        byte_classifier cl(set, sizeof(set) - 1);
+        std::string s = random_string(rng, 64, "ab,;\x80\x81\xff\x0f\x1f");
+        uint64_t ref = 0;
+        for (unsigned i = 0; i < 64; ++i) {
+            if (std::memchr(set, s[i], sizeof(set) - 1) != nullptr)
+                ref |= uint64_t(1) << i;
+        }
+        TEST_EQUAL(tr, ref, cl.match(s.data()));
+        byte_classifier empty(set, 0);
+        TEST_EQUAL(tr, uint64_t(0), empty.match(s.data()));
+    }
+
+    // dense quotes, backslashes and structural characters
+    for (unsigned i = 0; i < 300; ++i) {
+        check_json(tr, random_string(rng, 64 * 4, "\"\\\\\\,:[]{} \t\nab"));
+    }
+
+    /*  Runs of backslashes before a quote that end at every position around
+        the block boundaries, thus the escape state is carried over both
+        within the run and between the last backslash and the quote.
+    */
+    for (unsigned len = 1; len <= 6; ++len) {
+        for (std::size_t end = 50; end < 140; ++end) {
+            if (end < len + 1)
+                continue;
+            std::string s(end - len, 'a');
+            s[0] = '"';
+            s += std::string(len, '\\');
+            s += "\",{\"k\":[1]}";
+            check_json(tr, s);
+            check_json(tr, "\"x\"" + s.substr(3));
+        }
+    }
+
+    // strings spanning several blocks
+    check_json(tr, "{\"a\":\"" + std::string(200, ',') + "\",\"b\":[1, 2]}");
+
+    for (unsigned i = 0; i < 300; ++i) {
+        std::string s = random_string(rng, i, "\",\n\\ab;");
+        check_csv(tr, s, ',', '"', 0);
+        check_csv(tr, s, ',', '"', '\\');
+        check_csv(tr, s, ';', '\'', '\\');
+    }
+
+    // quotes doubled as in RFC 4180 and escaped quotes across the boundaries
+    for (std::size_t pos = 50; pos < 140; ++pos) {
+        std::string s(pos, 'a');
+        s[pos / 2] = ',';
+        check_csv(tr, s + "\"x,\"\"y\"\",z\",1\n2,3", ',', '"', 0);
+        for (unsigned len = 1; len <= 4; ++len) {
+            std::string t = s + std::string(len, '\\') + "\",\"a,b\"\n";
+            check_csv(tr, t, ',', '"', '\\');
+            check_csv(tr, "\"" + t, ',', '"', '\\');
+        }
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,166 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+static std::string ref_base64_encode(const std::vector<uint8_t>& data)
+{
+    const char* chars =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string r;
+    uint32_t acc = 0;
+    unsigned bits = 0;
+    for (uint8_t b : data) {
+        acc = acc << 8 | b;
+        bits += 8;
+        while (bits >= 6) {
+            bits -= 6;
+            r += chars[(acc >> bits) & 0x3f];
+        }
+    }
+    if (bits > 0)
+        r += chars[(acc << (6 - bits)) & 0x3f];
+    while (r.size() % 4 != 0)
+        r += '=';
+    return r;
+}
+
+static std::string ref_hex_encode(const std::vector<uint8_t>& data)
+{
+    const char* digits = "0123456789abcdef";
+    std::string r;
+    for (uint8_t b : data) {
+        r += digits[b >> 4];
+        r += digits[b & 0x0f];
+    }
+    return r;
+}
+
+static void test_base64(TestReporter& tr, TestRng& rng)
+{
+    using namespace simdpp;
+    const char bad_chars[] = "=-_ \n.:@[`{*,\x80\xff";
+
+    for (std::size_t n = 0; n < 300; ++n) {
+        std::vector<uint8_t> data(n);
+        for (auto& b : data)
+            b = uint8_t(rng.next() >> 56);
+        std::string ref = ref_base64_encode(data);
+
+        // encoding; the output is followed by a canary
+        std::string enc(base64_encoded_size(n) + 1, '#');
+        TEST_EQUAL(tr, ref.size(), base64_encode(data.data(), n, &enc[0]));
+        TEST_EQUAL(tr, '#', enc.back());
+        enc.pop_back();
+        TEST_EQUAL(tr, true, ref == enc);
+
+        // decoding
+        std::vector<uint8_t> dec(base64_decoded_size(ref.size()) + 1, 0xcc);
+        TEST_EQUAL(tr, n, base64_decode(ref.data(), ref.size(), dec.data()));
+        TEST_EQUAL_MEMORY(tr, data.data(), dec.data(), n);
+        TEST_EQUAL(tr, true, base64_validate(ref.data(), ref.size()));
+
+        // an invalid character at each position
+        if (n % 7 == 0) {
+            for (std::size_t pos = 0; pos < ref.size(); ++pos) {
+                for (const char* c = bad_chars; *c; ++c) {
+                    // padding in the last two positions may be valid
+                    if (*c == '=' && pos + 2 >= ref.size())
+                        continue;
+                    std::string s = ref;
+                    s[pos] = *c;
+                    TEST_EQUAL(tr, base64_error,
+                               base64_decode(s.data(), s.size(), dec.data()));
+                    TEST_EQUAL(tr, false, base64_validate(s.data(), s.size()));
+                }
+            }
+        }
+
+        // lengths that are not a multiple of 4
+        for (std::size_t len = 1; len < 4 && len <= ref.size(); ++len) {
+            TEST_EQUAL(tr, base64_error,
+                       base64_decode(ref.data(), ref.size() - len, dec.data()));
+            TEST_EQUAL(tr, false, base64_validate(ref.data(), ref.size() - len));
+        }
+    }
+
+    // malformed padding and nonzero unused bits
+    const char* bad[] = { "QR==", "QUF=", "Q===", "====", "QQ=A", "QQ==QUFB",
+                          "QUE=QUFB", "=QUF", "QU=F" };
+    for (const char* s : bad) {
+        uint8_t buf[8];
+        std::size_t len = std::string(s).size();
+        TEST_EQUAL(tr, base64_error, base64_decode(s, len, buf));
+        TEST_EQUAL(tr, false, base64_validate(s, len));
+    }
+}
+
+static void test_hex(TestReporter& tr, TestRng& rng)
+{
+    using namespace simdpp;
+    const char bad_chars[] = "gG/:@`x \x80\xff";
+
+    for (std::size_t n = 0; n < 200; ++n) {
+        std::vector<uint8_t> data(n);
+        for (auto& b : data)
+            b = uint8_t(rng.next() >> 56);
+        std::string ref = ref_hex_encode(data);
+
+        std::string enc(2 * n + 1, '#');
+        TEST_EQUAL(tr, 2 * n, hex_encode(data.data(), n, &enc[0]));
+        TEST_EQUAL(tr, '#', enc.back());
+        enc.pop_back();
+        TEST_EQUAL(tr, true, ref == enc);
+
+        std::vector<uint8_t> dec(n + 1, 0xcc);
+        TEST_EQUAL(tr, n, hex_decode(ref.data(), ref.size(), dec.data()));
+        TEST_EQUAL_MEMORY(tr, data.data(), dec.data(), n);
+        TEST_EQUAL(tr, true, hex_validate(ref.data(), ref.size()));
+
+        // upper case digits are accepted
+        std::string upper = ref;
+        for (auto& c : upper) {
+            if (c >= 'a')
+                c = char(c - 'a' + 'A');
+        }
+        TEST_EQUAL(tr, n, hex_decode(upper.data(), upper.size(), dec.data()));
+        TEST_EQUAL_MEMORY(tr, data.data(), dec.data(), n);
+
+        if (n % 5 == 0) {
+            for (std::size_t pos = 0; pos < ref.size(); ++pos) {
+                for (const char* c = bad_chars; *c; ++c) {
+                    std::string s = ref;
+                    s[pos] = *c;
+                    TEST_EQUAL(tr, hex_error,
+                               hex_decode(s.data(), s.size(), dec.data()));
+                    TEST_EQUAL(tr, false, hex_validate(s.data(), s.size()));
+                }
+            }
+        }
+        if (n > 0) {
+            TEST_EQUAL(tr, hex_error,
+                       hex_decode(ref.data(), ref.size() - 1, dec.data()));
+            TEST_EQUAL(tr, false, hex_validate(ref.data(), ref.size() - 1));
+        }
+    }
+}
+
+void test_codec(TestResults&, TestReporter& tr)
+{
+    TestRng rng(7);
+    test_base64(tr, rng);
+    test_hex(tr, rng);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -105,6 +105,31 @@ void test_compare_n(TestResultsSet& tc)
     }
 #endif
 
+    // 64-bit equality is available everywhere. The elements differ only in
+    // one of the 32-bit halves, which catches implementations that combine
+    // the results of 32-bit comparisons incorrectly.
+    {
+        using uint64_e = uint64<B/8>;
+        using int64_e = int64<B/8>;
+
+        TestData<uint64_e> sl;
+        sl.add(make_uint(0x1111111122222222, 0x1111111122222222,
+                         0x1111111122222222, 0x1111111122222222));
+        sl.add(make_uint(0x0000000000000000, 0xffffffffffffffff,
+                         0x0000000100000000, 0xffffffff00000000));
+
+        TestData<uint64_e> sr;
+        sr.add(make_uint(0x1111111122222222, 0x1111111122222223,
+                         0x1111111222222222, 0x0111111122222222));
+        sr.add(make_uint(0x0000000000000001, 0xfffffffeffffffff,
+                         0x0000000100000000, 0xffffffff80000000));
+
+        TEST_PUSH_ARRAY_OP2(tc, uint64_e, cmp_eq, sl, sr);
+        TEST_PUSH_ARRAY_OP2(tc, uint64_e, cmp_neq, sl, sr);
+        TEST_PUSH_ARRAY_OP2(tc, int64_e, cmp_eq, sl, sr);
+        TEST_PUSH_ARRAY_OP2(tc, int64_e, cmp_neq, sl, sr);
+    }
+
     float nanf = std::numeric_limits<float>::quiet_NaN();
     double nan = std::numeric_limits<double>::quiet_NaN();
     float inff = std::numeric_limits<float>::infinity();
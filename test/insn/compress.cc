@@ -0,0 +1,107 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../common/vectors.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void test_compress_type(TestResultsSet& tc, TestReporter& tr,
+                        const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) E adata[N];
+    SIMDPP_ALIGN(64) E mdata[N];
+    SIMDPP_ALIGN(64) E rdata[N];
+    E pdata[N+1];
+    E expected[N];
+    E sentinel[N+1];
+
+    std::memcpy(adata, sdata, sizeof(adata));
+    std::memset(sentinel, 0xcc, sizeof(sentinel));
+    V a = load(adata);
+
+    // all mask patterns are tested for vectors with up to 8 elements
+    unsigned num_tests = N <= 8 ? (1 << N) : 256;
+    uint32_t seed = 0x12345678;
+
+    for (unsigned t = 0; t < num_tests; ++t) {
+        uint32_t bits = t;
+        if (N > 8) {
+            seed = seed * 1103515245 + 12345;
+            bits = (seed >> 8) ^ t;
+        }
+        unsigned count = 0;
+        for (unsigned i = 0; i < N; ++i) {
+            mdata[i] = (bits >> i) & 1;
+            count += (bits >> i) & 1;
+        }
+        V mv = load(mdata);
+        typename V::mask_vector_type mask = bit_not(cmp_eq(mv, 0));
+
+        // compress
+        std::memset(expected, 0, sizeof(expected));
+        for (unsigned i = 0, j = 0; i < N; ++i) {
+            if (mdata[i])
+                expected[j++] = adata[i];
+        }
+        V r = compress(mask, a);
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+
+        // compress_store_u writes exactly count elements
+        std::memcpy(pdata, sentinel, sizeof(pdata));
+        unsigned n = compress_store_u(pdata + 1, mask, a);
+        TEST_EQUAL(tr, count, n);
+        TEST_EQUAL_MEMORY(tr, sentinel, pdata, 1);
+        TEST_EQUAL_MEMORY(tr, expected, pdata + 1, count);
+        TEST_EQUAL_MEMORY(tr, sentinel, pdata + 1 + count, N - count);
+
+        // expand
+        std::memset(expected, 0, sizeof(expected));
+        for (unsigned i = 0, j = 0; i < N; ++i) {
+            if (mdata[i])
+                expected[i] = adata[j++];
+        }
+        r = expand(mask, a);
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+template<unsigned B>
+void test_compress_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    Vectors<B,1> v;
+
+    test_compress_type<uint32<B/4>>(tc, tr, v.pu32);
+    test_compress_type<int32<B/4>>(tc, tr, v.pi32);
+    test_compress_type<float32<B/4>>(tc, tr, v.pf32);
+    test_compress_type<uint64<B/8>>(tc, tr, v.pu64);
+    test_compress_type<int64<B/8>>(tc, tr, v.pi64);
+    test_compress_type<float64<B/8>>(tc, tr, v.pf64);
+}
+
+void test_compress(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("compress");
+    test_compress_n<16>(tc, tr);
+    test_compress_n<32>(tc, tr);
+    test_compress_n<64>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,115 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Returns n / d. The result of dividing the minimum value by -1 wraps around
+template<class T>
+T divider_ref(T n, T d)
+{
+    using U = typename std::make_unsigned<T>::type;
+    if (std::is_signed<T>::value && d == T(-1))
+        return T(U(U(0) - U(n)));
+    return T(n / d);
+}
+
+template<class T>
+std::vector<T> divider_test_values()
+{
+    using U = typename std::make_unsigned<T>::type;
+    const unsigned B = sizeof(T) * 8;
+    std::vector<T> r;
+
+    for (unsigned i = 0; i < 20; ++i) {
+        r.push_back(T(i));
+        r.push_back(T(U(0) - U(i)));
+    }
+    for (unsigned i = 2; i < B; ++i) {
+        U p = U(U(1) << i);
+        r.push_back(T(p));
+        r.push_back(T(U(p - 1)));
+        r.push_back(T(U(p + 1)));
+        r.push_back(T(U(U(0) - p)));
+        r.push_back(T(U(U(0) - p + 1)));
+    }
+    r.push_back(std::numeric_limits<T>::min());
+    r.push_back(std::numeric_limits<T>::max());
+    r.push_back(T(std::numeric_limits<T>::min() + 1));
+    r.push_back(T(std::numeric_limits<T>::max() - 1));
+
+    TestRng rng(0x9e3779b97f4a7c15);
+    for (unsigned i = 0; i < 64; ++i) {
+        uint64_t x = rng.next();
+        r.push_back(T(x >> (i % 3 == 0 ? 64 - B : 17)));
+    }
+    return r;
+}
+
+template<class V>
+void test_divider_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+
+    std::vector<T> values = divider_test_values<T>();
+    std::vector<T> nums = values;
+    while (nums.size() % N != 0)
+        nums.push_back(T(nums.size()));
+
+    SIMDPP_ALIGN(64) T rdata[N];
+    T expected[N];
+
+    for (T dv : values) {
+        if (dv == 0)
+            continue;
+        divider<T> d(dv);
+
+        for (unsigned i = 0; i < nums.size(); i += N) {
+            for (unsigned j = 0; j < N; ++j)
+                expected[j] = divider_ref<T>(nums[i+j], dv);
+
+            V a = load_u(nums.data() + i);
+            V r = div(a, d);
+            store(rdata, r);
+            TEST_PUSH(tc, V, r);
+            TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+        }
+    }
+}
+
+template<unsigned B>
+void test_divider_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_divider_type<uint8<B>>(tc, tr);
+    test_divider_type<int8<B>>(tc, tr);
+    test_divider_type<uint16<B/2>>(tc, tr);
+    test_divider_type<int16<B/2>>(tc, tr);
+    test_divider_type<uint32<B/4>>(tc, tr);
+    test_divider_type<int32<B/4>>(tc, tr);
+    test_divider_type<uint64<B/8>>(tc, tr);
+    test_divider_type<int64<B/8>>(tc, tr);
+}
+
+void test_divider(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("divider");
+    test_divider_n<16>(tc, tr);
+    test_divider_n<32>(tc, tr);
+    test_divider_n<64>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,99 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class T>
+std::vector<T> dot_acc_test_values(unsigned count, uint64_t seed)
+{
+    TestRng rng(seed);
+    std::vector<T> r;
+    const T extremes[] = { T(0), T(1), T(-1), T(0x7fffffff), T(0x80000000) };
+    for (T v : extremes)
+        r.push_back(v);
+    while (r.size() < count)
+        r.push_back(T(rng.next() >> 33));
+    return r;
+}
+
+template<unsigned N>
+void test_dot_acc_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned count = 64;
+
+    std::vector<int32_t> accs = dot_acc_test_values<int32_t>(N * count, 1);
+    std::vector<int16_t> a16 = dot_acc_test_values<int16_t>(N * 2 * count, 2);
+    std::vector<int16_t> b16 = dot_acc_test_values<int16_t>(N * 2 * count, 3);
+    std::vector<uint8_t> a8 = dot_acc_test_values<uint8_t>(N * 4 * count, 4);
+    std::vector<int8_t> b8 = dot_acc_test_values<int8_t>(N * 4 * count, 5);
+
+    // extreme products that overflow 16-bit and 32-bit intermediate sums
+    for (unsigned i = 0; i < N * 2; ++i) {
+        a16[i] = -32768; b16[i] = -32768;
+    }
+    for (unsigned i = 0; i < N * 4; ++i) {
+        a8[i] = 255; b8[i] = i % 8 < 4 ? 127 : -128;
+    }
+
+    SIMDPP_ALIGN(64) int32_t rdata[N];
+    int32_t expected[N];
+
+    for (unsigned i = 0; i < count; ++i) {
+        const int32_t* pacc = accs.data() + i * N;
+        const int16_t* pa16 = a16.data() + i * N * 2;
+        const int16_t* pb16 = b16.data() + i * N * 2;
+        const uint8_t* pa8 = a8.data() + i * N * 4;
+        const int8_t* pb8 = b8.data() + i * N * 4;
+
+        int32<N> acc = load_u(pacc);
+        int32<N> r;
+
+        for (unsigned j = 0; j < N; ++j) {
+            uint32_t s = pacc[j];
+            s += uint32_t(int32_t(pa16[j*2]) * pb16[j*2]);
+            s += uint32_t(int32_t(pa16[j*2+1]) * pb16[j*2+1]);
+            expected[j] = int32_t(s);
+        }
+        int16<N*2> va16 = load_u(pa16);
+        int16<N*2> vb16 = load_u(pb16);
+        r = dot_acc_i16(acc, va16, vb16);
+        store(rdata, r);
+        TEST_PUSH(tc, int32<N>, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+
+        for (unsigned j = 0; j < N; ++j) {
+            uint32_t s = pacc[j];
+            for (unsigned k = 0; k < 4; ++k)
+                s += uint32_t(int32_t(pa8[j*4+k]) * pb8[j*4+k]);
+            expected[j] = int32_t(s);
+        }
+        uint8<N*4> va8 = load_u(pa8);
+        int8<N*4> vb8 = load_u(pb8);
+        r = dot_acc_u8s8(acc, va8, vb8);
+        store(rdata, r);
+        TEST_PUSH(tc, int32<N>, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+void test_dot_acc(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("dot_acc");
+    test_dot_acc_n<4>(tc, tr);
+    test_dot_acc_n<8>(tc, tr);
+    test_dot_acc_n<16>(tc, tr);
+    test_dot_acc_n<32>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
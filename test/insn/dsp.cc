@@ -0,0 +1,188 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The floating-point tests use small integers, thus the results are exact
+    and do not depend on the order of the additions or on whether fused
+    multiply-add is used.
+*/
+static float ref_fir_acc(const float* x, const float* h, std::size_t taps)
+{
+    float r = 0;
+    for (std::size_t j = 0; j < taps; ++j)
+        r += h[j] * x[taps - 1 - j];
+    return r;
+}
+
+static int16_t ref_fir_acc(const int16_t* x, const int16_t* h, std::size_t taps)
+{
+    int64_t r = 0;
+    for (std::size_t j = 0; j < taps; ++j)
+        r += int64_t(h[j]) * x[taps - 1 - j];
+    r = (r + (1 << 14)) >> 15;
+    return int16_t(r < -32768 ? -32768 : r > 32767 ? 32767 : r);
+}
+
+static void gen_data(TestRng& rng, std::vector<float>& v, int range)
+{
+    for (auto& x : v)
+        x = float(int((rng.next() >> 32) % (2 * range + 1)) - range);
+}
+
+static void gen_data(TestRng& rng, std::vector<int16_t>& v, int)
+{
+    for (auto& x : v)
+        x = int16_t(rng.next() >> 48);
+}
+
+// Generates Q15 coefficients whose absolute values sum to at most 1.0
+static void gen_coefs(TestRng& rng, std::vector<int16_t>& h)
+{
+    int32_t limit = 32768 / int32_t(h.size());
+    for (auto& x : h)
+        x = int16_t(int32_t((rng.next() >> 32) % (2 * limit + 1)) - limit);
+}
+
+static void gen_coefs(TestRng& rng, std::vector<float>& h)
+{
+    gen_data(rng, h, 4);
+}
+
+template<class T>
+void test_fir_type(TestReporter& tr, TestRng& rng)
+{
+    using namespace simdpp;
+    const std::size_t taps_list[] = { 1, 2, 3, 5, 8, 16, 17, 31, 64, 128 };
+    const std::size_t factors[] = { 1, 2, 3, 4, 7 };
+    const T canary = T(77);
+
+    for (std::size_t taps : taps_list) {
+        std::vector<T> h(taps);
+        gen_coefs(rng, h);
+        const std::size_t lengths[] = { taps - 1, taps, taps + 1, taps + 13,
+                                        taps + 70, taps + 300 };
+        for (std::size_t n : lengths) {
+            std::vector<T> x(n);
+            gen_data(rng, x, 8);
+
+            std::size_t count = n < taps ? 0 : n - taps + 1;
+            std::vector<T> ref(count + 1, canary), y(count + 1, canary);
+            for (std::size_t i = 0; i < count; ++i)
+                ref[i] = ref_fir_acc(x.data() + i, h.data(), taps);
+            TEST_EQUAL(tr, count, fir(x.data(), n, h.data(), taps, y.data()));
+            TEST_EQUAL_MEMORY(tr, ref.data(), y.data(), count + 1);
+
+            for (std::size_t f : factors) {
+                std::size_t dcount = n < taps ? 0 : (n - taps) / f + 1;
+                std::vector<T> dref(dcount + 1, canary), dy(dcount + 1, canary);
+                for (std::size_t i = 0; i < dcount; ++i)
+                    dref[i] = ref_fir_acc(x.data() + i * f, h.data(), taps);
+                TEST_EQUAL(tr, dcount, fir_decimate(x.data(), n, h.data(), taps,
+                                                    f, dy.data()));
+                TEST_EQUAL_MEMORY(tr, dref.data(), dy.data(), dcount + 1);
+            }
+        }
+    }
+    // decimation by a factor larger than the number of taps
+    std::vector<T> x(100), h(3);
+    gen_data(rng, x, 8);
+    gen_coefs(rng, h);
+    std::vector<T> dref(10, canary), dy(10, canary);
+    for (std::size_t i = 0; i < 9; ++i)
+        dref[i] = ref_fir_acc(x.data() + i * 11, h.data(), 3);
+    TEST_EQUAL(tr, std::size_t(9), fir_decimate(x.data(), 100, h.data(), 3, 11,
+                                                dy.data()));
+    TEST_EQUAL_MEMORY(tr, dref.data(), dy.data(), 10);
+}
+
+static void test_fir_saturation(TestReporter& tr)
+{
+    using namespace simdpp;
+    // -1.0 * -1.0 rounds to 1.0, which is saturated
+    std::vector<int16_t> x(100, -32768), y(100), ref(100);
+    const int16_t h1[] = { -32768 };
+    const int16_t h2[] = { -16384, -16384, 0 };
+    for (std::size_t i = 0; i < 100; ++i)
+        ref[i] = 32767;
+    TEST_EQUAL(tr, std::size_t(100), fir(x.data(), 100, h1, 1, y.data()));
+    TEST_EQUAL_MEMORY(tr, ref.data(), y.data(), 100);
+    TEST_EQUAL(tr, std::size_t(98), fir(x.data(), 100, h2, 3, y.data()));
+    TEST_EQUAL_MEMORY(tr, ref.data(), y.data(), 98);
+
+    // rounding to nearest
+    const int16_t h3[] = { 16384 };
+    for (std::size_t i = 0; i < 100; ++i) {
+        x[i] = int16_t(int(i) - 50);
+        ref[i] = int16_t((int(i) - 50 + 1) >> 1);
+    }
+    TEST_EQUAL(tr, std::size_t(100), fir(x.data(), 100, h3, 1, y.data()));
+    TEST_EQUAL_MEMORY(tr, ref.data(), y.data(), 100);
+}
+
+template<class T>
+void test_convolve_type(TestReporter& tr, TestRng& rng)
+{
+    using namespace simdpp;
+    const std::size_t ksizes[] = { 1, 2, 3, 5, 7 };
+    const std::size_t dims[] = { 1, 4, 9, 23, 70 };
+    const T canary = T(77);
+
+    for (std::size_t kxs : ksizes) {
+        for (std::size_t kys : ksizes) {
+            std::vector<T> kx(kxs), ky(kys);
+            gen_coefs(rng, kx);
+            gen_coefs(rng, ky);
+            for (std::size_t rows : dims) {
+                for (std::size_t cols : dims) {
+                    std::size_t ss = cols + 3, ds = cols + 1;
+                    std::vector<T> src(rows * ss);
+                    gen_data(rng, src, 4);
+                    std::vector<T> dst(rows * ds + 1, canary), ref = dst;
+
+                    if (rows >= kys && cols >= kxs) {
+                        std::size_t orows = rows - kys + 1, ocols = cols - kxs + 1;
+                        std::vector<T> tmp(rows * ocols), col(kys);
+                        for (std::size_t r = 0; r < rows; ++r) {
+                            for (std::size_t c = 0; c < ocols; ++c)
+                                tmp[r * ocols + c] = ref_fir_acc(&src[r * ss + c],
+                                                                 kx.data(), kxs);
+                        }
+                        for (std::size_t r = 0; r < orows; ++r) {
+                            for (std::size_t c = 0; c < ocols; ++c) {
+                                for (std::size_t v = 0; v < kys; ++v)
+                                    col[v] = tmp[(r + v) * ocols + c];
+                                ref[r * ds + c] = ref_fir_acc(col.data(), ky.data(), kys);
+                            }
+                        }
+                    }
+                    convolve_separable(src.data(), rows, cols, ss, kx.data(), kxs,
+                                       ky.data(), kys, dst.data(), ds);
+                    TEST_EQUAL_MEMORY(tr, ref.data(), dst.data(), dst.size());
+                }
+            }
+        }
+    }
+}
+
+void test_dsp(TestResults&, TestReporter& tr)
+{
+    TestRng rng(13);
+    test_fir_type<float>(tr, rng);
+    test_fir_type<int16_t>(tr, rng);
+    test_fir_saturation(tr);
+    test_convolve_type<float>(tr, rng);
+    test_convolve_type<int16_t>(tr, rng);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,189 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+inline uint32_t float16_ref_to_f32(uint16_t h)
+{
+    uint32_t sign = uint32_t(h & 0x8000) << 16;
+    uint32_t exp = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    if (exp == 0x1f) {
+        if (mant == 0)
+            return sign | 0x7f800000;
+        return sign | 0x7fc00000 | (mant << 13);
+    }
+    float f;
+    if (exp == 0)
+        f = std::ldexp(float(mant), -24);
+    else
+        f = std::ldexp(float(mant | 0x400), int(exp) - 25);
+    uint32_t r;
+    std::memcpy(&r, &f, 4);
+    return sign | r;
+}
+
+inline uint16_t float16_ref_from_f32(uint32_t x)
+{
+    uint16_t sign = (x >> 16) & 0x8000;
+    uint32_t ax = x & 0x7fffffff;
+    if (ax > 0x7f800000)
+        return sign | 0x7e00 | ((ax >> 13) & 0x1ff);
+
+    int e = int(ax >> 23) - 127;
+    uint32_t mant = ax & 0x7fffff;
+    if (e >= 16)
+        return sign | 0x7c00;
+    if (e >= -14) {
+        uint32_t h = (uint32_t(e + 15) << 10) | (mant >> 13);
+        uint32_t rem = mant & 0x1fff;
+        if (rem > 0x1000 || (rem == 0x1000 && (h & 1)))
+            h++;
+        return sign | uint16_t(h); // overflow carries into 0x7c00
+    }
+    if (e == -127) {
+        e = -126; // single-precision denormals
+    } else {
+        mant |= 0x800000;
+    }
+    unsigned shift = 13 + (-14 - e);
+    if (shift >= 32)
+        return sign;
+    uint32_t h = mant >> shift;
+    uint32_t rem = mant & ((1u << shift) - 1);
+    uint32_t half = 1u << (shift - 1);
+    if (rem > half || (rem == half && (h & 1)))
+        h++;
+    return sign | uint16_t(h);
+}
+
+inline uint16_t bfloat16_ref_from_f32(uint32_t x)
+{
+    if ((x & 0x7fffffff) > 0x7f800000)
+        return uint16_t((x >> 16) | 0x40);
+    return uint16_t((x + 0x7fff + ((x >> 16) & 1)) >> 16);
+}
+
+inline bool float16_is_nan_f32(uint32_t x)
+{
+    return (x & 0x7fffffff) > 0x7f800000;
+}
+
+inline bool float16_is_nan_f16(uint16_t x)
+{
+    return (x & 0x7fff) > 0x7c00;
+}
+
+std::vector<uint32_t> float16_test_f32_values()
+{
+    std::vector<uint32_t> r;
+    // all half-precision values, the midpoints between them and values next
+    // to the midpoints
+    for (uint32_t i = 0; i < 0x10000; i += 7) {
+        uint32_t f = float16_ref_to_f32(uint16_t(i));
+        r.push_back(f);
+        if (!float16_is_nan_f32(f) && (f & 0x7fffffff) < 0x7f800000) {
+            r.push_back(f + 0x1000);
+            r.push_back(f + 0x0fff);
+            r.push_back(f + 0x1001);
+        }
+    }
+    const uint32_t special[] = {
+        0x00000000, 0x80000000, 0x00000001, 0x807fffff, 0x33000000, 0x33000001,
+        0x337fffff, 0x387fefff, 0x387ff000, 0x38800000, 0x477fe000, 0x477fefff,
+        0x477ff000, 0x47800000, 0x7f7fffff, 0x7f800000, 0xff800000, 0x7f800001,
+        0x7fbfffff, 0x7fc00000, 0xffffffff, 0x7fffe000,
+    };
+    for (uint32_t v : special)
+        r.push_back(v);
+
+    TestRng rng(0x9e3779b97f4a7c15);
+    for (unsigned i = 0; i < 1024; ++i)
+        r.push_back(uint32_t(rng.next() >> 32));
+    return r;
+}
+
+template<unsigned N>
+void test_float16_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    SIMDPP_ALIGN(64) uint32_t rdata32[N];
+    SIMDPP_ALIGN(64) uint16_t rdata16[N];
+    uint32_t expected32[N];
+    uint16_t expected16[N];
+
+    // half to single precision, exhaustive
+    std::vector<uint16_t> halves;
+    for (uint32_t i = 0; i < 0x10000; ++i)
+        halves.push_back(uint16_t(i));
+
+    for (unsigned i = 0; i < halves.size(); i += N) {
+        float16<N> h = load_u(halves.data() + i);
+        float32<N> f = to_float32(h);
+        store(rdata32, f);
+        for (unsigned j = 0; j < N; ++j) {
+            expected32[j] = float16_ref_to_f32(halves[i+j]);
+            // the payload of NaNs is not checked
+            if (float16_is_nan_f32(expected32[j]) && float16_is_nan_f32(rdata32[j]))
+                rdata32[j] = expected32[j];
+        }
+        TEST_PUSH(tc, uint32<N>, load(rdata32));
+        TEST_EQUAL_MEMORY(tr, expected32, rdata32, N);
+
+        bfloat16<N> b = load_u(halves.data() + i);
+        f = to_float32(b);
+        store(rdata32, f);
+        for (unsigned j = 0; j < N; ++j)
+            expected32[j] = uint32_t(halves[i+j]) << 16;
+        TEST_PUSH(tc, uint32<N>, load(rdata32));
+        TEST_EQUAL_MEMORY(tr, expected32, rdata32, N);
+    }
+
+    // single to half precision
+    std::vector<uint32_t> singles = float16_test_f32_values();
+    while (singles.size() % N != 0)
+        singles.push_back(0);
+
+    for (unsigned i = 0; i < singles.size(); i += N) {
+        float32<N> f = load_u(singles.data() + i);
+        float16<N> h = to_float16(f);
+        store(rdata16, h);
+        for (unsigned j = 0; j < N; ++j) {
+            expected16[j] = float16_ref_from_f32(singles[i+j]);
+            if (float16_is_nan_f16(expected16[j]) && float16_is_nan_f16(rdata16[j]))
+                rdata16[j] = expected16[j];
+        }
+        TEST_PUSH(tc, uint16<N>, load(rdata16));
+        TEST_EQUAL_MEMORY(tr, expected16, rdata16, N);
+
+        bfloat16<N> b = to_bfloat16(f);
+        store_u(rdata16, b);
+        for (unsigned j = 0; j < N; ++j)
+            expected16[j] = bfloat16_ref_from_f32(singles[i+j]);
+        TEST_PUSH(tc, uint16<N>, load(rdata16));
+        TEST_EQUAL_MEMORY(tr, expected16, rdata16, N);
+    }
+}
+
+void test_float16(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("float16");
+    test_float16_n<8>(tc, tr);
+    test_float16_n<16>(tc, tr);
+    test_float16_n<32>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,131 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <limits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+inline void test_gemm_call(std::size_t m, std::size_t n, std::size_t k, float alpha,
+                           const float* a, std::size_t lda,
+                           const float* b, std::size_t ldb,
+                           float beta, float* c, std::size_t ldc)
+{
+    simdpp::sgemm(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+inline void test_gemm_call(std::size_t m, std::size_t n, std::size_t k, double alpha,
+                           const double* a, std::size_t lda,
+                           const double* b, std::size_t ldb,
+                           double beta, double* c, std::size_t ldc)
+{
+    simdpp::dgemm(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+/*  The matrices hold small integers and alpha and beta are powers of two,
+    thus all intermediate results are exact and do not depend on the order
+    of the additions or on whether fused multiply-add is used.
+*/
+template<class T>
+void test_gemm_case(TestReporter& tr, TestRng& rng,
+                    std::size_t m, std::size_t n, std::size_t k,
+                    T alpha, T beta)
+{
+    std::size_t lda = k + 3, ldb = n + 1, ldc = n + 5;
+    std::vector<T> a(m * lda + 1), b(k * ldb + 1), c(m * ldc + 1);
+    for (auto& x : a)
+        x = T(int(rng.next() >> 61) - 3);
+    for (auto& x : b)
+        x = T(int(rng.next() >> 61) - 4);
+
+    // with beta equal to zero C is not read, thus it may contain NaN
+    T fill = beta == 0 ? std::numeric_limits<T>::quiet_NaN() : T(0);
+    for (auto& x : c)
+        x = fill;
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            if (beta != 0)
+                c[i * ldc + j] = T(int(rng.next() >> 60) - 8);
+        }
+    }
+
+    std::vector<T> ref = c;
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            T sum = 0;
+            for (std::size_t p = 0; p < k; ++p)
+                sum += a[i * lda + p] * b[p * ldb + j];
+            T r = alpha * sum;
+            if (beta != 0)
+                r += beta * ref[i * ldc + j];
+            ref[i * ldc + j] = r;
+        }
+    }
+
+    test_gemm_call(m, n, k, alpha, a.data(), lda, b.data(), ldb,
+                   beta, c.data(), ldc);
+
+    // the elements between the rows of C must not be modified
+    std::size_t bad = 0;
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        bool in_c = i / ldc < m && i % ldc < n;
+        bool both_nan = c[i] != c[i] && ref[i] != ref[i];
+        if (c[i] != ref[i] && (in_c || !both_nan))
+            bad++;
+    }
+    TEST_EQUAL(tr, std::size_t(0), bad);
+    if (bad != 0) {
+        tr.out() << "m: " << m << " n: " << n << " k: " << k
+                 << " alpha: " << alpha << " beta: " << beta << "\n";
+    }
+}
+
+template<class T>
+void test_gemm(TestReporter& tr, TestRng& rng)
+{
+    using namespace simdpp::detail::linalg;
+    const std::size_t mr = gemm_mr;
+    const std::size_t nr = 2 * gemm_traits<T>::vec::length;
+
+    struct dims { std::size_t m, n, k; };
+    const dims cases[] = {
+        { 0, 5, 5 }, { 5, 0, 5 }, { 5, 5, 0 }, { 1, 1, 1 },
+        { mr - 1, nr - 1, 3 }, { mr, nr, 7 }, { mr + 1, nr + 1, 9 },
+        { 2 * mr + 3, 3 * nr + 5, 17 },
+        // multiple blocks of rows, of the shared dimension and of columns
+        { gemm_mc + 5, 37, 20 },
+        { 23, 41, gemm_kc + 13 },
+        { 3, gemm_nc + 9, 5 },
+        { gemm_mc + mr + 1, 2 * nr + 3, 2 * gemm_kc + 1 },
+    };
+    const T alphas[] = { 1, T(0.5), -2 };
+    const T betas[] = { 0, 1, T(-0.25) };
+
+    for (const dims& d : cases) {
+        for (T alpha : alphas) {
+            for (T beta : betas) {
+                test_gemm_case<T>(tr, rng, d.m, d.n, d.k, alpha, beta);
+            }
+        }
+    }
+    // alpha equal to zero only scales C
+    test_gemm_case<T>(tr, rng, 7, 9, 11, T(0), T(2));
+    test_gemm_case<T>(tr, rng, 7, 9, 11, T(0), T(0));
+}
+
+void test_linalg(TestResults&, TestReporter& tr)
+{
+    TestRng rng(11);
+    test_gemm<float>(tr, rng);
+    test_gemm<double>(tr, rng);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,186 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../common/vectors.h"
+#include <simdpp/simd.h>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void test_load_first_last_type(TestResultsSet& tc, TestReporter& tr,
+                               const typename V::element_type* data)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) E rdata[N];
+    E expected[N];
+
+    for (unsigned n = 0; n <= N; ++n) {
+        // use unaligned pointer
+        const E* p = data + 1;
+
+        for (unsigned i = 0; i < N; ++i)
+            expected[i] = i < n ? p[i] : E(0);
+        V r = load_first<V>(p, n);
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+
+        for (unsigned i = 0; i < N; ++i)
+            expected[i] = i >= N - n ? p[i] : E(0);
+        r = load_last<V>(p, n);
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+template<class V>
+void test_load_masked_type(TestResultsSet& tc, TestReporter& tr,
+                           const typename V::element_type* data)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using U = typename V::uint_vector_type;
+    using UE = typename U::uint_element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) UE mdata[N];
+    SIMDPP_ALIGN(64) E rdata[N];
+    E expected[N];
+
+    uint32_t bits = 0x1b3f5d2e;
+    for (unsigned t = 0; t < 8; ++t) {
+        bits = bits * 1103515245 + 12345;
+        for (unsigned i = 0; i < N; ++i)
+            mdata[i] = (bits >> (i % 32)) & 1;
+        U um = load(mdata);
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(um, 0);
+
+        const E* p = data + 1;
+        for (unsigned i = 0; i < N; ++i)
+            expected[i] = mdata[i] ? p[i] : E(0);
+        V r = load_masked(p, mask);
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+template<class V>
+void test_load_masked_all(TestResultsSet& tc, TestReporter& tr,
+                          const typename V::element_type* data)
+{
+    test_load_first_last_type<V>(tc, tr, data);
+    test_load_masked_type<V>(tc, tr, data);
+}
+
+#if defined(__linux__)
+/*  Checks that the functions don't access memory outside the requested
+    range: the data is placed right before or right after an inaccessible
+    page.
+*/
+template<class V>
+void test_load_first_last_page(TestReporter& tr, char* page, char* guard_end)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) E rdata[N];
+    E expected[N];
+
+    for (unsigned n = 0; n <= N; ++n) {
+        // data ends right before the guard page following the page
+        const E* p = reinterpret_cast<const E*>(guard_end) - n;
+        for (unsigned i = 0; i < N; ++i)
+            expected[i] = i < n ? p[i] : E(0);
+        store(rdata, load_first<V>(p, n));
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+
+        // data starts right after the guard page preceding the page
+        p = reinterpret_cast<const E*>(page) - (N - n);
+        for (unsigned i = 0; i < N; ++i)
+            expected[i] = i >= N - n ? p[i] : E(0);
+        store(rdata, load_last<V>(p, n));
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+template<unsigned B>
+void test_load_masked_page(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0)
+        return;
+    std::size_t ps = page_size;
+    void* mem = mmap(nullptr, ps * 3, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED)
+        return;
+
+    char* base = reinterpret_cast<char*>(mem);
+    char* page = base + ps;
+    for (std::size_t i = 0; i < ps; ++i)
+        page[i] = char(i * 7 + 3);
+    mprotect(base, ps, PROT_NONE);
+    mprotect(page + ps, ps, PROT_NONE);
+
+    test_load_first_last_page<uint8<B>>(tr, page, page + ps);
+    test_load_first_last_page<uint16<B/2>>(tr, page, page + ps);
+    test_load_first_last_page<uint32<B/4>>(tr, page, page + ps);
+    test_load_first_last_page<uint64<B/8>>(tr, page, page + ps);
+
+    munmap(mem, ps * 3);
+}
+#endif
+
+template<unsigned B>
+void test_load_masked_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    Vectors<B,3> v;
+
+    test_load_masked_all<uint8<B>>(tc, tr, v.pu8);
+    test_load_masked_all<int8<B>>(tc, tr, v.pi8);
+    test_load_masked_all<uint16<B/2>>(tc, tr, v.pu16);
+    test_load_masked_all<int16<B/2>>(tc, tr, v.pi16);
+    test_load_masked_all<uint32<B/4>>(tc, tr, v.pu32);
+    test_load_masked_all<int32<B/4>>(tc, tr, v.pi32);
+    test_load_masked_all<uint64<B/8>>(tc, tr, v.pu64);
+    test_load_masked_all<int64<B/8>>(tc, tr, v.pi64);
+    test_load_masked_all<float32<B/4>>(tc, tr, v.pf32);
+    test_load_masked_all<float64<B/8>>(tc, tr, v.pf64);
+
+#if defined(__linux__)
+    test_load_masked_page<B>(tr);
+#endif
+}
+
+void test_load_masked(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("load_masked");
+    test_load_masked_n<16>(tc, tr);
+    test_load_masked_n<32>(tc, tr);
+    test_load_masked_n<64>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,233 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../common/vectors.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Checks the results of a masked operation against the result of the
+    corresponding unmasked operation @a full.
+*/
+template<class V>
+void test_masked_result(TestResultsSet& tc, TestReporter& tr,
+                        const typename V::mask_vector_type& mask,
+                        const V& src, const V& full, const V& merged,
+                        const V& zeroed)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using U = typename V::uint_vector_type;
+    using UE = typename U::uint_element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) UE mdata[N];
+    SIMDPP_ALIGN(64) E sdata[N];
+    SIMDPP_ALIGN(64) E fdata[N];
+    SIMDPP_ALIGN(64) E rdata[N];
+    E expected[N];
+
+    store(mdata, bit_cast<U>(mask.unmask()));
+    store(sdata, src);
+    store(fdata, full);
+
+    for (unsigned i = 0; i < N; ++i)
+        expected[i] = mdata[i] ? fdata[i] : sdata[i];
+    store(rdata, merged);
+    TEST_PUSH(tc, V, merged);
+    TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+
+    for (unsigned i = 0; i < N; ++i)
+        expected[i] = mdata[i] ? fdata[i] : E(0);
+    store(rdata, zeroed);
+    TEST_PUSH(tc, V, zeroed);
+    TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+}
+
+#define TEST_MASKED_OP2(TC, TR, V, OP, M, S, A, B)                             \
+    test_masked_result<V>(TC, TR, M, S, V(OP(A, B)), V(OP(M, S, A, B)),         \
+                          V(maskz_##OP(M, A, B)))
+
+#define TEST_MASKED_SHIFT(TC, TR, V, OP, M, S, A, C)                           \
+    test_masked_result<V>(TC, TR, M, S, V(OP(A, C)), V(OP(M, S, A, C)),         \
+                          V(maskz_##OP(M, A, C)))
+
+template<class V>
+typename V::mask_vector_type test_masked_make_mask(uint32_t bits)
+{
+    using namespace simdpp;
+    using U = typename V::uint_vector_type;
+    using UE = typename U::uint_element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) UE mdata[N];
+    for (unsigned i = 0; i < N; ++i)
+        mdata[i] = (bits >> (i % 32)) & 1;
+    U m = load(mdata);
+    typename V::mask_vector_type r;
+    r = cmp_neq(m, 0);
+    return r;
+}
+
+template<class V>
+void test_masked_int_type(TestResultsSet& tc, TestReporter& tr,
+                          const typename V::element_type* data)
+{
+    using namespace simdpp;
+    const unsigned N = V::length;
+    using M = typename V::mask_vector_type;
+
+    V a = load(data);
+    V b = load(data + N);
+    V s = load(data + 2*N);
+
+    uint32_t bits = 0x5a3c96e1;
+    for (unsigned t = 0; t < 8; ++t) {
+        bits = bits * 1103515245 + 12345;
+        M m = test_masked_make_mask<V>(bits);
+
+        TEST_MASKED_OP2(tc, tr, V, add, m, s, a, b);
+        TEST_MASKED_OP2(tc, tr, V, sub, m, s, a, b);
+        TEST_MASKED_SHIFT(tc, tr, V, shift_l, m, s, a, 3);
+        TEST_MASKED_SHIFT(tc, tr, V, shift_r, m, s, a, 5);
+    }
+}
+
+template<class V>
+void test_masked_minmax_type(TestResultsSet& tc, TestReporter& tr,
+                             const typename V::element_type* data)
+{
+    using namespace simdpp;
+    const unsigned N = V::length;
+    using M = typename V::mask_vector_type;
+
+    V a = load(data);
+    V b = load(data + N);
+    V s = load(data + 2*N);
+
+    M m = test_masked_make_mask<V>(0x6b8b4567);
+    TEST_MASKED_OP2(tc, tr, V, min, m, s, a, b);
+    TEST_MASKED_OP2(tc, tr, V, max, m, s, a, b);
+}
+
+template<class V>
+void test_masked_mul_lo_type(TestResultsSet& tc, TestReporter& tr,
+                             const typename V::element_type* data)
+{
+    using namespace simdpp;
+    const unsigned N = V::length;
+    using M = typename V::mask_vector_type;
+
+    V a = load(data);
+    V b = load(data + N);
+    V s = load(data + 2*N);
+
+    M m = test_masked_make_mask<V>(0x327b23c6);
+    TEST_MASKED_OP2(tc, tr, V, mul_lo, m, s, a, b);
+}
+
+template<class V>
+void test_masked_float_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using M = typename V::mask_vector_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) E data[N*4];
+    for (unsigned i = 0; i < N*4; ++i)
+        data[i] = E(int(i * 37 % 101) - 50) / 8;
+
+    V a = load(data);
+    V b = load(data + N);
+    V s = load(data + 3*N);
+
+    uint32_t bits = 0x2ae8944a;
+    for (unsigned t = 0; t < 8; ++t) {
+        bits = bits * 1103515245 + 12345;
+        M m = test_masked_make_mask<V>(bits);
+
+        TEST_MASKED_OP2(tc, tr, V, add, m, s, a, b);
+        TEST_MASKED_OP2(tc, tr, V, sub, m, s, a, b);
+        TEST_MASKED_OP2(tc, tr, V, mul, m, s, a, b);
+        TEST_MASKED_OP2(tc, tr, V, min, m, s, a, b);
+        TEST_MASKED_OP2(tc, tr, V, max, m, s, a, b);
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL
+        V c = load(data + 2*N);
+        test_masked_result<V>(tc, tr, m, s, V(fmadd(a, b, c)),
+                              V(fmadd(m, s, a, b, c)),
+                              V(maskz_fmadd(m, a, b, c)));
+#endif
+    }
+}
+
+template<unsigned B>
+void test_masked_ops_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    Vectors<B,3> v;
+
+    test_masked_int_type<uint16<B/2>>(tc, tr, v.pu16);
+    test_masked_int_type<int16<B/2>>(tc, tr, v.pi16);
+    test_masked_int_type<uint32<B/4>>(tc, tr, v.pu32);
+    test_masked_int_type<int32<B/4>>(tc, tr, v.pi32);
+    test_masked_int_type<uint64<B/8>>(tc, tr, v.pu64);
+    test_masked_int_type<int64<B/8>>(tc, tr, v.pi64);
+
+    test_masked_minmax_type<uint8<B>>(tc, tr, v.pu8);
+    test_masked_minmax_type<int8<B>>(tc, tr, v.pi8);
+    test_masked_minmax_type<uint16<B/2>>(tc, tr, v.pu16);
+    test_masked_minmax_type<int16<B/2>>(tc, tr, v.pi16);
+    test_masked_minmax_type<uint32<B/4>>(tc, tr, v.pu32);
+    test_masked_minmax_type<int32<B/4>>(tc, tr, v.pi32);
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
+    test_masked_minmax_type<uint64<B/8>>(tc, tr, v.pu64);
+    test_masked_minmax_type<int64<B/8>>(tc, tr, v.pi64);
+#endif
+
+    test_masked_mul_lo_type<uint16<B/2>>(tc, tr, v.pu16);
+    test_masked_mul_lo_type<int32<B/4>>(tc, tr, v.pi32);
+
+    test_masked_float_type<float32<B/4>>(tc, tr);
+    test_masked_float_type<float64<B/8>>(tc, tr);
+
+    // 8-bit addition, arguments of mixed types
+    uint8<B> a = load(v.pu8);
+    int8<B> b = load(v.pi8 + B);
+    uint8<B> s = load(v.pu8 + 2*B);
+    mask_int8<B> m = test_masked_make_mask<uint8<B>>(0x7545e146);
+    TEST_MASKED_OP2(tc, tr, uint8<B>, add, m, s, a, b);
+    TEST_MASKED_OP2(tc, tr, uint8<B>, sub, m, s, a, b);
+
+    // float mask used for integer vector
+    uint32<B/4> a32 = load(v.pu32);
+    uint32<B/4> s32 = load(v.pu32 + B/4);
+    mask_float32<B/4> mf = test_masked_make_mask<float32<B/4>>(0x515f007c);
+    mask_int32<B/4> mi = mask_int32<B/4>(mf);
+    test_masked_result<uint32<B/4>>(tc, tr, mi, s32, uint32<B/4>(add(a32, a32)),
+                                    add(mf, s32, a32, a32),
+                                    maskz_add(mf, a32, a32));
+
+    // mask passed directly from a comparison
+    mi = cmp_lt(a32, s32);
+    test_masked_result<uint32<B/4>>(tc, tr, mi, s32, uint32<B/4>(sub(s32, a32)),
+                                    sub(cmp_lt(a32, s32), s32, s32, a32),
+                                    maskz_sub(cmp_lt(a32, s32), s32, a32));
+}
+
+void test_masked_ops(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("masked_ops");
+    test_masked_ops_n<16>(tc, tr);
+    test_masked_ops_n<32>(tc, tr);
+    test_masked_ops_n<64>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,175 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Returns the difference between the result and the reference in ULPs of T
+template<class T>
+double math_func_ulp_diff(T result, long double ref)
+{
+    T ref_t = static_cast<T>(ref);
+    if (std::isnan(ref_t) || std::isnan(result))
+        return std::isnan(ref_t) && std::isnan(result) ? 0 : HUGE_VAL;
+    if (std::isinf(ref_t) || std::isinf(result))
+        return ref_t == result ? 0 : HUGE_VAL;
+
+    int exp;
+    std::frexp(static_cast<T>(std::fabs(ref_t)), &exp);
+    exp = std::max(exp, std::numeric_limits<T>::min_exponent);
+    long double ulp = std::ldexp(1.0L, exp - std::numeric_limits<T>::digits);
+    return static_cast<double>(std::fabs(result - ref) / ulp);
+}
+
+template<class V, class F, class R>
+void test_math_func_type(TestReporter& tr, const char* name,
+                         const std::vector<typename V::element_type>& inputs,
+                         F func, R ref_func, double max_ulp)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) E adata[N];
+    SIMDPP_ALIGN(64) E rdata[N];
+
+    // The reference is rounded only once if long double is wider than E.
+    // Otherwise the error of the reference itself may reach 1 ULP.
+    if (std::numeric_limits<long double>::digits <=
+            std::numeric_limits<E>::digits) {
+        max_ulp += 1;
+    }
+
+    for (unsigned i = 0; i < inputs.size(); i += N) {
+        for (unsigned j = 0; j < N; ++j) {
+            adata[j] = inputs[(i + j) % inputs.size()];
+        }
+        V a = load(adata);
+        V r = func(a);
+        store(rdata, r);
+
+        for (unsigned j = 0; j < N; ++j) {
+            long double ref = ref_func(static_cast<long double>(adata[j]));
+            double diff = math_func_ulp_diff(rdata[j], ref);
+            bool success = diff <= max_ulp;
+            tr.add_result(success);
+            if (!success) {
+                print_separator(tr.out());
+                print_file_info(tr.out(), __FILE__, __LINE__);
+                tr.out() << name << "(" << adata[j] << "): expected "
+                         << static_cast<E>(ref) << ", got " << rdata[j]
+                         << " (" << diff << " ULP)\n";
+            }
+        }
+    }
+}
+
+// Returns count values from [from, to] spaced evenly, plus special values
+template<class E>
+std::vector<E> math_func_inputs(double from, double to, unsigned count)
+{
+    std::vector<E> r;
+    for (unsigned i = 0; i < count; ++i) {
+        r.push_back(static_cast<E>(from + (to - from) * i / (count - 1)));
+    }
+    r.push_back(0);
+    r.push_back(-E(0));
+    r.push_back(std::numeric_limits<E>::infinity());
+    r.push_back(-std::numeric_limits<E>::infinity());
+    r.push_back(std::numeric_limits<E>::quiet_NaN());
+    return r;
+}
+
+// Returns count values spaced logarithmically within [from, to], from > 0
+template<class E>
+std::vector<E> math_func_log_inputs(double from, double to, unsigned count)
+{
+    std::vector<E> r = math_func_inputs<E>(-1, 1, 3);
+    double lf = std::log(from);
+    double lt = std::log(to);
+    for (unsigned i = 0; i < count; ++i) {
+        r.push_back(static_cast<E>(std::exp(lf + (lt - lf) * i / (count - 1))));
+    }
+    return r;
+}
+
+#define TEST_MATH_FUNC(TR, V, FUNC, REF, INPUTS, MAX_ULP)                       \
+    test_math_func_type<V>(TR, #FUNC, INPUTS,                                  \
+        [](const V& a) { return V(FUNC(a)); },                                  \
+        [](long double x) { return (long double) std::REF(x); }, MAX_ULP)
+
+/*  The tolerances below are the documented bounds. The reference values are
+    computed in long double precision where available.
+*/
+template<unsigned B>
+void test_math_func_n(TestReporter& tr)
+{
+    using namespace simdpp;
+    using float32_n = float32<B/4>;
+    using float64_n = float64<B/8>;
+
+    std::vector<float> f_exp = math_func_inputs<float>(-87.0, 88.0, 1001);
+    std::vector<float> f_log = math_func_log_inputs<float>(1.2e-38, 3.4e38, 1001);
+    std::vector<float> f_sin = math_func_inputs<float>(-6000.0, 6000.0, 1001);
+    std::vector<float> f_small = math_func_inputs<float>(-3.2, 3.2, 1001);
+    std::vector<float> f_tanh = math_func_inputs<float>(-10.0, 10.0, 1001);
+    std::vector<float> f_erf = math_func_inputs<float>(-4.5, 4.5, 1001);
+
+    TEST_MATH_FUNC(tr, float32_n, exp, exp, f_exp, 1);
+    TEST_MATH_FUNC(tr, float32_n, exp_e, exp, f_exp, 6);
+    TEST_MATH_FUNC(tr, float32_n, log, log, f_log, 1);
+    TEST_MATH_FUNC(tr, float32_n, log_e, log, f_log, 6.5);
+    TEST_MATH_FUNC(tr, float32_n, sin, sin, f_sin, 2.5);
+    TEST_MATH_FUNC(tr, float32_n, sin, sin, f_small, 2.5);
+    TEST_MATH_FUNC(tr, float32_n, sin_e, sin, f_sin, 2.5);
+    TEST_MATH_FUNC(tr, float32_n, sin_e, sin, f_small, 1.6);
+    TEST_MATH_FUNC(tr, float32_n, cos, cos, f_sin, 2.5);
+    TEST_MATH_FUNC(tr, float32_n, cos, cos, f_small, 2.5);
+    TEST_MATH_FUNC(tr, float32_n, cos_e, cos, f_sin, 2.5);
+    TEST_MATH_FUNC(tr, float32_n, cos_e, cos, f_small, 1.6);
+    TEST_MATH_FUNC(tr, float32_n, tanh, tanh, f_tanh, 2.5);
+    TEST_MATH_FUNC(tr, float32_n, tanh_e, tanh, f_tanh, 15);
+    TEST_MATH_FUNC(tr, float32_n, erf, erf, f_erf, 2.5);
+    TEST_MATH_FUNC(tr, float32_n, erf_e, erf, f_erf, 7.5);
+
+    std::vector<double> d_exp = math_func_inputs<double>(-708.0, 709.0, 1001);
+    std::vector<double> d_log = math_func_log_inputs<double>(2.3e-308, 1.7e308, 1001);
+    std::vector<double> d_sin = math_func_inputs<double>(-1.6e6, 1.6e6, 1001);
+    std::vector<double> d_small = math_func_inputs<double>(-3.2, 3.2, 1001);
+    std::vector<double> d_tanh = math_func_inputs<double>(-20.0, 20.0, 1001);
+    std::vector<double> d_erf = math_func_inputs<double>(-6.5, 6.5, 1001);
+
+    TEST_MATH_FUNC(tr, float64_n, exp, exp, d_exp, 1);
+    TEST_MATH_FUNC(tr, float64_n, exp_e, exp, d_exp, 9);
+    TEST_MATH_FUNC(tr, float64_n, log, log, d_log, 1);
+    TEST_MATH_FUNC(tr, float64_n, log_e, log, d_log, 5.5);
+    TEST_MATH_FUNC(tr, float64_n, sin, sin, d_sin, 2.5);
+    TEST_MATH_FUNC(tr, float64_n, sin, sin, d_small, 2.5);
+    TEST_MATH_FUNC(tr, float64_n, sin_e, sin, d_sin, 125);
+    TEST_MATH_FUNC(tr, float64_n, cos, cos, d_sin, 2.5);
+    TEST_MATH_FUNC(tr, float64_n, cos, cos, d_small, 2.5);
+    TEST_MATH_FUNC(tr, float64_n, cos_e, cos, d_sin, 125);
+    TEST_MATH_FUNC(tr, float64_n, tanh, tanh, d_tanh, 2.5);
+    TEST_MATH_FUNC(tr, float64_n, tanh_e, tanh, d_tanh, 22);
+    TEST_MATH_FUNC(tr, float64_n, erf, erf, d_erf, 3.5);
+    TEST_MATH_FUNC(tr, float64_n, erf_e, erf, d_erf, 40);
+}
+
+void test_math_func(TestResults&, TestReporter& tr)
+{
+    test_math_func_n<16>(tr);
+    test_math_func_n<32>(tr);
+    test_math_func_n<64>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -36,6 +36,8 @@ void test_math_int8_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP2(tc, int8_n, add_sat, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int8_n, sub, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int8_n, sub_sat, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int8_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int8_n, mul_hi, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int8_n, min, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int8_n, max, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int8_n, avg, s);
@@ -45,6 +47,8 @@ void test_math_int8_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP2(tc, uint8_n, add_sat, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint8_n, sub, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint8_n, sub_sat, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint8_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint8_n, mul_hi, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint8_n, min, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint8_n, max, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint8_n, avg, s);
@@ -151,6 +155,8 @@ void test_math_int32_n(TestResultsSet& tc)
 
     TEST_PUSH_ALL_COMB_OP2(tc, int32_n, add, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int32_n, sub, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int32_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int32_n, mul_hi, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int32_n, min, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int32_n, max, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int32_n, avg, s);
@@ -162,6 +168,7 @@ void test_math_int32_n(TestResultsSet& tc)
 
     TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, add, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, sub, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, mul_hi, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, min, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, max, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, avg, s);
@@ -218,6 +225,10 @@ void test_math_int64_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP2(tc, int64_n, sub, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, add, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, sub, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int64_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int64_n, mul_hi, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, mul_hi, s);
 
 #if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
     TEST_PUSH_ALL_COMB_OP2(tc, int64_n, min, s);
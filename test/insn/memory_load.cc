@@ -75,6 +75,12 @@ void test_load_helper(TestResultsSet& tc, TestReporter& tr,
         TEST_NOT_EQUAL(tr, zero, r);
     }
 
+    for (unsigned i = 0; i < vnum; i++) {
+        V r = simdpp::stream_load<V>(sdata + i*V::length);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, sv[i], r);
+    }
+
     rzero(rv);
     load_packed2(rv[0], rv[1], sdata);
     TEST_PUSH_ARRAY(tc, V, rv);
@@ -97,6 +103,44 @@ void test_load_helper(TestResultsSet& tc, TestReporter& tr,
     TEST_NOT_EQUAL(tr, zero, rv[3]);
 }
 
+template<class V>
+void test_gather(TestResultsSet& tc, TestReporter& tr,
+                 const typename V::element_type* sdata, unsigned count)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) uint32_t idata[N];
+    SIMDPP_ALIGN(64) E mdata[N];
+    SIMDPP_ALIGN(64) E rdata[N];
+    E expected[N];
+
+    for (unsigned i = 0; i < N; i++) {
+        idata[i] = (i * 7 + 3) % count;
+        mdata[i] = (i % 3 == 0) ? 1 : 0;
+    }
+    uint32<N> idx = load(idata);
+
+    V r = gather(sdata, idx);
+    store(rdata, r);
+    for (unsigned i = 0; i < N; i++) {
+        expected[i] = sdata[idata[i]];
+    }
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+
+    V mv = load(mdata);
+    typename V::mask_vector_type mask = bit_not(cmp_eq(mv, 0));
+    r = gather_masked(sdata, idx, mask);
+    store(rdata, r);
+    for (unsigned i = 0; i < N; i++) {
+        expected[i] = mdata[i] ? sdata[idata[i]] : 0;
+    }
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+}
+
 template<unsigned B>
 void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 {
@@ -118,6 +162,15 @@ void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 
     test_load_helper<float32<B/4>, vnum>(tc, tr, v.pf32);
     test_load_helper<float64<B/8>, vnum>(tc, tr, v.pf64);
+
+    // 64-bit gathers need at least 4 elements because the index vector can't
+    // be narrower than 128 bits
+    test_gather<uint32<B/4>>(tc, tr, v.pu32, vnum*B/4);
+    test_gather<int32<B/4>>(tc, tr, v.pi32, vnum*B/4);
+    test_gather<float32<B/4>>(tc, tr, v.pf32, vnum*B/4);
+    test_gather<uint64<B/4>>(tc, tr, v.pu64, vnum*B/8);
+    test_gather<int64<B/4>>(tc, tr, v.pi64, vnum*B/8);
+    test_gather<float64<B/4>>(tc, tr, v.pf64, vnum*B/8);
 }
 
 void test_memory_load(TestResults& res, TestReporter& tr)
@@ -49,6 +49,51 @@ void test_store_masked(TestResultsSet& tc, TestReporter& tr, const V* sv)
 
 }
 
+template<class V>
+void test_scatter(TestResultsSet& tc, TestReporter& tr,
+                  const typename V::element_type* src)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) uint32_t idata[N];
+    SIMDPP_ALIGN(64) E sdata[N];
+    SIMDPP_ALIGN(64) E mdata[N];
+    E rdata[2*N];
+    E expected[2*N];
+
+    for (unsigned i = 0; i < N; i++) {
+        idata[i] = (i * 5 + 1) % (2*N);
+        mdata[i] = (i % 3 == 0) ? 1 : 0;
+    }
+    uint32<N> idx = load(idata);
+    std::memcpy(sdata, src, sizeof(sdata));
+    V a = load(sdata);
+
+    std::memset(rdata, 0, sizeof(rdata));
+    std::memset(expected, 0, sizeof(expected));
+    scatter(rdata, idx, a);
+    for (unsigned i = 0; i < N; i++) {
+        expected[idata[i]] = sdata[i];
+    }
+    TEST_PUSH_STORED(tc, V, rdata, 2);
+    TEST_EQUAL_MEMORY(tr, expected, rdata, 2*N);
+
+    V mv = load(mdata);
+    typename V::mask_vector_type mask = bit_not(cmp_eq(mv, 0));
+
+    std::memset(rdata, 0, sizeof(rdata));
+    std::memset(expected, 0, sizeof(expected));
+    scatter_masked(rdata, idx, a, mask);
+    for (unsigned i = 0; i < N; i++) {
+        if (mdata[i])
+            expected[idata[i]] = sdata[i];
+    }
+    TEST_PUSH_STORED(tc, V, rdata, 2);
+    TEST_EQUAL_MEMORY(tr, expected, rdata, 2*N);
+}
+
 template<class V, unsigned vnum>
 void test_store_helper(TestResultsSet& tc, TestReporter& tr, const V* sv)
 {
@@ -188,6 +233,15 @@ void test_memory_store_n(TestResultsSet& tc, TestReporter& tr)
     test_store_masked<int64<B/8>>(tc, tr, v.i64);
     test_store_masked<float32<B/4>>(tc, tr, v.f32);
     test_store_masked<float64<B/8>>(tc, tr, v.f64);
+
+    // 64-bit scatters need at least 4 elements because the index vector
+    // can't be narrower than 128 bits
+    test_scatter<uint32<B/4>>(tc, tr, v.pu32);
+    test_scatter<int32<B/4>>(tc, tr, v.pi32);
+    test_scatter<float32<B/4>>(tc, tr, v.pf32);
+    test_scatter<uint64<B/4>>(tc, tr, v.pu64);
+    test_scatter<int64<B/4>>(tc, tr, v.pi64);
+    test_scatter<float64<B/4>>(tc, tr, v.pf64);
 }
 
 void test_memory_store(TestResults& res, TestReporter& tr)
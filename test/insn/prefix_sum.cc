@@ -0,0 +1,175 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Integer values are random so that the sums wrap around. Floating-point
+    values are small integers, thus the results are exact regardless of the
+    order of operations.
+*/
+template<class T>
+std::vector<T> prefix_sum_test_values(unsigned count, uint64_t seed)
+{
+    TestRng rng(seed);
+    std::vector<T> r;
+    while (r.size() < count) {
+        uint64_t x = rng.next();
+        if (std::is_floating_point<T>::value) {
+            r.push_back(T(int(x >> 59) - 16));
+        } else {
+            r.push_back(T(x >> 7));
+        }
+    }
+    return r;
+}
+
+// Integer promotion would make the overflow of signed values undefined
+template<class T> struct prefix_sum_uint { using type = typename std::make_unsigned<T>::type; };
+template<> struct prefix_sum_uint<float> { using type = float; };
+template<> struct prefix_sum_uint<double> { using type = double; };
+
+template<class T>
+T prefix_sum_add(T a, T b)
+{
+    using U = typename prefix_sum_uint<T>::type;
+    return T(U(U(a) + U(b)));
+}
+
+template<class V>
+void test_prefix_sum_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+    const unsigned count = 16;
+
+    std::vector<T> a = prefix_sum_test_values<T>(N * count, N);
+
+    SIMDPP_ALIGN(64) T rdata[N];
+    T expected[N];
+
+    for (unsigned i = 0; i < N * count; i += N) {
+        V va = load_u(a.data() + i);
+
+        T s = T();
+        for (unsigned j = 0; j < N; ++j) {
+            s = prefix_sum_add(s, a[i+j]);
+            expected[j] = s;
+        }
+        V r = prefix_sum(va);
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+
+        s = T();
+        for (unsigned j = 0; j < N; ++j) {
+            expected[j] = s;
+            s = prefix_sum_add(s, a[i+j]);
+        }
+        r = exclusive_prefix_sum(va);
+        store(rdata, r);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+    }
+}
+
+/*  The arrays are tested at all offsets within a vector and with lengths that
+    cover the head, the unrolled main loop, the single vector loop and the
+    tail.
+*/
+template<class T>
+void test_prefix_sum_array(TestReporter& tr)
+{
+    using namespace simdpp;
+    using V = simdpp::SIMDPP_ARCH_NAMESPACE::detail::algorithm::native_vec_t<T>;
+    const unsigned L = V::length;
+    const unsigned max_size = L * 10 + 3;
+
+    std::vector<T> values = prefix_sum_test_values<T>(max_size + 2*L, 1);
+    std::vector<T, aligned_allocator<T, 64>> src(values.begin(), values.end());
+    std::vector<T, aligned_allocator<T, 64>> dst(max_size + 2*L);
+    const T marker = 13;
+
+    for (unsigned off = 0; off < L; ++off) {
+        for (unsigned n = 0; n <= max_size; n += 1 + n / 8) {
+            const T* first = src.data() + off;
+            const T* last = first + n;
+            T* out = dst.data() + (off * 3) % L;
+
+            std::fill(dst.begin(), dst.end(), marker);
+            T* r = simdpp::prefix_sum(first, last, out);
+            TEST_EQUAL(tr, out + n, r);
+            T s = T();
+            for (unsigned i = 0; i < n; ++i) {
+                s = prefix_sum_add(s, first[i]);
+                TEST_EQUAL(tr, s, out[i]);
+            }
+            TEST_EQUAL(tr, marker, out[n]);
+
+            std::fill(dst.begin(), dst.end(), marker);
+            r = simdpp::exclusive_prefix_sum(first, last, out);
+            TEST_EQUAL(tr, out + n, r);
+            s = T();
+            for (unsigned i = 0; i < n; ++i) {
+                TEST_EQUAL(tr, s, out[i]);
+                s = prefix_sum_add(s, first[i]);
+            }
+            TEST_EQUAL(tr, marker, out[n]);
+        }
+    }
+
+    // in place
+    std::vector<T, aligned_allocator<T, 64>> data(values.begin(), values.end());
+    simdpp::prefix_sum(data.data() + 1, data.data() + max_size, data.data() + 1);
+    T s = T();
+    for (unsigned i = 1; i < max_size; ++i) {
+        s = prefix_sum_add(s, values[i]);
+        TEST_EQUAL(tr, s, data[i]);
+    }
+}
+
+template<unsigned B>
+void test_prefix_sum_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_prefix_sum_type<uint8<B>>(tc, tr);
+    test_prefix_sum_type<int8<B>>(tc, tr);
+    test_prefix_sum_type<uint16<B/2>>(tc, tr);
+    test_prefix_sum_type<int16<B/2>>(tc, tr);
+    test_prefix_sum_type<uint32<B/4>>(tc, tr);
+    test_prefix_sum_type<int32<B/4>>(tc, tr);
+    test_prefix_sum_type<uint64<B/8>>(tc, tr);
+    test_prefix_sum_type<int64<B/8>>(tc, tr);
+    test_prefix_sum_type<float32<B/4>>(tc, tr);
+    test_prefix_sum_type<float64<B/8>>(tc, tr);
+}
+
+void test_prefix_sum(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("prefix_sum");
+    test_prefix_sum_n<16>(tc, tr);
+    test_prefix_sum_n<32>(tc, tr);
+    test_prefix_sum_n<64>(tc, tr);
+    test_prefix_sum_n<128>(tc, tr);
+
+    test_prefix_sum_array<uint8_t>(tr);
+    test_prefix_sum_array<int16_t>(tr);
+    test_prefix_sum_array<uint32_t>(tr);
+    test_prefix_sum_array<int64_t>(tr);
+    test_prefix_sum_array<float>(tr);
+    test_prefix_sum_array<double>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
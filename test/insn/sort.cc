@@ -0,0 +1,183 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The values are drawn from a range of the given size, thus small ranges
+    produce many duplicates. Floating-point values include infinities.
+*/
+template<class T>
+std::vector<T> sort_test_values(std::size_t count, uint64_t range, uint64_t seed)
+{
+    TestRng rng(seed);
+    std::vector<T> r;
+    while (r.size() < count) {
+        uint64_t v = (rng.next() >> 11) % range;
+        if (std::is_floating_point<T>::value) {
+            r.push_back(T(int64_t(v) - int64_t(range / 2)) / 4);
+        } else {
+            r.push_back(T(v - range / 2));
+        }
+    }
+    if (std::numeric_limits<T>::has_infinity && count >= 2) {
+        r[0] = std::numeric_limits<T>::infinity();
+        r[1] = -std::numeric_limits<T>::infinity();
+    } else if (count >= 2) {
+        r[0] = std::numeric_limits<T>::max();
+        r[1] = std::numeric_limits<T>::min();
+    }
+    return r;
+}
+
+template<class V>
+void test_sort_vector_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    const unsigned N = V::length;
+    const unsigned count = 16;
+
+    SIMDPP_ALIGN(64) T rdata[N*2];
+    T expected[N*2];
+
+    for (unsigned i = 0; i < count; ++i) {
+        std::vector<T> a = sort_test_values<T>(N*2, i % 2 ? 8 : 1 << 20, i);
+        V va = load_u(a.data());
+        V vb = load_u(a.data() + N);
+
+        std::copy(a.begin(), a.begin() + N, expected);
+        std::sort(expected, expected + N);
+        va = sort_vector(va);
+        store(rdata, va);
+        TEST_PUSH(tc, V, va);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+
+        std::copy(a.begin(), a.end(), expected);
+        std::sort(expected, expected + N*2);
+        vb = sort_vector(vb);
+        bitonic_merge(va, vb);
+        store(rdata, va);
+        store(rdata + N, vb);
+        TEST_PUSH(tc, V, va);
+        TEST_PUSH(tc, V, vb);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N*2);
+    }
+}
+
+template<class T>
+void test_sort_array_type(TestReporter& tr)
+{
+    using namespace simdpp;
+    const std::size_t sizes[] = { 0, 1, 2, 3, 5, 8, 17, 31, 64, 100, 129, 255,
+                                  1000, 4099, 20000 };
+
+    for (std::size_t size : sizes) {
+        for (unsigned variant = 0; variant < 5; ++variant) {
+            std::vector<T> a;
+            switch (variant) {
+            case 0: a = sort_test_values<T>(size, 1 << 24, size); break;
+            case 1: a = sort_test_values<T>(size, 4, size); break;
+            case 2: a = sort_test_values<T>(size, 1, size); break;
+            case 3:
+                a = sort_test_values<T>(size, 1 << 24, size);
+                std::sort(a.begin(), a.end());
+                break;
+            default:
+                a = sort_test_values<T>(size, 1 << 24, size);
+                std::sort(a.begin(), a.end());
+                std::reverse(a.begin(), a.end());
+                break;
+            }
+            std::vector<T> expected = a;
+            std::sort(expected.begin(), expected.end());
+            sort(a);
+            TEST_EQUAL_MEMORY(tr, expected.data(), a.data(), size);
+        }
+    }
+}
+
+/*  NaN values are sorted after all other values. Arrays that are mostly NaN
+    are tested too, so that the pivot is likely to be NaN.
+*/
+template<class T>
+void test_sort_array_nan(TestReporter& tr)
+{
+    using namespace simdpp;
+    const std::size_t sizes[] = { 1, 2, 7, 31, 100, 255, 1000, 4099 };
+    const unsigned nan_fractions[] = { 0, 1, 4, 12, 16 };
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+
+    for (std::size_t size : sizes) {
+        for (unsigned fraction : nan_fractions) {
+            std::vector<T> a = sort_test_values<T>(size, 1 << 24, size);
+            TestRng rng(size + fraction);
+            for (std::size_t i = 0; i < size; ++i) {
+                if ((rng.next() >> 60) < fraction)
+                    a[i] = nan;
+            }
+            std::vector<T> expected;
+            for (T x : a) {
+                if (x == x)
+                    expected.push_back(x);
+            }
+            std::sort(expected.begin(), expected.end());
+
+            sort(a);
+            TEST_EQUAL_MEMORY(tr, expected.data(), a.data(), expected.size());
+            std::size_t num_nan = 0;
+            for (std::size_t i = expected.size(); i < size; ++i) {
+                if (a[i] != a[i])
+                    num_nan++;
+            }
+            TEST_EQUAL(tr, size - expected.size(), num_nan);
+        }
+    }
+}
+
+template<unsigned B>
+void test_sort_vector_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_sort_vector_type<int32<B/4>>(tc, tr);
+    test_sort_vector_type<uint32<B/4>>(tc, tr);
+    test_sort_vector_type<float32<B/4>>(tc, tr);
+    test_sort_vector_type<float64<B/8>>(tc, tr);
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+    test_sort_vector_type<int64<B/8>>(tc, tr);
+    test_sort_vector_type<uint64<B/8>>(tc, tr);
+#endif
+}
+
+void test_sort(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("sort");
+    test_sort_vector_n<16>(tc, tr);
+    test_sort_vector_n<32>(tc, tr);
+    test_sort_vector_n<64>(tc, tr);
+    test_sort_vector_n<256>(tc, tr);
+
+    test_sort_array_type<int32_t>(tr);
+    test_sort_array_type<uint32_t>(tr);
+    test_sort_array_type<float>(tr);
+    test_sort_array_type<int64_t>(tr);
+    test_sort_array_type<uint64_t>(tr);
+    test_sort_array_type<double>(tr);
+
+    test_sort_array_nan<float>(tr);
+    test_sort_array_nan<double>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
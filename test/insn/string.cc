@@ -0,0 +1,107 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+static const char* ref_find_first_of(const char* s, std::size_t n,
+                                     const char* set, std::size_t set_size)
+{
+    const char* r = std::find_first_of(s, s + n, set, set + set_size);
+    return r == s + n ? nullptr : r;
+}
+
+static const void* ref_memrchr(const void* s, int c, std::size_t n)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+    while (n > 0) {
+        n--;
+        if (p[n] == (unsigned char) c)
+            return p + n;
+    }
+    return nullptr;
+}
+
+static int sign(int x)
+{
+    return x < 0 ? -1 : (x > 0 ? 1 : 0);
+}
+
+/*  The strings are tested at all offsets within a block of 64 bytes and with
+    lengths that cover the first block, the main loop and the tail. The
+    buffer is padded so that the blocks around the strings are accessible.
+*/
+void test_string(TestResults&, TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned max_size = 64 * 5 + 7;
+    const unsigned pad = 64;
+
+    std::vector<char, aligned_allocator<char, 64>> buf(pad + 64 + max_size + pad);
+    std::vector<char, aligned_allocator<char, 64>> buf2(buf.size());
+    uint32_t seed = 1;
+    for (unsigned i = 0; i < buf.size(); ++i) {
+        seed = seed * 1103515245 + 12345;
+        // a small alphabet so that the matches are spread over the string
+        buf[i] = char("abcdefgh\xe1\x80-/ \t"[(seed >> 16) % 14]);
+    }
+    buf2 = buf;
+
+    const char set_ascii[] = "-/";
+    const char set_high[] = "\x80 ";
+    const char set_large[] = "0123456789\t";
+
+    for (unsigned off = 0; off < 64; ++off) {
+        for (unsigned n = 0; n <= max_size; ++n) {
+            const char* s = buf.data() + pad + off;
+
+            for (int c : { 'a', 'h', '\xe1', 'z' }) {
+                TEST_EQUAL(tr, std::memchr(s, c, n), simdpp::memchr(s, c, n));
+                TEST_EQUAL(tr, ref_memrchr(s, c, n), simdpp::memrchr(s, c, n));
+            }
+
+            TEST_EQUAL(tr, ref_find_first_of(s, n, set_ascii, 2),
+                       simdpp::find_first_of(s, n, set_ascii, 2));
+            TEST_EQUAL(tr, ref_find_first_of(s, n, set_high, 2),
+                       simdpp::find_first_of(s, n, set_high, 2));
+            TEST_EQUAL(tr, ref_find_first_of(s, n, set_large, 11),
+                       simdpp::find_first_of(s, n, set_large, 11));
+
+            // memcmp and memeq with a difference at various positions
+            char* s2 = buf2.data() + pad + (off * 7) % 64;
+            std::memcpy(s2, s, n);
+            TEST_EQUAL(tr, true, simdpp::memeq(s, s2, n));
+            TEST_EQUAL(tr, 0, simdpp::memcmp(s, s2, n));
+            if (n > 0) {
+                unsigned pos = (off * 13 + n / 2) % n;
+                s2[pos] = char(s2[pos] + 0x40);
+                TEST_EQUAL(tr, false, simdpp::memeq(s, s2, n));
+                TEST_EQUAL(tr, sign(std::memcmp(s, s2, n)),
+                           sign(simdpp::memcmp(s, s2, n)));
+                TEST_EQUAL(tr, sign(std::memcmp(s2, s, n)),
+                           sign(simdpp::memcmp(s2, s, n)));
+            }
+        }
+
+        // strlen
+        for (unsigned n = 0; n <= max_size; n += 3) {
+            char* s = buf.data() + pad + off;
+            char saved = s[n];
+            s[n] = 0;
+            TEST_EQUAL(tr, std::strlen(s), simdpp::strlen(s));
+            s[n] = saved;
+        }
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
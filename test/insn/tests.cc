@@ -62,9 +62,26 @@ void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& o
     test_shuffle_generic(res);
     test_shuffle(res);
     test_shuffle_bytes(res, tr);
+    test_compress(res, tr);
+    test_masked_ops(res, tr);
+    test_load_masked(res, tr);
+    test_divider(res, tr);
+    test_float16(res, tr);
+    test_dot_acc(res, tr);
+    test_abs_diff(res, tr);
+    test_prefix_sum(res, tr);
+    test_bit_manip(res, tr);
+    test_sort(res, tr);
+    test_string(res, tr);
+    test_utf8(res, tr);
+    test_codec(res, tr);
+    test_classify(res, tr);
+    test_linalg(res, tr);
 
     test_convert(res);
     test_math_fp(res, opts);
+    test_math_func(res, tr);
+    test_algorithm(res, tr);
     test_math_int(res);
     test_compare(res);
     test_math_shift(res);
@@ -20,10 +20,27 @@ void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& o
 void test_bitwise(TestResults& res, TestReporter& tr);
 void test_blend(TestResults& res);
 void test_compare(TestResults& res);
+void test_compress(TestResults& res, TestReporter& tr);
+void test_masked_ops(TestResults& res, TestReporter& tr);
+void test_load_masked(TestResults& res, TestReporter& tr);
+void test_divider(TestResults& res, TestReporter& tr);
+void test_float16(TestResults& res, TestReporter& tr);
+void test_dot_acc(TestResults& res, TestReporter& tr);
+void test_abs_diff(TestResults& res, TestReporter& tr);
+void test_prefix_sum(TestResults& res, TestReporter& tr);
+void test_bit_manip(TestResults& res, TestReporter& tr);
+void test_sort(TestResults& res, TestReporter& tr);
+void test_string(TestResults& res, TestReporter& tr);
+void test_utf8(TestResults& res, TestReporter& tr);
+void test_codec(TestResults& res, TestReporter& tr);
+void test_classify(TestResults& res, TestReporter& tr);
+void test_linalg(TestResults& res, TestReporter& tr);
 void test_convert(TestResults& res);
 void test_construct(TestResults& res);
 void test_for_each(TestResults& res, TestReporter& tr);
 void test_math_fp(TestResults& res, const TestOptions& opts);
+void test_math_func(TestResults& res, TestReporter& tr);
+void test_algorithm(TestResults& res, TestReporter& tr);
 void test_math_int(TestResults& res);
 void test_math_shift(TestResults& res);
 void test_memory_load(TestResults& res, TestReporter& tr);
@@ -0,0 +1,194 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../utils/test_rng.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Decodes the UTF-8 string as defined by RFC 3629. Returns false on error
+static bool ref_utf8_decode(const std::string& s, std::vector<uint32_t>& out)
+{
+    out.clear();
+    std::size_t i = 0;
+    while (i < s.size()) {
+        uint32_t c = uint8_t(s[i]);
+        unsigned len;
+        uint32_t min;
+        if (c < 0x80) {
+            out.push_back(c);
+            i++;
+            continue;
+        } else if ((c & 0xe0) == 0xc0) {
+            len = 2; min = 0x80; c &= 0x1f;
+        } else if ((c & 0xf0) == 0xe0) {
+            len = 3; min = 0x800; c &= 0x0f;
+        } else if ((c & 0xf8) == 0xf0) {
+            len = 4; min = 0x10000; c &= 0x07;
+        } else {
+            return false;
+        }
+        if (s.size() - i < len)
+            return false;
+        for (unsigned j = 1; j < len; ++j) {
+            uint8_t b = s[i + j];
+            if ((b & 0xc0) != 0x80)
+                return false;
+            c = c << 6 | (b & 0x3f);
+        }
+        if (c < min || c > 0x10ffff || (c >= 0xd800 && c <= 0xdfff))
+            return false;
+        out.push_back(c);
+        i += len;
+    }
+    return true;
+}
+
+static std::vector<uint16_t> ref_to_utf16(const std::vector<uint32_t>& cps)
+{
+    std::vector<uint16_t> r;
+    for (uint32_t c : cps) {
+        if (c < 0x10000) {
+            r.push_back(uint16_t(c));
+        } else {
+            r.push_back(uint16_t(0xd800 | (c - 0x10000) >> 10));
+            r.push_back(uint16_t(0xdc00 | (c & 0x3ff)));
+        }
+    }
+    return r;
+}
+
+static void utf8_encode(std::string& s, uint32_t c)
+{
+    if (c < 0x80) {
+        s += char(c);
+    } else if (c < 0x800) {
+        s += char(0xc0 | c >> 6);
+        s += char(0x80 | (c & 0x3f));
+    } else if (c < 0x10000) {
+        s += char(0xe0 | c >> 12);
+        s += char(0x80 | (c >> 6 & 0x3f));
+        s += char(0x80 | (c & 0x3f));
+    } else {
+        s += char(0xf0 | c >> 18);
+        s += char(0x80 | (c >> 12 & 0x3f));
+        s += char(0x80 | (c >> 6 & 0x3f));
+        s += char(0x80 | (c & 0x3f));
+    }
+}
+
+// Returns a valid string with mostly ASCII and some of the longer sequences
+static std::string make_utf8_string(TestRng& rng, std::size_t min_size)
+{
+    std::string s;
+    while (s.size() < min_size) {
+        uint64_t x = rng.next();
+        uint32_t r = uint32_t(x >> 32);
+        uint32_t c;
+        switch ((x >> 29) & 7) {
+        case 0: c = 0x80 + r % (0x800 - 0x80); break;
+        case 1: c = 0x800 + r % (0xd800 - 0x800); break;
+        case 2: c = 0xe000 + r % (0x10000 - 0xe000); break;
+        case 3: c = 0x10000 + r % (0x110000 - 0x10000); break;
+        default: c = 0x20 + r % 0x5f; break;
+        }
+        utf8_encode(s, c);
+    }
+    return s;
+}
+
+/*  Checks the validation and both transcoders against the reference. The
+    string is copied so that it starts at the given offset within a block of
+    64 bytes and is followed by unrelated bytes.
+*/
+static void check_utf8(TestReporter& tr, const std::string& s, unsigned offset)
+{
+    using namespace simdpp;
+    std::vector<char, aligned_allocator<char, 64>> buf(offset + s.size() + 64,
+                                                       '\x80');
+    std::copy(s.begin(), s.end(), buf.begin() + offset);
+    const char* p = buf.data() + offset;
+
+    std::vector<uint32_t> ref32;
+    bool valid = ref_utf8_decode(s, ref32);
+    std::vector<uint16_t> ref16 = ref_to_utf16(ref32);
+
+    TEST_EQUAL(tr, valid, simdpp::utf8_validate(p, s.size()));
+
+    std::vector<uint32_t> out32(s.size() + 1);
+    std::vector<uint16_t> out16(s.size() + 1);
+    std::size_t n32 = simdpp::utf8_to_utf32(
+            p, s.size(), reinterpret_cast<char32_t*>(out32.data()));
+    std::size_t n16 = simdpp::utf8_to_utf16(
+            p, s.size(), reinterpret_cast<char16_t*>(out16.data()));
+    if (!valid) {
+        TEST_EQUAL(tr, utf8_error, n32);
+        TEST_EQUAL(tr, utf8_error, n16);
+        return;
+    }
+    TEST_EQUAL(tr, ref32.size(), n32);
+    TEST_EQUAL(tr, ref16.size(), n16);
+    if (n32 == ref32.size())
+        TEST_EQUAL_MEMORY(tr, ref32.data(), out32.data(), n32);
+    if (n16 == ref16.size())
+        TEST_EQUAL_MEMORY(tr, ref16.data(), out16.data(), n16);
+}
+
+void test_utf8(TestResults&, TestReporter& tr)
+{
+    TestRng rng(1);
+
+    /*  All prefixes of a valid string are checked, thus sequences truncated
+        at the end of the input are covered at every position within a block.
+    */
+    std::string valid = make_utf8_string(rng, 64 * 4 + 5);
+    for (unsigned offset = 0; offset < 64; offset += 7) {
+        for (std::size_t n = 0; n <= valid.size(); ++n) {
+            check_utf8(tr, valid.substr(0, n), offset);
+        }
+    }
+
+    // Long ASCII run so that the fast path is taken around the sequences
+    std::string ascii(200, 'a');
+    std::string tail = make_utf8_string(rng, 130);
+
+    const char* seqs[] = {
+        // valid boundary cases
+        "\xc2\x80", "\xdf\xbf", "\xe0\xa0\x80", "\xed\x9f\xbf",
+        "\xee\x80\x80", "\xef\xbf\xbf", "\xf0\x90\x80\x80", "\xf4\x8f\xbf\xbf",
+        // overlong encodings
+        "\xc0\x80", "\xc1\xbf", "\xe0\x80\x80", "\xe0\x9f\xbf",
+        "\xf0\x80\x80\x80", "\xf0\x8f\xbf\xbf",
+        // surrogates
+        "\xed\xa0\x80", "\xed\xaf\xbf", "\xed\xb0\x80", "\xed\xbf\xbf",
+        // too large
+        "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xf7\xbf\xbf\xbf", "\xf8",
+        "\xff",
+        // stray continuation bytes and sequences that are too long
+        "\x80", "\xbf", "\xc3\xa9\xa9", "\xe2\x82\xac\x80",
+        "\xf0\x9f\x98\x80\x80",
+        // truncated sequences followed by other characters
+        "\xc3", "\xe2\x82", "\xf0\x9f\x98", "\xe2\xc3\xa9",
+        "\xf0\x9f\xe2\x82\xac",
+    };
+
+    for (const char* seq : seqs) {
+        for (std::size_t pos = 0; pos < 140; ++pos) {
+            std::string s = ascii.substr(0, pos) + seq;
+            check_utf8(tr, s, pos % 64);
+            check_utf8(tr, s + tail, 0);
+            check_utf8(tr, s + ascii, 0);
+        }
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -6,6 +6,7 @@
 */
 
 #include "dispatcher/dispatcher.h"
+#include <simdpp/simd.h>
 #include <algorithm>
 #include <iostream>
 #include <string>
@@ -18,6 +19,7 @@
 #include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
 #include <simdpp/dispatch/get_arch_raw_cpuid.h>
 #include <simdpp/dispatch/get_arch_string_list.h>
+#include <simdpp/dispatch/current_arch.h>
 
 static simdpp::Arch g_supported_arch;
 
@@ -91,6 +93,78 @@ void test_dispatcher_template2_pair_for_type(TestReporter& tr)
     TEST_EQUAL(tr, (U)(sizeof(U)), pair.second);
 }
 
+// Sets or, if value is null, removes the SIMDPP_ARCH_MASK variable
+void set_arch_mask_env(const char* value)
+{
+#if _WIN32
+    _putenv_s("SIMDPP_ARCH_MASK", value ? value : "");
+#else
+    if (value) {
+        setenv("SIMDPP_ARCH_MASK", value, 1);
+    } else {
+        unsetenv("SIMDPP_ARCH_MASK");
+    }
+#endif
+}
+
+void test_arch_mask_env(TestReporter& tr)
+{
+    using simdpp::Arch;
+    using simdpp::detail::detect_current_arch;
+    auto as_uint = [](Arch a) { return static_cast<unsigned>(a); };
+
+    set_arch_mask_env(nullptr);
+    Arch detected = detect_current_arch();
+
+    set_arch_mask_env("");
+    TEST_EQUAL(tr, as_uint(detected), as_uint(detect_current_arch()));
+
+    set_arch_mask_env("0");
+    TEST_EQUAL(tr, 0u, as_uint(detect_current_arch()));
+
+    set_arch_mask_env("0x6");
+    TEST_EQUAL(tr, as_uint(detected) & 0x6u, as_uint(detect_current_arch()));
+
+    // numbers with trailing garbage are ignored
+    set_arch_mask_env("0x6z");
+    TEST_EQUAL(tr, as_uint(detected), as_uint(detect_current_arch()));
+
+    // unknown names select no instruction sets
+    set_arch_mask_env("unknown");
+    TEST_EQUAL(tr, 0u, as_uint(detect_current_arch()));
+#if SIMDPP_X86
+    set_arch_mask_env("sse2,sse3");
+    TEST_EQUAL(tr, as_uint(detected & (Arch::X86_SSE2 | Arch::X86_SSE3)),
+               as_uint(detect_current_arch()));
+#endif
+
+    set_arch_mask_env(nullptr);
+}
+
+void test_arch_mask(TestReporter& tr)
+{
+    using simdpp::Arch;
+    using simdpp::detail::parse_arch_mask;
+    auto as_uint = [](Arch a) { return static_cast<unsigned>(a); };
+
+    Arch all = static_cast<Arch>(0x7fff);
+    TEST_EQUAL(tr, as_uint(all), as_uint(parse_arch_mask(nullptr, all)));
+    TEST_EQUAL(tr, as_uint(all), as_uint(parse_arch_mask("", all)));
+    TEST_EQUAL(tr, 0x6u, as_uint(parse_arch_mask("0x6", all)));
+    TEST_EQUAL(tr, 0x6u, as_uint(parse_arch_mask("6", all)));
+    TEST_EQUAL(tr, 0u, as_uint(parse_arch_mask("0", all)));
+    TEST_EQUAL(tr, 0x2u, as_uint(parse_arch_mask("0x6", static_cast<Arch>(0x3))));
+    TEST_EQUAL(tr, as_uint(all), as_uint(parse_arch_mask("0x6z", all)));
+#if SIMDPP_X86
+    TEST_EQUAL(tr, as_uint(Arch::X86_SSE2 | Arch::X86_SSE3),
+               as_uint(parse_arch_mask("sse2,sse3", all)));
+#endif
+
+    // the cached value must be stable
+    TEST_EQUAL(tr, as_uint(simdpp::current_arch()),
+               as_uint(simdpp::current_arch()));
+}
+
 int main(int argc, char** argv)
 {
     using simdpp::Arch;
@@ -146,6 +220,9 @@ int main(int argc, char** argv)
 
     TestReporter tr(std::cerr);
 
+    test_arch_mask(tr);
+    test_arch_mask_env(tr);
+
     Arch selected = test_dispatcher_get_arch();
     if (selected != g_supported_arch) {
         tr.out() << "Wrong architecture selected: \n"
@@ -240,6 +317,14 @@ int main(int argc, char** argv)
     test_dispatcher_template2_pair_for_type<int, char>(tr);
     test_dispatcher_template2_pair_for_type<char, char>(tr);
 
+    // dispatch_init() repeats the selection of already resolved dispatchers
+    // and resolves those that have not been called yet
+    g_supported_arch = Arch::NONE_NULL;
+    simdpp::dispatch_init();
+    TEST_EQUAL(tr, static_cast<unsigned>(Arch::NONE_NULL),
+               static_cast<unsigned>(test_dispatcher_get_arch()));
+    TEST_EQUAL(tr, 1+2, test_dispatcher_ret2(1, 2));
+
     tr.report_summary();
     return tr.success() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
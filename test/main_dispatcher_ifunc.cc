@@ -0,0 +1,41 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "dispatcher/dispatcher_ifunc.h"
+#include <simdpp/simd.h>
+#include <simdpp/dispatch/get_arch_gcc_builtin_cpu_supports.h>
+#include <cstdlib>
+#include <iostream>
+#include "utils/test_helpers.h"
+
+#ifndef SIMDPP_DISPATCH_USE_IFUNC
+#error "The test must be compiled with SIMDPP_DISPATCH_USE_IFUNC"
+#endif
+
+int main()
+{
+    using simdpp::Arch;
+    auto as_uint = [](Arch a) { return static_cast<unsigned>(a); };
+
+    TestReporter tr(std::cerr);
+
+    Arch detected = simdpp::get_arch_gcc_builtin_cpu_supports();
+    Arch selected = test_dispatcher_ifunc_get_arch();
+
+    // The loader must have picked the same version as the regular dispatcher
+    // given the same architecture information
+    TEST_EQUAL(tr, as_uint(test_dispatcher_ifunc_get_arch_template<int>()),
+               as_uint(selected));
+
+    // The selected version must not require unsupported instruction sets
+    TEST_EQUAL(tr, 0u, as_uint(selected & ~detected));
+
+    TEST_EQUAL(tr, as_uint(selected), as_uint(test_dispatcher_ifunc_get_arch()));
+
+    tr.report_summary();
+    return tr.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
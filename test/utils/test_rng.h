@@ -0,0 +1,33 @@
+/*  Copyright (C) 2026  agent <agent@local>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_TEST_UTILS_TEST_RNG_H
+#define LIBSIMDPP_TEST_UTILS_TEST_RNG_H
+
+#include <cstdint>
+
+/*  A 64-bit linear congruential generator used to produce reproducible test
+    data. The same sequence is generated on all platforms, thus the results of
+    different architectures can be compared with each other. The low bits of
+    the state have short periods, callers should use the high bits.
+*/
+class TestRng {
+public:
+    explicit TestRng(uint64_t seed) : state_(seed) {}
+
+    // Advances the generator and returns the new state
+    uint64_t next()
+    {
+        state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+        return state_;
+    }
+
+private:
+    uint64_t state_;
+};
+
+#endif